@@ -33,7 +33,9 @@
 # Set the following CMake variables BEFORE calling find_packages to
 # change the behaviour of this module:
 # - ``ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLE`` {ON, OFF}
+# - ``ALPAKA_ACC_CPU_B_SEQ_T_SIMD_ENABLE`` {ON, OFF}
 # - ``ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLE`` {ON, OFF}
+# - ``ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLE`` {ON, OFF}
 # - ``ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE`` {ON, OFF}
 # - ``ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE`` {ON, OFF}
 # - ``ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE`` {ON, OFF}
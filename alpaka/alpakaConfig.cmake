@@ -84,7 +84,9 @@ INCLUDE("${_ALPAKA_ADD_EXECUTABLE_FILE}")
 # Options.
 #-------------------------------------------------------------------------------
 OPTION(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLE "Enable the serial CPU accelerator" ON)
+OPTION(ALPAKA_ACC_CPU_B_SEQ_T_SIMD_ENABLE "Enable the SIMD lane CPU block thread accelerator" ON)
 OPTION(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLE "Enable the threads CPU block thread accelerator" ON)
+OPTION(ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLE "Enable the threads CPU grid block accelerator" ON)
 OPTION(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE "Enable the fibers CPU block thread accelerator" ON)
 OPTION(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE "Enable the OpenMP 2.0 CPU grid block accelerator" ON)
 OPTION(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE "Enable the OpenMP 2.0 CPU block thread accelerator" ON)
@@ -300,7 +302,7 @@ ELSE()
     ENDIF()
 
     # Add linker options.
-    IF(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLE)
+    IF(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLE OR ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLE)
         LIST(APPEND _ALPAKA_LINK_LIBRARIES_PUBLIC "general;pthread")
     ENDIF()
     # librt: undefined reference to `clock_gettime'
@@ -322,10 +324,18 @@ IF(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLE)
     LIST(APPEND _ALPAKA_COMPILE_DEFINITIONS_PUBLIC "ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED")
     MESSAGE(STATUS ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED)
 ENDIF()
+IF(ALPAKA_ACC_CPU_B_SEQ_T_SIMD_ENABLE)
+    LIST(APPEND _ALPAKA_COMPILE_DEFINITIONS_PUBLIC "ALPAKA_ACC_CPU_B_SEQ_T_SIMD_ENABLED")
+    MESSAGE(STATUS ALPAKA_ACC_CPU_B_SEQ_T_SIMD_ENABLED)
+ENDIF()
 IF(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLE)
     LIST(APPEND _ALPAKA_COMPILE_DEFINITIONS_PUBLIC "ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED")
     MESSAGE(STATUS ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED)
 ENDIF()
+IF(ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLE)
+    LIST(APPEND _ALPAKA_COMPILE_DEFINITIONS_PUBLIC "ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLED")
+    MESSAGE(STATUS ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLED)
+ENDIF()
 IF(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE)
     LIST(APPEND _ALPAKA_COMPILE_DEFINITIONS_PUBLIC "ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED")
     MESSAGE(STATUS ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED)
@@ -0,0 +1,322 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::exec::create
+
+#include <algorithm>                                // std::sort
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <cstdint>                                  // std::uint32_t
+#include <iostream>                                 // std::cout
+#include <string>                                   // std::string
+#include <utility>                                  // std::pair
+#include <vector>                                   // std::vector
+
+//#############################################################################
+//! Computes the Mandelbrot iteration count of one pixel per thread.
+//! The cost per block is highly irregular.
+//#############################################################################
+class MandelbrotKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::uint32_t * const pIterations,
+        std::uint32_t const & numRows,
+        std::uint32_t const & numCols,
+        std::uint32_t const & maxIterations) const
+    -> void
+    {
+        auto const gridThreadIdx(alpaka::idx::getIdx<alpaka::Grid, alpaka::Threads>(acc));
+        auto const row(static_cast<std::uint32_t>(gridThreadIdx[0u]));
+        auto const col(static_cast<std::uint32_t>(gridThreadIdx[1u]));
+
+        if((row < numRows) && (col < numCols))
+        {
+            float const cr(-2.0f + static_cast<float>(col) / static_cast<float>(numCols - 1u) * 3.0f);
+            float const ci(-1.2f + static_cast<float>(row) / static_cast<float>(numRows - 1u) * 2.4f);
+            float zr(0.0f);
+            float zi(0.0f);
+            std::uint32_t iterations(0u);
+            for(; (iterations < maxIterations) && (zr * zr + zi * zi <= 4.0f); ++iterations)
+            {
+                float const zrNew(zr * zr - zi * zi + cr);
+                zi = 2.0f * zr * zi + ci;
+                zr = zrNew;
+            }
+            pIterations[row * numCols + col] = iterations;
+        }
+    }
+};
+
+//#############################################################################
+//! Computes one element of C = A * B per thread.
+//! The cost per block is uniform but neighbouring blocks share rows of A.
+//#############################################################################
+class MatMulKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::uint32_t const & n,
+        float const * const pA,
+        float const * const pB,
+        float * const pC) const
+    -> void
+    {
+        auto const gridThreadIdx(alpaka::idx::getIdx<alpaka::Grid, alpaka::Threads>(acc));
+        auto const row(static_cast<std::uint32_t>(gridThreadIdx[0u]));
+        auto const col(static_cast<std::uint32_t>(gridThreadIdx[1u]));
+
+        if((row < n) && (col < n))
+        {
+            float sum(0.0f);
+            for(std::uint32_t k(0u); k < n; ++k)
+            {
+                sum += pA[row * n + k] * pB[k * n + col];
+            }
+            pC[row * n + col] = sum;
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! \return The median of the given durations in milliseconds.
+//-----------------------------------------------------------------------------
+auto medianMs(
+    std::vector<std::chrono::high_resolution_clock::duration> durations)
+-> double
+{
+    std::sort(durations.begin(), durations.end());
+    return std::chrono::duration<double, std::milli>(durations[durations.size() / 2u]).count();
+}
+
+//-----------------------------------------------------------------------------
+//! \return The median duration of the executor run in a synchronous stream.
+//-----------------------------------------------------------------------------
+template<
+    typename TExec>
+auto measureMs(
+    TExec const & exec,
+    std::size_t const & repetitionCount)
+-> double
+{
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::stream::StreamCpuSync stream(dev);
+
+    // Warm up.
+    alpaka::stream::enqueue(stream, exec);
+
+    std::vector<std::chrono::high_resolution_clock::duration> durations;
+    durations.reserve(repetitionCount);
+    for(std::size_t i(0u); i < repetitionCount; ++i)
+    {
+        auto const tpStart(std::chrono::high_resolution_clock::now());
+        alpaka::stream::enqueue(stream, exec);
+        durations.emplace_back(std::chrono::high_resolution_clock::now() - tpStart);
+    }
+
+    return medianMs(durations);
+}
+
+//-----------------------------------------------------------------------------
+//! \return The median run time of the given kernel for the given schedule on the AccCpuThreadsBlocks accelerator.
+//-----------------------------------------------------------------------------
+template<
+    typename TAcc,
+    typename TKernel,
+    typename... TArgs>
+auto measureScheduleMs(
+    alpaka::exec::Schedule const & schedule,
+    alpaka::workdiv::WorkDivMembers<alpaka::dim::DimInt<2u>, std::size_t> const & workDiv,
+    std::size_t const & repetitionCount,
+    TKernel const & kernel,
+    TArgs const & ... args)
+-> double
+{
+    auto exec(alpaka::exec::create<TAcc>(
+        workDiv,
+        kernel,
+        args...));
+    exec.setSchedule(schedule);
+
+    return measureMs(exec, repetitionCount);
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                        alpaka block schedule benchmark                         " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        std::uint32_t const imageSize(128u);
+        std::uint32_t const matrixSize(64u);
+        std::size_t const repetitionCount(3u);
+#else
+        std::uint32_t const imageSize(1024u);
+        std::uint32_t const matrixSize(512u);
+        std::size_t const repetitionCount(11u);
+#endif
+        std::uint32_t const maxIterations(300u);
+
+#ifdef ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLED
+        using Dim = alpaka::dim::DimInt<2u>;
+        using Size = std::size_t;
+        using Acc = alpaka::acc::AccCpuThreadsBlocks<Dim, Size>;
+        using ScheduleKind = alpaka::exec::ScheduleKind;
+
+        std::vector<std::pair<std::string, alpaka::exec::Schedule>> const schedules{
+            {"static", alpaka::exec::Schedule(ScheduleKind::Static)},
+            {"static,64", alpaka::exec::Schedule(ScheduleKind::Static, 64u)},
+            {"dynamic,1", alpaka::exec::Schedule(ScheduleKind::Dynamic, 1u)},
+            {"dynamic,64", alpaka::exec::Schedule(ScheduleKind::Dynamic, 64u)},
+            {"guided", alpaka::exec::Schedule(ScheduleKind::Guided)},
+            {"stealing,1", alpaka::exec::Schedule(ScheduleKind::Stealing, 1u)},
+            {"stealing,16", alpaka::exec::Schedule(ScheduleKind::Stealing, 16u)}};
+
+        // The block parallel accelerators only support a single thread per block.
+        alpaka::Vec<Dim, Size> const blockThreadExtents(alpaka::Vec<Dim, Size>::ones());
+
+        alpaka::Vec<Dim, Size> const imageExtents(
+            static_cast<Size>(imageSize),
+            static_cast<Size>(imageSize));
+        alpaka::workdiv::WorkDivMembers<Dim, Size> const workDivMandelbrot(
+            imageExtents,
+            blockThreadExtents);
+        std::vector<std::uint32_t> iterations(imageSize * imageSize);
+        MandelbrotKernel mandelbrotKernel;
+
+        alpaka::Vec<Dim, Size> const matrixExtents(
+            static_cast<Size>(matrixSize),
+            static_cast<Size>(matrixSize));
+        alpaka::workdiv::WorkDivMembers<Dim, Size> const workDivMatMul(
+            matrixExtents,
+            blockThreadExtents);
+        std::vector<float> a(matrixSize * matrixSize, 1.0f);
+        std::vector<float> b(matrixSize * matrixSize, 2.0f);
+        std::vector<float> c(matrixSize * matrixSize, 0.0f);
+        MatMulKernel matMulKernel;
+
+        std::cout << alpaka::acc::getAccName<Acc>()
+            << " (median over " << repetitionCount << " runs, "
+            << alpaka::acc::getAccDevProps<Acc>(alpaka::dev::cpu::getDev()).m_multiProcessorCount << " workers)" << std::endl;
+        std::cout << "schedule mandelbrot" << imageSize << "[ms] matMul" << matrixSize << "[ms]" << std::endl;
+
+        for(auto const & schedule : schedules)
+        {
+            auto const mandelbrotMs(
+                measureScheduleMs<Acc>(
+                    schedule.second,
+                    workDivMandelbrot,
+                    repetitionCount,
+                    mandelbrotKernel,
+                    iterations.data(),
+                    imageSize,
+                    imageSize,
+                    maxIterations));
+            auto const matMulMs(
+                measureScheduleMs<Acc>(
+                    schedule.second,
+                    workDivMatMul,
+                    repetitionCount,
+                    matMulKernel,
+                    matrixSize,
+                    a.data(),
+                    b.data(),
+                    c.data()));
+
+            std::cout << schedule.first << " " << mandelbrotMs << " " << matMulMs << std::endl;
+        }
+
+        // Validate the results of the last run.
+        bool resultCorrect(c[0u] == 2.0f * static_cast<float>(matrixSize) && c.back() == 2.0f * static_cast<float>(matrixSize));
+        for(auto const & iteration : iterations)
+        {
+            resultCorrect = resultCorrect && (iteration <= maxIterations);
+        }
+
+#ifdef ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED
+        // The OpenMP 2.0 block accelerator with its hard-coded schedule(guided) for comparison.
+        using AccOmp2Blocks = alpaka::acc::AccCpuOmp2Blocks<Dim, Size>;
+        auto const mandelbrotOmp2BlocksMs(
+            measureMs(
+                alpaka::exec::create<AccOmp2Blocks>(
+                    workDivMandelbrot,
+                    mandelbrotKernel,
+                    iterations.data(),
+                    imageSize,
+                    imageSize,
+                    maxIterations),
+                repetitionCount));
+        auto const matMulOmp2BlocksMs(
+            measureMs(
+                alpaka::exec::create<AccOmp2Blocks>(
+                    workDivMatMul,
+                    matMulKernel,
+                    matrixSize,
+                    a.data(),
+                    b.data(),
+                    c.data()),
+                repetitionCount));
+        std::cout << alpaka::acc::getAccName<AccOmp2Blocks>() << " " << mandelbrotOmp2BlocksMs << " " << matMulOmp2BlocksMs << std::endl;
+#endif
+
+        if(!resultCorrect)
+        {
+            std::cerr << "The results are wrong!" << std::endl;
+            return EXIT_FAILURE;
+        }
+#else
+        std::cout << "AccCpuThreadsBlocks is not enabled." << std::endl;
+#endif
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
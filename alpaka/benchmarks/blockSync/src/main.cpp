@@ -0,0 +1,284 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::exec::create
+#include <alpaka/core/BarrierThread.hpp>            // alpaka::core::threads::BarrierThread
+#include <alpaka/core/BarrierThreadSpin.hpp>        // alpaka::core::threads::BarrierThreadSpin
+
+#include <algorithm>                                // std::max
+#include <atomic>                                   // std::atomic
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <iostream>                                 // std::cout
+#include <mutex>                                    // std::mutex
+#include <thread>                                   // std::thread
+#include <vector>                                   // std::vector
+
+//#############################################################################
+//! The barrier scheme AccCpuThreads used before BarrierThreadSpin.
+//! Two mutex and condition variable barriers are used alternately and the first thread reaching one resets it under a second mutex.
+//#############################################################################
+class BarrierThreadPingPong
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! Constructor.
+    //-----------------------------------------------------------------------------
+    explicit BarrierThreadPingPong(
+        std::size_t const & numThreads) :
+            m_numThreads(numThreads)
+    {}
+
+    //-----------------------------------------------------------------------------
+    //! Waits for all the other threads to reach the barrier.
+    //! \param barrierIdx The number of barriers the calling thread has passed.
+    //-----------------------------------------------------------------------------
+    auto wait(
+        std::size_t & barrierIdx)
+    -> void
+    {
+        auto & bar(m_barriers[barrierIdx % 2u]);
+        if(bar.getNumThreadsToWaitFor() == 0u)
+        {
+            std::lock_guard<std::mutex> lock(m_mtxBarrier);
+            if(bar.getNumThreadsToWaitFor() == 0u)
+            {
+                bar.reset(m_numThreads);
+            }
+        }
+        bar.wait();
+        ++barrierIdx;
+    }
+
+private:
+    std::size_t const m_numThreads;
+    alpaka::core::threads::BarrierThread<std::size_t> m_barriers[2];
+    std::mutex m_mtxBarrier;
+};
+
+//#############################################################################
+//! Adapts BarrierThreadSpin to the interface of BarrierThreadPingPong.
+//#############################################################################
+class BarrierThreadSpinAdapter
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! Constructor.
+    //-----------------------------------------------------------------------------
+    BarrierThreadSpinAdapter(
+        std::size_t const & numThreads,
+        std::size_t const & spinCount) :
+            m_barrier(numThreads, spinCount)
+    {}
+
+    //-----------------------------------------------------------------------------
+    //! Waits for all the other threads to reach the barrier.
+    //-----------------------------------------------------------------------------
+    auto wait(
+        std::size_t & barrierIdx)
+    -> void
+    {
+        m_barrier.wait();
+        ++barrierIdx;
+    }
+
+private:
+    alpaka::core::threads::BarrierThreadSpin<std::size_t> m_barrier;
+};
+
+//-----------------------------------------------------------------------------
+//! \return The number of barriers per second reached by the given number of threads.
+//! Every thread increments a shared counter before each barrier and checks it afterwards so a broken barrier is detected.
+//-----------------------------------------------------------------------------
+template<
+    typename TBarrier>
+auto measureBarriersPerSecond(
+    TBarrier & barrier,
+    std::size_t const & numThreads,
+    std::size_t const & barrierCount)
+-> double
+{
+    std::atomic<std::size_t> arrivals(0u);
+    std::atomic<bool> isValid(true);
+
+    auto const threadFn(
+        [&barrier, &arrivals, &isValid, numThreads, barrierCount]()
+        {
+            std::size_t barrierIdx(0u);
+            for(std::size_t i(0u); i < barrierCount; ++i)
+            {
+                arrivals.fetch_add(1u);
+                barrier.wait(barrierIdx);
+                if(arrivals.load() < (i + 1u) * numThreads)
+                {
+                    isValid = false;
+                }
+                // The counter may only be incremented for the next round after all threads have checked it.
+                barrier.wait(barrierIdx);
+            }
+        });
+
+    auto const tpStart(std::chrono::high_resolution_clock::now());
+    std::vector<std::thread> threads;
+    for(std::size_t t(1u); t < numThreads; ++t)
+    {
+        threads.emplace_back(threadFn);
+    }
+    threadFn();
+    for(auto && thread : threads)
+    {
+        thread.join();
+    }
+    auto const durationS(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - tpStart).count());
+
+    if(!isValid)
+    {
+        throw std::runtime_error("The barrier let a thread pass before all threads had arrived!");
+    }
+
+    return static_cast<double>(2u * barrierCount) / durationS;
+}
+
+//#############################################################################
+//! A kernel syncing its block threads in a loop.
+//#############################################################################
+class SyncLoopKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::size_t const & syncCount) const
+    -> void
+    {
+        for(std::size_t i(0u); i < syncCount; ++i)
+        {
+            alpaka::block::sync::syncBlockThreads(acc);
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! \return The number of syncBlockThreads per second of a single block with the given number of threads.
+//-----------------------------------------------------------------------------
+template<
+    typename TAcc>
+auto measureSyncBlockThreadsPerSecond(
+    std::size_t const & blockThreadCount,
+    std::size_t const & syncCount)
+-> double
+{
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::stream::StreamCpuSync stream(dev);
+
+    alpaka::Vec<alpaka::dim::DimInt<1u>, std::size_t> const gridBlockExtents(static_cast<std::size_t>(1u));
+    alpaka::Vec<alpaka::dim::DimInt<1u>, std::size_t> const blockThreadExtents(blockThreadCount);
+    alpaka::workdiv::WorkDivMembers<alpaka::dim::DimInt<1u>, std::size_t> const workDiv(
+        gridBlockExtents,
+        blockThreadExtents);
+
+    SyncLoopKernel kernel;
+    auto const exec(alpaka::exec::create<TAcc>(
+        workDiv,
+        kernel,
+        syncCount));
+
+    // Warm up. The first launch creates the device thread pool.
+    alpaka::stream::enqueue(stream, exec);
+
+    auto const tpStart(std::chrono::high_resolution_clock::now());
+    alpaka::stream::enqueue(stream, exec);
+    auto const durationS(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - tpStart).count());
+
+    return static_cast<double>(syncCount) / durationS;
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                       alpaka block synchronization benchmark                   " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        std::size_t const barrierCount(1000u);
+        std::size_t const threadCountMax(4u);
+#else
+        std::size_t const barrierCount(100000u);
+        std::size_t const threadCountMax(std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(2u)));
+#endif
+
+        std::cout << "Barriers per second, " << barrierCount << " rounds of two barriers each, hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+        std::cout << "threads pingPong(mutex+cv) spinThenPark parkOnly" << std::endl;
+        for(std::size_t numThreads(1u); numThreads <= threadCountMax; numThreads *= 2u)
+        {
+            BarrierThreadPingPong barrierPingPong(numThreads);
+            BarrierThreadSpinAdapter barrierSpin(numThreads, alpaka::core::threads::BarrierThreadSpin<std::size_t>::defaultSpinCount());
+            BarrierThreadSpinAdapter barrierPark(numThreads, 0u);
+
+            std::cout
+                << numThreads
+                << " " << measureBarriersPerSecond(barrierPingPong, numThreads, barrierCount)
+                << " " << measureBarriersPerSecond(barrierSpin, numThreads, barrierCount)
+                << " " << measureBarriersPerSecond(barrierPark, numThreads, barrierCount)
+                << std::endl;
+        }
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED
+        using Acc = alpaka::acc::AccCpuThreads<alpaka::dim::DimInt<1u>, std::size_t>;
+
+        std::cout << std::endl;
+        std::cout << alpaka::acc::getAccName<Acc>() << " syncBlockThreads per second in a single block" << std::endl;
+        std::cout << "blockThreads syncs/s" << std::endl;
+        for(std::size_t blockThreadCount(1u); blockThreadCount <= threadCountMax; blockThreadCount *= 2u)
+        {
+            std::cout
+                << blockThreadCount
+                << " " << measureSyncBlockThreadsPerSecond<Acc>(blockThreadCount, barrierCount)
+                << std::endl;
+        }
+#else
+        std::cout << "AccCpuThreads is not enabled." << std::endl;
+#endif
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
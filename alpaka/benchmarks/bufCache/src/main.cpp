@@ -0,0 +1,219 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::dev::cpu::setBufCacheLimit
+
+#include <boost/predef.h>                           // BOOST_OS_XXX
+
+#if BOOST_OS_UNIX
+    #include <sys/resource.h>                       // getrusage
+#endif
+
+#include <algorithm>                                // std::sort
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <iostream>                                 // std::cout
+#include <vector>                                   // std::vector
+
+using Dim = alpaka::dim::DimInt<1u>;
+using Size = std::size_t;
+
+//-----------------------------------------------------------------------------
+//! \return The number of minor page faults of the process so far or 0 if it is unknown.
+//-----------------------------------------------------------------------------
+auto getMinorPageFaultCount()
+-> std::size_t
+{
+#if BOOST_OS_UNIX
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        return static_cast<std::size_t>(usage.ru_minflt);
+    }
+#endif
+    return 0u;
+}
+
+//-----------------------------------------------------------------------------
+//! Runs iterations that each allocate, fill, copy and free temporaries of the same sizes.
+//!
+//! \return If the copies are correct.
+//-----------------------------------------------------------------------------
+auto measureIterations(
+    Size const & largeElems,
+    Size const & smallElems,
+    std::size_t const & iterationCount,
+    double & usPerIteration,
+    double & pageFaultsPerIteration)
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::stream::StreamCpuSync stream(dev);
+
+    bool correct(true);
+    std::vector<std::chrono::high_resolution_clock::duration> durations;
+    durations.reserve(iterationCount);
+    std::size_t pageFaultCount(0u);
+    for(std::size_t i(0u); i < iterationCount; ++i)
+    {
+        std::size_t const pageFaultCountStart(getMinorPageFaultCount());
+        auto const tpStart(std::chrono::high_resolution_clock::now());
+        {
+            auto large(alpaka::mem::buf::alloc<float, Size>(dev, largeElems));
+            auto largeTmp(alpaka::mem::buf::alloc<float, Size>(dev, largeElems));
+            auto small(alpaka::mem::buf::alloc<std::uint8_t, Size>(dev, smallElems));
+            alpaka::mem::view::set(stream, large, static_cast<std::uint8_t>(i), largeElems);
+            alpaka::mem::view::set(stream, small, 1u, smallElems);
+            alpaka::mem::view::copy(stream, largeTmp, large, largeElems);
+
+            correct = correct && (alpaka::mem::view::getPtrNative(largeTmp)[largeElems - 1u] == alpaka::mem::view::getPtrNative(large)[largeElems - 1u]);
+        }
+        durations.emplace_back(std::chrono::high_resolution_clock::now() - tpStart);
+        // The first iteration fills the cache.
+        if(i > 0u)
+        {
+            pageFaultCount += getMinorPageFaultCount() - pageFaultCountStart;
+        }
+    }
+    std::sort(durations.begin(), durations.end());
+    usPerIteration = std::chrono::duration<double, std::micro>(durations[durations.size() / 2u]).count();
+    pageFaultsPerIteration = static_cast<double>(pageFaultCount) / static_cast<double>(iterationCount - 1u);
+    return correct;
+}
+
+//-----------------------------------------------------------------------------
+//! \return If the statistics, the limit and the trim of the cache behave as documented.
+//-----------------------------------------------------------------------------
+auto checkCache()
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::dev::cpu::setBufCacheLimit(dev, 1u << 20u);
+    alpaka::dev::cpu::trimBufCache(dev);
+    auto const statsStart(alpaka::dev::cpu::getBufCacheStats(dev));
+
+    {
+        auto a(alpaka::mem::buf::alloc<char, Size>(dev, Size(1000u)));
+    }
+    float const * pMem(nullptr);
+    {
+        // 1000 and 1020 bytes fall into the same size class.
+        auto b(alpaka::mem::buf::alloc<char, Size>(dev, Size(1020u)));
+        // A block larger than the limit is not cached.
+        auto c(alpaka::mem::buf::alloc<float, Size>(dev, Size(1u << 19u)));
+        pMem = alpaka::mem::view::getPtrNative(c);
+    }
+    auto const stats(alpaka::dev::cpu::getBufCacheStats(dev));
+    bool correct(
+        (stats.m_hitCount == statsStart.m_hitCount + 1u)
+        && (stats.m_missCount == statsStart.m_missCount + 2u)
+        && (stats.m_releaseCount == statsStart.m_releaseCount + 1u)
+        && (stats.m_inUseBytes == 0u)
+        && (stats.m_cachedBytes == 1024u)
+        && (pMem != nullptr));
+
+    alpaka::dev::cpu::trimBufCache(dev);
+    correct = correct && (alpaka::dev::cpu::getBufCacheStats(dev).m_cachedBytes == 0u);
+
+    // Buffers allocated without a cache are not affected by enabling it later.
+    alpaka::dev::cpu::setBufCacheLimit(dev, 0u);
+    {
+        auto d(alpaka::mem::buf::alloc<char, Size>(dev, Size(100u)));
+        alpaka::dev::cpu::setBufCacheLimit(dev, 1u << 20u);
+    }
+    correct = correct && (alpaka::dev::cpu::getBufCacheStats(dev).m_cachedBytes == 0u);
+    alpaka::dev::cpu::setBufCacheLimit(dev, 0u);
+    return correct;
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                          alpaka buffer cache benchmark                         " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+        bool correct(checkCache());
+
+#if ALPAKA_INTEGRATION_TEST
+        Size const largeElems(1u << 18u);
+        std::size_t const iterationCount(5u);
+#else
+        Size const largeElems(1u << 22u);
+        std::size_t const iterationCount(51u);
+#endif
+        Size const smallElems(1000u);
+
+        std::cout << "Iterations allocating two buffers of " << largeElems * sizeof(float) << " bytes and one of " << smallElems << " bytes, median over " << iterationCount << " iterations" << std::endl;
+        std::cout << "cache time[us] pageFaults speedup" << std::endl;
+
+        auto dev(alpaka::dev::cpu::getDev());
+        double usUncached(0.0);
+        for(bool const bCached : {false, true})
+        {
+            alpaka::dev::cpu::setBufCacheLimit(dev, bCached ? (std::size_t(4u) * largeElems * sizeof(float)) : 0u);
+
+            double us(0.0);
+            double pageFaults(0.0);
+            correct = measureIterations(largeElems, smallElems, iterationCount, us, pageFaults) && correct;
+            if(!bCached)
+            {
+                usUncached = us;
+            }
+
+            std::cout
+                << (bCached ? "on" : "off")
+                << " " << us
+                << " " << pageFaults
+                << " " << (usUncached / us)
+                << std::endl;
+        }
+
+        auto const stats(alpaka::dev::cpu::getBufCacheStats(dev));
+        std::cout << "hits: " << stats.m_hitCount << " misses: " << stats.m_missCount << " releases: " << stats.m_releaseCount << " cached: " << stats.m_cachedBytes << " bytes" << std::endl;
+        // After the first iteration all three buffers come from the cache.
+        correct = correct && (stats.m_hitCount >= 3u * (iterationCount - 1u));
+        alpaka::dev::cpu::setBufCacheLimit(dev, 0u);
+
+        if(!correct)
+        {
+            std::cerr << "The results are wrong!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,278 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::exec::create
+
+#include <algorithm>                                // std::sort
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <cstdint>                                  // std::uintptr_t
+#include <iostream>                                 // std::cout
+#include <vector>                                   // std::vector
+
+using Dim = alpaka::dim::DimInt<2u>;
+using Size = std::size_t;
+using Buf = alpaka::mem::buf::BufCpu<float, Dim, Size>;
+
+//#############################################################################
+//! A kernel processing whole rows.
+//! Every thread scales and adds the rows at its grid thread index with a grid-stride loop.
+//#############################################################################
+class RowAxpyKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename TElem>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        Size const & width,
+        Size const & height,
+        TElem const & alpha,
+        TElem const * const pX,
+        Size const & pitchXElems,
+        TElem * const pY,
+        Size const & pitchYElems) const
+    -> void
+    {
+        auto const gridThreadIdx(alpaka::idx::getIdx<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+        auto const gridThreadExtent(alpaka::workdiv::getWorkDiv<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+
+        for(Size row(gridThreadIdx); row < height; row += gridThreadExtent)
+        {
+            TElem const * const pRowX(pX + row * pitchXElems);
+            TElem * const pRowY(pY + row * pitchYElems);
+            for(Size i(0u); i < width; ++i)
+            {
+                pRowY[i] = alpha * pRowX[i] + pRowY[i];
+            }
+        }
+    }
+};
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED
+//-----------------------------------------------------------------------------
+//! Runs the row kernel on buffers with the given row alignment and prints the median run time.
+//!
+//! The input is copied in from dense host memory and the result is copied back into a dense buffer, so the copies have to honour the pitch.
+//!
+//! \return If the result is correct.
+//-----------------------------------------------------------------------------
+auto measureRowAxpy(
+    Size const & width,
+    Size const & height,
+    std::size_t const & rowAlignmentBytes,
+    std::size_t const & repetitionCount,
+    double & msMedian)
+-> bool
+{
+    using Acc = alpaka::acc::AccCpuSerial<alpaka::dim::DimInt<1u>, Size>;
+
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::stream::StreamCpuSync stream(dev);
+
+    alpaka::Vec<Dim, Size> const extents(height, width);
+
+    std::vector<float> xHost1d(width * height);
+    for(std::size_t i(0u); i < xHost1d.size(); ++i)
+    {
+        xHost1d[i] = static_cast<float>(i % 7u);
+    }
+    alpaka::mem::buf::BufPlainPtrWrapper<alpaka::dev::DevCpu, float, Dim, Size> xHost(xHost1d.data(), dev, extents);
+
+    Buf x(alpaka::mem::buf::cpu::allocPitched<float, Size>(dev, extents, rowAlignmentBytes));
+    Buf y(alpaka::mem::buf::cpu::allocPitched<float, Size>(dev, extents, rowAlignmentBytes));
+    alpaka::mem::view::copy(stream, x, xHost, extents);
+    alpaka::mem::view::set(stream, y, 0u, extents);
+
+    auto const pitchXElems(alpaka::mem::view::getPitchBytes<1u>(x) / sizeof(float));
+    auto const pitchYElems(alpaka::mem::view::getPitchBytes<1u>(y) / sizeof(float));
+
+    alpaka::Vec<alpaka::dim::DimInt<1u>, Size> const gridBlockExtents(height);
+    alpaka::Vec<alpaka::dim::DimInt<1u>, Size> const blockThreadExtents(static_cast<Size>(1u));
+    alpaka::workdiv::WorkDivMembers<alpaka::dim::DimInt<1u>, Size> const workDiv(
+        gridBlockExtents,
+        blockThreadExtents);
+
+    RowAxpyKernel kernel;
+    auto const exec(alpaka::exec::create<Acc>(
+        workDiv,
+        kernel,
+        width,
+        height,
+        2.0f,
+        alpaka::mem::view::getPtrNative(x),
+        pitchXElems,
+        alpaka::mem::view::getPtrNative(y),
+        pitchYElems));
+
+    std::vector<std::chrono::high_resolution_clock::duration> durations;
+    durations.reserve(repetitionCount);
+    for(std::size_t i(0u); i < repetitionCount; ++i)
+    {
+        auto const tpStart(std::chrono::high_resolution_clock::now());
+        alpaka::stream::enqueue(stream, exec);
+        durations.emplace_back(std::chrono::high_resolution_clock::now() - tpStart);
+    }
+    std::sort(durations.begin(), durations.end());
+    msMedian = std::chrono::duration<double, std::milli>(durations[durations.size() / 2u]).count();
+
+    // Copy the padded result into a dense buffer.
+    auto yDense(alpaka::mem::buf::alloc<float, Size>(dev, extents));
+    alpaka::mem::view::copy(stream, yDense, y, extents);
+
+    bool correct(alpaka::mem::view::getPitchBytes<1u>(yDense) == width * sizeof(float));
+    // Every row has to start at the requested alignment.
+    for(Size row(0u); row < height; ++row)
+    {
+        correct = correct && ((reinterpret_cast<std::uintptr_t>(alpaka::mem::view::getPtrNative(y) + row * pitchYElems) % rowAlignmentBytes) == 0u);
+    }
+    float const * const pYDense(alpaka::mem::view::getPtrNative(yDense));
+    for(std::size_t i(0u); i < xHost1d.size(); ++i)
+    {
+        correct = correct && (pYDense[i] == static_cast<float>(repetitionCount) * 2.0f * xHost1d[i]);
+    }
+    return correct;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+//! \return If the pitches of a padded three dimensional buffer and of a view into it are consistent with a copy through them.
+//-----------------------------------------------------------------------------
+auto checkPitches3d()
+-> bool
+{
+    using Dim3 = alpaka::dim::DimInt<3u>;
+
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::stream::StreamCpuSync stream(dev);
+
+    alpaka::Vec<Dim3, Size> const extents(static_cast<Size>(3u), static_cast<Size>(5u), static_cast<Size>(23u));
+    auto buf(alpaka::mem::buf::cpu::allocPitched<std::uint8_t, Size>(dev, extents, 16u));
+
+    auto const rowPitch(alpaka::mem::view::getPitchBytes<2u>(buf));
+    bool correct(
+        (rowPitch == 32u)
+        && (alpaka::mem::view::getPitchBytes<1u>(buf) == rowPitch * 5u)
+        && (alpaka::mem::view::getPitchBytes<0u>(buf) == rowPitch * 5u * 3u));
+
+    // Fill the whole buffer and overwrite an inner block through a view.
+    alpaka::mem::view::set(stream, buf, 1u, extents);
+    alpaka::Vec<Dim3, Size> const viewExtents(static_cast<Size>(2u), static_cast<Size>(3u), static_cast<Size>(7u));
+    alpaka::Vec<Dim3, Size> const viewOffsets(static_cast<Size>(1u), static_cast<Size>(1u), static_cast<Size>(2u));
+    alpaka::mem::view::ViewBasic<alpaka::dev::DevCpu, std::uint8_t, Dim3, Size> view(buf, viewExtents, viewOffsets);
+    alpaka::mem::view::set(stream, view, 2u, viewExtents);
+
+    auto const pMem(alpaka::mem::view::getPtrNative(buf));
+    for(Size z(0u); z < extents[0u]; ++z)
+    {
+        for(Size y(0u); y < extents[1u]; ++y)
+        {
+            for(Size x(0u); x < extents[2u]; ++x)
+            {
+                bool const inView(
+                    (z >= viewOffsets[0u]) && (z < viewOffsets[0u] + viewExtents[0u])
+                    && (y >= viewOffsets[1u]) && (y < viewOffsets[1u] + viewExtents[1u])
+                    && (x >= viewOffsets[2u]) && (x < viewOffsets[2u] + viewExtents[2u]));
+                correct = correct && (pMem[(z * extents[1u] + y) * rowPitch + x] == (inView ? 2u : 1u));
+            }
+        }
+    }
+    return correct;
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                          alpaka buffer pitch benchmark                         " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+        bool correct(checkPitches3d());
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED
+#if ALPAKA_INTEGRATION_TEST
+        std::size_t const bytesPerBuffer(1u << 14u);
+        std::size_t const repetitionCount(3u);
+#else
+        std::size_t const bytesPerBuffer(1u << 17u);
+        std::size_t const repetitionCount(101u);
+#endif
+        std::cout << "y = 2 * x + y row by row with AccCpuSerial, about " << bytesPerBuffer << " bytes per buffer, median over " << repetitionCount << " runs" << std::endl;
+        std::cout << "width height rowAlignment pitch[B] time[ms] speedupOverDense" << std::endl;
+
+        for(Size const width : {Size(23u), Size(79u), Size(1000u), Size(1023u)})
+        {
+            Size const height(std::max(bytesPerBuffer / (width * sizeof(float)), std::size_t(1u)));
+            double msDense(0.0);
+            for(std::size_t const rowAlignmentBytes : {std::size_t(1u), std::size_t(16u), std::size_t(32u), alpaka::mem::buf::cpu::cacheLineBytes})
+            {
+                double ms(0.0);
+                correct = measureRowAxpy(width, height, rowAlignmentBytes, repetitionCount, ms) && correct;
+                if(rowAlignmentBytes == 1u)
+                {
+                    msDense = ms;
+                }
+
+                auto dev(alpaka::dev::cpu::getDev());
+                alpaka::Vec<Dim, Size> const extents(height, width);
+                std::cout
+                    << width
+                    << " " << height
+                    << " " << rowAlignmentBytes
+                    << " " << alpaka::mem::view::getPitchBytes<1u>(alpaka::mem::buf::cpu::allocPitched<float, Size>(dev, extents, rowAlignmentBytes))
+                    << " " << ms
+                    << " " << (msDense / ms)
+                    << std::endl;
+            }
+        }
+#else
+        std::cout << "AccCpuSerial is not enabled." << std::endl;
+#endif
+
+        if(!correct)
+        {
+            std::cerr << "The results are wrong!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,187 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::mem::view::taskCopy
+
+#include <algorithm>                                // std::sort
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <iostream>                                 // std::cout
+#include <limits>                                   // std::numeric_limits
+#include <vector>                                   // std::vector
+
+using Dim = alpaka::dim::DimInt<3u>;
+using Size = std::size_t;
+
+//#############################################################################
+//! A way to configure the copy task.
+//#############################################################################
+struct CopyMode
+{
+    char const * m_name;
+    std::size_t m_maxWorkerCount;
+    std::size_t m_nonTemporalThresholdBytes;
+};
+
+//-----------------------------------------------------------------------------
+//! Copies with the given mode and prints the median bandwidth.
+//!
+//! The destination is a view with the given offsets into a bigger buffer, so the copy has to be done by bytes, slices or rows depending on the shape.
+//!
+//! \return If the copy is correct.
+//-----------------------------------------------------------------------------
+auto measureCopy(
+    char const * const shape,
+    alpaka::Vec<Dim, Size> const & extents,
+    alpaka::Vec<Dim, Size> const & dstBufExtents,
+    alpaka::Vec<Dim, Size> const & dstOffsets,
+    CopyMode const & mode,
+    std::size_t const & repetitionCount)
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::stream::StreamCpuSync stream(dev);
+
+    auto src(alpaka::mem::buf::alloc<std::uint32_t, Size>(dev, extents));
+    auto dstBuf(alpaka::mem::buf::alloc<std::uint32_t, Size>(dev, dstBufExtents));
+    alpaka::mem::view::ViewBasic<alpaka::dev::DevCpu, std::uint32_t, Dim, Size> dst(dstBuf, extents, dstOffsets);
+
+    std::uint32_t * const pSrc(alpaka::mem::view::getPtrNative(src));
+    std::size_t const elemCount(alpaka::extent::getProductOfExtents(extents));
+    for(std::size_t i(0u); i < elemCount; ++i)
+    {
+        pSrc[i] = static_cast<std::uint32_t>(i);
+    }
+    alpaka::mem::view::set(stream, dstBuf, 0u, dstBufExtents);
+
+    auto task(alpaka::mem::view::taskCopy(dst, src, extents));
+    task.setMaxWorkerCount(mode.m_maxWorkerCount);
+    task.setNonTemporalThresholdBytes(mode.m_nonTemporalThresholdBytes);
+
+    std::vector<std::chrono::high_resolution_clock::duration> durations;
+    durations.reserve(repetitionCount);
+    for(std::size_t i(0u); i < repetitionCount; ++i)
+    {
+        auto const tpStart(std::chrono::high_resolution_clock::now());
+        alpaka::stream::enqueue(stream, task);
+        durations.emplace_back(std::chrono::high_resolution_clock::now() - tpStart);
+    }
+    std::sort(durations.begin(), durations.end());
+    double const seconds(std::chrono::duration<double>(durations[durations.size() / 2u]).count());
+
+    std::size_t const copiedBytes(elemCount * sizeof(std::uint32_t));
+    std::cout
+        << shape
+        << " " << mode.m_name
+        << " " << copiedBytes
+        << " " << (seconds * 1.0e3)
+        << " " << (static_cast<double>(copiedBytes) / seconds * 1.0e-9)
+        << std::endl;
+
+    // Every element has to be at its place and the memory around the view has to be untouched.
+    bool correct(true);
+    std::uint32_t const * const pDst(alpaka::mem::view::getPtrNative(dstBuf));
+    for(Size z(0u); z < dstBufExtents[0u]; ++z)
+    {
+        for(Size y(0u); y < dstBufExtents[1u]; ++y)
+        {
+            for(Size x(0u); x < dstBufExtents[2u]; ++x)
+            {
+                bool const inView(
+                    (z >= dstOffsets[0u]) && (z < dstOffsets[0u] + extents[0u])
+                    && (y >= dstOffsets[1u]) && (y < dstOffsets[1u] + extents[1u])
+                    && (x >= dstOffsets[2u]) && (x < dstOffsets[2u] + extents[2u]));
+                std::uint32_t const expected(
+                    inView
+                    ? static_cast<std::uint32_t>(((z - dstOffsets[0u]) * extents[1u] + (y - dstOffsets[1u])) * extents[2u] + (x - dstOffsets[2u]))
+                    : 0u);
+                correct = correct && (pDst[(z * dstBufExtents[1u] + y) * dstBufExtents[2u] + x] == expected);
+            }
+        }
+    }
+    return correct;
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                        alpaka copy bandwidth benchmark                         " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        Size const extent(128u);
+        std::size_t const repetitionCount(3u);
+#else
+        Size const extent(512u);
+        std::size_t const repetitionCount(11u);
+#endif
+        Size const one(1u);
+        Size const zero(0u);
+        alpaka::Vec<Dim, Size> const extents(extent, extent, extent);
+
+        std::size_t const workerCount(std::max(std::thread::hardware_concurrency(), 1u));
+        std::vector<CopyMode> const modes{
+            CopyMode{"singleThread", 1u, std::numeric_limits<std::size_t>::max()},
+            CopyMode{"parallel", workerCount, std::numeric_limits<std::size_t>::max()},
+            CopyMode{"parallelNonTemporal", workerCount, 0u},
+            // More workers than hardware threads are not faster but check the split on every system.
+            CopyMode{"fourWorkersNonTemporal", 4u, 0u},
+            CopyMode{"default", 0u, alpaka::mem::view::cpu::copyNonTemporalThresholdBytes}};
+
+        std::cout << workerCount << " hardware threads, median over " << repetitionCount << " runs" << std::endl;
+        std::cout << "shape mode bytes time[ms] bandwidth[GB/s]" << std::endl;
+
+        bool correct(true);
+        for(CopyMode const & mode : modes)
+        {
+            // A dense copy is done at once.
+            correct = measureCopy("dense", extents, extents, alpaka::Vec<Dim, Size>(zero, zero, zero), mode, repetitionCount) && correct;
+            // A copy into a deeper buffer is done slice by slice.
+            correct = measureCopy("slices", extents, alpaka::Vec<Dim, Size>(extent + one, extent, extent), alpaka::Vec<Dim, Size>(one, zero, zero), mode, repetitionCount) && correct;
+            // A copy into a wider buffer is done row by row.
+            correct = measureCopy("rows", extents, alpaka::Vec<Dim, Size>(extent, extent + one, extent + one), alpaka::Vec<Dim, Size>(zero, one, one), mode, repetitionCount) && correct;
+        }
+
+        if(!correct)
+        {
+            std::cerr << "The results are wrong!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,305 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::wait::wait
+
+#include <atomic>                                   // std::atomic
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <iostream>                                 // std::cout
+#include <memory>                                   // std::unique_ptr
+#include <string>                                   // std::string
+#include <thread>                                   // std::thread, std::this_thread::sleep_for
+#include <vector>                                   // std::vector
+
+using Clock = std::chrono::high_resolution_clock;
+
+//-----------------------------------------------------------------------------
+//! Enqueues one task into each of the streams and waits for all of them repeatedly.
+//! Prints the time of a device wait compared to waiting for every stream on its own.
+//!
+//! \return If every wait has returned after all the tasks waited for had been completed.
+//-----------------------------------------------------------------------------
+auto measureWait(
+    std::size_t const & streamCount,
+    std::size_t const & iterationCount)
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+
+    std::vector<std::unique_ptr<alpaka::stream::StreamCpuAsync>> streams;
+    streams.reserve(streamCount);
+    for(std::size_t i(0u); i < streamCount; ++i)
+    {
+        streams.emplace_back(new alpaka::stream::StreamCpuAsync(dev));
+    }
+
+    std::atomic<std::size_t> tasksCompleted(0u);
+    bool completed(true);
+
+    auto const enqueueAll(
+        [&]()
+        {
+            for(auto && stream : streams)
+            {
+                alpaka::stream::enqueue(
+                    *stream,
+                    [&tasksCompleted]()
+                    {
+                        ++tasksCompleted;
+                    });
+            }
+        });
+
+    auto const tpDevStart(Clock::now());
+    for(std::size_t i(0u); i < iterationCount; ++i)
+    {
+        enqueueAll();
+        alpaka::wait::wait(dev);
+        completed = completed && (tasksCompleted == (i + 1u) * streamCount);
+    }
+    auto const durationDevUs(std::chrono::duration<double, std::micro>(Clock::now() - tpDevStart).count());
+
+    auto const tpStreamsStart(Clock::now());
+    for(std::size_t i(0u); i < iterationCount; ++i)
+    {
+        enqueueAll();
+        for(auto && stream : streams)
+        {
+            alpaka::wait::wait(*stream);
+        }
+    }
+    auto const durationStreamsUs(std::chrono::duration<double, std::micro>(Clock::now() - tpStreamsStart).count());
+
+    // An idle device has to be waited for without touching the streams.
+    auto const tpIdleStart(Clock::now());
+    for(std::size_t i(0u); i < iterationCount; ++i)
+    {
+        alpaka::wait::wait(dev);
+    }
+    auto const durationIdleUs(std::chrono::duration<double, std::micro>(Clock::now() - tpIdleStart).count());
+
+    std::cout
+        << streamCount
+        << " " << (durationDevUs / static_cast<double>(iterationCount))
+        << " " << (durationStreamsUs / static_cast<double>(iterationCount))
+        << " " << (durationIdleUs / static_cast<double>(iterationCount))
+        << std::endl;
+
+    return completed;
+}
+
+//-----------------------------------------------------------------------------
+//! Creates and destroys parallel streams on several threads while another thread keeps waiting for the device.
+//! Every created stream registers itself on the device and unregisters on destruction.
+//! Prints the number of streams created per second.
+//!
+//! \return If every stream has completed its task before it has been destroyed.
+//-----------------------------------------------------------------------------
+auto measureRegistration(
+    std::size_t const & threadCount,
+    std::size_t const & streamCountPerThread)
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+
+    std::atomic<std::size_t> tasksCompleted(0u);
+    std::atomic<bool> creating(true);
+
+    std::thread waiter(
+        [&]()
+        {
+            while(creating)
+            {
+                alpaka::wait::wait(dev);
+            }
+        });
+
+    auto const tpStart(Clock::now());
+    std::vector<std::thread> threads;
+    for(std::size_t t(0u); t < threadCount; ++t)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for(std::size_t i(0u); i < streamCountPerThread; ++i)
+                {
+                    alpaka::stream::StreamCpuParallel stream(dev);
+                    alpaka::stream::enqueue(
+                        stream,
+                        [&tasksCompleted]()
+                        {
+                            ++tasksCompleted;
+                        });
+                    alpaka::wait::wait(stream);
+                }
+            });
+    }
+    for(auto && thread : threads)
+    {
+        thread.join();
+    }
+    auto const durationS(std::chrono::duration<double>(Clock::now() - tpStart).count());
+
+    creating = false;
+    waiter.join();
+
+    std::cout
+        << threadCount
+        << " " << (static_cast<double>(threadCount * streamCountPerThread) / durationS)
+        << std::endl;
+
+    return tasksCompleted == threadCount * streamCountPerThread;
+}
+
+//-----------------------------------------------------------------------------
+//! Waits for the device while another thread keeps the given stream busy and prints the duration of the wait.
+//!
+//! The stream never becomes empty during the wait, so it only returns if it waits for the tasks enqueued before it was called.
+//!
+//! \return If the wait has returned after the task enqueued before it had been completed.
+//-----------------------------------------------------------------------------
+template<
+    typename TStream>
+auto checkWaitWhileSubmitting(
+    std::string const & streamName)
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+    TStream stream(dev);
+
+    std::atomic<bool> submitting(true);
+    std::atomic<std::size_t> tasksSubmitted(0u);
+    std::atomic<std::size_t> tasksCompleted(0u);
+    std::thread submitter(
+        [&stream, &submitting, &tasksSubmitted, &tasksCompleted]()
+        {
+            while(submitting)
+            {
+                // Keep a bounded number of tasks pending, the parallel stream has no queue capacity.
+                if(tasksSubmitted - tasksCompleted >= 64u)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                alpaka::stream::enqueue(
+                    stream,
+                    [&tasksCompleted]()
+                    {
+                        std::this_thread::sleep_for(std::chrono::microseconds(50));
+                        ++tasksCompleted;
+                    });
+                ++tasksSubmitted;
+            }
+        });
+
+    // Let the submitter fill the stream.
+    while(tasksSubmitted < 16u)
+    {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> taskCompleted(false);
+    alpaka::stream::enqueue(
+        stream,
+        [&taskCompleted]()
+        {
+            taskCompleted = true;
+        });
+
+    auto const tpStart(Clock::now());
+    alpaka::wait::wait(dev);
+    auto const durationMs(std::chrono::duration<double, std::milli>(Clock::now() - tpStart).count());
+    bool const completed(taskCompleted);
+
+    submitting = false;
+    submitter.join();
+    alpaka::wait::wait(stream);
+
+    std::cout << streamName << " " << durationMs << std::endl;
+
+    return completed;
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                        alpaka device wait benchmark                            " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        std::size_t const iterationCount(20u);
+        std::size_t const streamCountMax(64u);
+        std::size_t const streamCountPerThread(200u);
+#else
+        std::size_t const iterationCount(1000u);
+        std::size_t const streamCountMax(1024u);
+        std::size_t const streamCountPerThread(10000u);
+#endif
+
+        bool correct(true);
+
+        std::cout << "One task per StreamCpuAsync, " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+        std::cout << "streams deviceWait[us] streamWaits[us] idleDeviceWait[us]" << std::endl;
+        for(std::size_t streamCount(1u); streamCount <= streamCountMax; streamCount *= 4u)
+        {
+            correct = measureWait(streamCount, iterationCount) && correct;
+        }
+
+        std::cout << std::endl;
+        std::cout << "StreamCpuParallel creation and destruction while waiting for the device" << std::endl;
+        std::cout << "threads streams/s" << std::endl;
+        for(std::size_t threadCount(1u); threadCount <= 8u; threadCount *= 2u)
+        {
+            correct = measureRegistration(threadCount, streamCountPerThread) && correct;
+        }
+
+        std::cout << std::endl;
+        std::cout << "Device wait while another thread keeps submitting to a stream" << std::endl;
+        std::cout << "stream deviceWait[ms]" << std::endl;
+        correct = checkWaitWhileSubmitting<alpaka::stream::StreamCpuAsync>("async") && correct;
+        correct = checkWaitWhileSubmitting<alpaka::stream::StreamCpuParallel>("parallel") && correct;
+
+        if(!correct)
+        {
+            std::cerr << "A wait returned before the tasks it waited for had been completed!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
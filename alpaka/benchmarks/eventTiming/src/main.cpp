@@ -0,0 +1,201 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::event::elapsedTime
+#include <alpaka/examples/MeasureKernelRunTime.hpp> // measureKernelRunTimeNs
+
+#include <algorithm>                                // std::sort, std::min, std::all_of
+#include <chrono>                                   // std::chrono::steady_clock
+#include <iostream>                                 // std::cout
+#include <string>                                   // std::string
+#include <vector>                                   // std::vector
+
+using Clock = std::chrono::steady_clock;
+
+//-----------------------------------------------------------------------------
+//! \return The given percentile of the sorted durations in microseconds.
+//-----------------------------------------------------------------------------
+auto percentileUs(
+    std::vector<Clock::duration> const & sortedDurations,
+    double const & percentile)
+-> double
+{
+    auto const idx(
+        std::min(
+            static_cast<std::size_t>(percentile * static_cast<double>(sortedDurations.size())),
+            sortedDurations.size() - 1u));
+    return std::chrono::duration<double, std::micro>(sortedDurations[idx]).count();
+}
+
+//-----------------------------------------------------------------------------
+//! Measures and prints the run times of busy tasks in the given stream.
+//!
+//! * events: Every task is enclosed by two events and the stream is only waited for once at the end.
+//! * drain: Every task is timed on the host by waiting for the stream before and after it like measureKernelRunTimeMs does.
+//! The times are printed as the overhead above the busy time of the task.
+//!
+//! \return If no measured run time is shorter than the busy time of the task.
+//-----------------------------------------------------------------------------
+template<
+    typename TStream>
+auto measureTaskRunTimes(
+    std::string const & streamName,
+    TStream & stream,
+    Clock::duration const & busyDuration,
+    std::size_t const & taskCount)
+-> bool
+{
+    auto const busyTask(
+        [busyDuration]()
+        {
+            auto const tpStart(Clock::now());
+            while(Clock::now() - tpStart < busyDuration)
+            {}
+        });
+
+    auto dev(alpaka::dev::getDev(stream));
+
+    // Warm up.
+    alpaka::stream::enqueue(stream, busyTask);
+    alpaka::wait::wait(stream);
+
+    std::vector<alpaka::event::Event<TStream>> starts;
+    std::vector<alpaka::event::Event<TStream>> stops;
+    starts.reserve(taskCount);
+    stops.reserve(taskCount);
+    for(std::size_t i(0u); i < taskCount; ++i)
+    {
+        starts.emplace_back(dev);
+        stops.emplace_back(dev);
+    }
+
+    auto const tpEventsStart(Clock::now());
+    for(std::size_t i(0u); i < taskCount; ++i)
+    {
+        alpaka::stream::enqueue(stream, starts[i]);
+        alpaka::stream::enqueue(stream, busyTask);
+        alpaka::stream::enqueue(stream, stops[i]);
+    }
+    alpaka::wait::wait(stream);
+    auto const eventsTotalMs(std::chrono::duration<double, std::milli>(Clock::now() - tpEventsStart).count());
+
+    std::vector<Clock::duration> eventDurations;
+    eventDurations.reserve(taskCount);
+    for(std::size_t i(0u); i < taskCount; ++i)
+    {
+        eventDurations.emplace_back(alpaka::event::elapsedTime(starts[i], stops[i]));
+    }
+
+    std::vector<Clock::duration> drainDurations;
+    drainDurations.reserve(taskCount);
+    auto const tpDrainStart(Clock::now());
+    for(std::size_t i(0u); i < taskCount; ++i)
+    {
+        alpaka::wait::wait(stream);
+        auto const tpStart(Clock::now());
+        alpaka::stream::enqueue(stream, busyTask);
+        alpaka::wait::wait(stream);
+        drainDurations.emplace_back(Clock::now() - tpStart);
+    }
+    auto const drainTotalMs(std::chrono::duration<double, std::milli>(Clock::now() - tpDrainStart).count());
+
+    bool const eventsValid(
+        std::all_of(
+            eventDurations.begin(),
+            eventDurations.end(),
+            [busyDuration](Clock::duration const & duration)
+            {
+                return duration >= busyDuration;
+            }));
+
+    std::sort(eventDurations.begin(), eventDurations.end());
+    std::sort(drainDurations.begin(), drainDurations.end());
+
+    auto const busyUs(std::chrono::duration<double, std::micro>(busyDuration).count());
+    std::cout
+        << streamName
+        << " events " << (percentileUs(eventDurations, 0.5) - busyUs)
+        << " " << (percentileUs(eventDurations, 0.99) - busyUs)
+        << " " << eventsTotalMs
+        << std::endl;
+    std::cout
+        << streamName
+        << " drain " << (percentileUs(drainDurations, 0.5) - busyUs)
+        << " " << (percentileUs(drainDurations, 0.99) - busyUs)
+        << " " << drainTotalMs
+        << std::endl;
+
+    // The helper of the examples measures a single task with events.
+    auto const helperNs(alpaka::examples::measureKernelRunTimeNs(stream, busyTask));
+
+    return eventsValid && (std::chrono::nanoseconds(helperNs) >= busyDuration);
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                        alpaka event timing benchmark                           " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        std::size_t const taskCount(200u);
+#else
+        std::size_t const taskCount(5000u);
+#endif
+        Clock::duration const busyDuration(std::chrono::microseconds(20));
+
+        std::cout << "Busy tasks of " << std::chrono::duration<double, std::micro>(busyDuration).count() << " us, " << taskCount << " tasks per row" << std::endl;
+        std::cout << "events: timed by events around every task, drain: timed on the host waiting for the stream around every task" << std::endl;
+        std::cout << "stream timing overheadP50[us] overheadP99[us] total[ms]" << std::endl;
+
+        auto dev(alpaka::dev::cpu::getDev());
+        alpaka::stream::StreamCpuSync streamSync(dev);
+        alpaka::stream::StreamCpuAsync streamAsync(dev);
+
+        bool const syncValid(measureTaskRunTimes("sync", streamSync, busyDuration, taskCount));
+        bool const asyncValid(measureTaskRunTimes("async", streamAsync, busyDuration, taskCount));
+
+        if(!(syncValid && asyncValid))
+        {
+            std::cerr << "An elapsed time between events was shorter than the task between them!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
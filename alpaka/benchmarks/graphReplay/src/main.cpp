@@ -0,0 +1,245 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::exec::create
+
+#include <algorithm>                                // std::sort
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <iostream>                                 // std::cout
+#include <string>                                   // std::string
+#include <vector>                                   // std::vector
+
+//#############################################################################
+//! A kernel incrementing every element of a vector by one.
+//#############################################################################
+class IncrementKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename TElem>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        TElem * const pVec) const
+    -> void
+    {
+        auto const idx(alpaka::idx::getIdx<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+        pVec[idx] += static_cast<TElem>(1);
+    }
+};
+
+using Clock = std::chrono::high_resolution_clock;
+using Dim = alpaka::dim::DimInt<1u>;
+using Size = std::size_t;
+using Acc = alpaka::acc::AccCpuSerial<Dim, Size>;
+using Elem = std::uint32_t;
+
+//#############################################################################
+//! The buffers and the work division used by every iteration.
+//#############################################################################
+struct Iteration
+{
+    //-----------------------------------------------------------------------------
+    //! Constructor.
+    //-----------------------------------------------------------------------------
+    Iteration(
+        alpaka::dev::DevCpu const & dev,
+        Size const & elemCount) :
+            m_extents(elemCount),
+            m_workDiv(m_extents, alpaka::Vec<Dim, Size>(static_cast<Size>(1u))),
+            m_bufAcc(alpaka::mem::buf::alloc<Elem, Size>(dev, m_extents)),
+            m_bufHost(alpaka::mem::buf::alloc<Elem, Size>(dev, m_extents))
+    {}
+
+    //-----------------------------------------------------------------------------
+    //! Enqueues one iteration: a set, three kernels, a copy and three more kernels.
+    //-----------------------------------------------------------------------------
+    template<
+        typename TStream>
+    auto enqueue(
+        TStream & stream)
+    -> void
+    {
+        IncrementKernel kernel;
+        auto const exec(alpaka::exec::create<Acc>(
+            m_workDiv,
+            kernel,
+            alpaka::mem::view::getPtrNative(m_bufAcc)));
+
+        alpaka::mem::view::set(stream, m_bufHost, 0u, m_extents);
+        alpaka::stream::enqueue(stream, exec);
+        alpaka::stream::enqueue(stream, exec);
+        alpaka::stream::enqueue(stream, exec);
+        alpaka::mem::view::copy(stream, m_bufHost, m_bufAcc, m_extents);
+        alpaka::stream::enqueue(stream, exec);
+        alpaka::stream::enqueue(stream, exec);
+        alpaka::stream::enqueue(stream, exec);
+    }
+
+    alpaka::Vec<Dim, Size> const m_extents;
+    alpaka::workdiv::WorkDivMembers<Dim, Size> const m_workDiv;
+    alpaka::mem::buf::Buf<alpaka::dev::DevCpu, Elem, Dim, Size> m_bufAcc;
+    alpaka::mem::buf::Buf<alpaka::dev::DevCpu, Elem, Dim, Size> m_bufHost;
+};
+
+//-----------------------------------------------------------------------------
+//! \return The median of the given durations in microseconds.
+//-----------------------------------------------------------------------------
+auto medianUs(
+    std::vector<Clock::duration> & durations)
+-> double
+{
+    std::sort(durations.begin(), durations.end());
+    return std::chrono::duration<double, std::micro>(durations[durations.size() / 2u]).count();
+}
+
+//-----------------------------------------------------------------------------
+//! Runs the iterations once by enqueuing every task and once by replaying a captured graph.
+//!
+//! \return If both ways computed the expected result.
+//-----------------------------------------------------------------------------
+template<
+    typename TStream>
+auto measure(
+    std::string const & streamName,
+    TStream & stream,
+    Size const & elemCount,
+    std::size_t const & iterationCount)
+-> bool
+{
+    bool resultCorrect(true);
+
+    for(bool const replay : {false, true})
+    {
+        auto dev(alpaka::dev::getDev(stream));
+        Iteration iteration(dev, elemCount);
+        alpaka::mem::view::set(stream, iteration.m_bufAcc, 0u, iteration.m_extents);
+        alpaka::wait::wait(stream);
+
+        alpaka::graph::Graph<TStream> graph;
+        if(replay)
+        {
+            alpaka::graph::beginCapture(stream);
+            iteration.enqueue(stream);
+            graph = alpaka::graph::endCapture(stream);
+        }
+
+        std::vector<Clock::duration> submitDurations;
+        std::vector<Clock::duration> completeDurations;
+        submitDurations.reserve(iterationCount);
+        completeDurations.reserve(iterationCount);
+
+        for(std::size_t i(0u); i < iterationCount; ++i)
+        {
+            auto const tpStart(Clock::now());
+            if(replay)
+            {
+                alpaka::stream::enqueue(stream, graph);
+            }
+            else
+            {
+                iteration.enqueue(stream);
+            }
+            auto const tpSubmitted(Clock::now());
+            alpaka::wait::wait(stream);
+            auto const tpCompleted(Clock::now());
+
+            submitDurations.emplace_back(tpSubmitted - tpStart);
+            completeDurations.emplace_back(tpCompleted - tpStart);
+        }
+
+        // Every iteration increments the accelerator buffer six times and copies it after the third increment.
+        auto const pAcc(alpaka::mem::view::getPtrNative(iteration.m_bufAcc));
+        auto const pHost(alpaka::mem::view::getPtrNative(iteration.m_bufHost));
+        for(Size e(0u); e < elemCount; ++e)
+        {
+            if((pAcc[e] != static_cast<Elem>(6u * iterationCount))
+                || (pHost[e] != static_cast<Elem>(6u * iterationCount - 3u)))
+            {
+                resultCorrect = false;
+            }
+        }
+
+        std::cout
+            << streamName
+            << " " << (replay ? "graph" : "enqueue")
+            << " " << (replay ? 1u : 8u)
+            << " " << medianUs(submitDurations)
+            << " " << medianUs(completeDurations)
+            << std::endl;
+    }
+
+    return resultCorrect;
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                        alpaka graph replay benchmark                           " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        std::size_t const iterationCount(100u);
+#else
+        std::size_t const iterationCount(10000u);
+#endif
+        Size const elemCount(16u);
+
+        std::cout << "Iteration of 1 set, 1 copy and 6 kernels on " << elemCount << " elements with " << alpaka::acc::getAccName<Acc>() << ", " << iterationCount << " iterations, times in us" << std::endl;
+        std::cout << "stream mode enqueues/iteration submitP50 completeP50" << std::endl;
+
+        auto dev(alpaka::dev::cpu::getDev());
+        alpaka::stream::StreamCpuSync streamSync(dev);
+        alpaka::stream::StreamCpuAsync streamAsync(dev);
+
+        bool const syncCorrect(measure("sync", streamSync, elemCount, iterationCount));
+        bool const asyncCorrect(measure("async", streamAsync, elemCount, iterationCount));
+
+        if(!(syncCorrect && asyncCorrect))
+        {
+            std::cerr << "The replayed graph computed a wrong result!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,263 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::mem::buf::cpu::allocHugePages
+
+#include <algorithm>                                // std::sort
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <cstdint>                                  // std::uintptr_t
+#include <fstream>                                  // std::ifstream
+#include <iostream>                                 // std::cout
+#include <stdexcept>                                // std::invalid_argument
+#include <string>                                   // std::string
+#include <vector>                                   // std::vector
+
+using Dim = alpaka::dim::DimInt<3u>;
+using Size = std::size_t;
+using Buf = alpaka::mem::buf::BufCpu<unsigned, Dim, Size>;
+
+//#############################################################################
+//! The memory backing a buffer.
+//#############################################################################
+enum class Backing
+{
+    Heap,
+    TransparentHugePages,
+    ExplicitHugePages
+};
+
+//-----------------------------------------------------------------------------
+//! \return The name of the backing.
+//-----------------------------------------------------------------------------
+auto getName(
+    Backing const & backing)
+-> char const *
+{
+    switch(backing)
+    {
+    case Backing::Heap: return "heap";
+    case Backing::TransparentHugePages: return "transparentHugePages";
+    case Backing::ExplicitHugePages: return "explicitHugePages";
+    }
+    return "unknown";
+}
+
+//-----------------------------------------------------------------------------
+//! \return A new buffer with the given backing.
+//-----------------------------------------------------------------------------
+auto allocBuf(
+    alpaka::dev::DevCpu const & dev,
+    alpaka::Vec<Dim, Size> const & extents,
+    Backing const & backing)
+-> Buf
+{
+    switch(backing)
+    {
+    case Backing::TransparentHugePages:
+        return alpaka::mem::buf::cpu::allocHugePages<unsigned, Size>(dev, extents, alpaka::mem::alloc::HugePages::Transparent);
+    case Backing::ExplicitHugePages:
+        return alpaka::mem::buf::cpu::allocHugePages<unsigned, Size>(dev, extents, alpaka::mem::alloc::HugePages::Explicit);
+    default:
+        return alpaka::mem::buf::alloc<unsigned, Size>(dev, extents);
+    }
+}
+
+//-----------------------------------------------------------------------------
+//! \return The size of the anonymous memory of the process currently backed by transparent huge pages in KiB or 0 if it is unknown.
+//-----------------------------------------------------------------------------
+auto getAnonHugePagesKiB()
+-> std::size_t
+{
+    std::size_t sizeKiB(0u);
+#if BOOST_OS_LINUX
+    std::ifstream smaps("/proc/self/smaps_rollup");
+    for(std::string key; smaps >> key;)
+    {
+        if(key == "AnonHugePages:")
+        {
+            smaps >> sizeKiB;
+            break;
+        }
+    }
+#endif
+    return sizeKiB;
+}
+
+//-----------------------------------------------------------------------------
+//! Measures the first touch and the copy of buffers with the given backing.
+//!
+//! \return If the copy is correct and big buffers backed by huge pages start at a huge page boundary.
+//-----------------------------------------------------------------------------
+auto measureBacking(
+    alpaka::Vec<Dim, Size> const & extents,
+    Backing const & backing,
+    std::size_t const & repetitionCount,
+    double & msFirstTouch,
+    double & msCopy,
+    std::size_t & anonHugePagesKiB)
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::stream::StreamCpuSync stream(dev);
+
+    std::size_t const anonHugePagesKiBBefore(getAnonHugePagesKiB());
+
+    // The first touch of freshly mapped memory includes all the page faults.
+    auto const tpStart(std::chrono::high_resolution_clock::now());
+    Buf src(allocBuf(dev, extents, backing));
+    Buf dst(allocBuf(dev, extents, backing));
+    alpaka::mem::view::set(stream, src, 0x5a, extents);
+    alpaka::mem::view::set(stream, dst, 0u, extents);
+    msFirstTouch = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - tpStart).count();
+
+    std::size_t const anonHugePagesKiBAfter(getAnonHugePagesKiB());
+    anonHugePagesKiB = (anonHugePagesKiBAfter > anonHugePagesKiBBefore) ? (anonHugePagesKiBAfter - anonHugePagesKiBBefore) : 0u;
+
+    std::vector<std::chrono::high_resolution_clock::duration> durations;
+    durations.reserve(repetitionCount);
+    for(std::size_t i(0u); i < repetitionCount; ++i)
+    {
+        auto const tpCopyStart(std::chrono::high_resolution_clock::now());
+        alpaka::mem::view::copy(stream, dst, src, extents);
+        durations.emplace_back(std::chrono::high_resolution_clock::now() - tpCopyStart);
+    }
+    std::sort(durations.begin(), durations.end());
+    msCopy = std::chrono::duration<double, std::milli>(durations[durations.size() / 2u]).count();
+
+    bool correct(true);
+    std::size_t const sizeBytes(alpaka::extent::getProductOfExtents(extents) * sizeof(unsigned));
+    if((backing != Backing::Heap) && (sizeBytes >= alpaka::mem::alloc::cpu::detail::getHugePageSizeBytes()))
+    {
+        correct = (reinterpret_cast<std::uintptr_t>(alpaka::mem::view::getPtrNative(dst)) % alpaka::mem::alloc::cpu::detail::getHugePageSizeBytes()) == 0u;
+    }
+    unsigned const * const pDst(alpaka::mem::view::getPtrNative(dst));
+    for(std::size_t i(0u); i < alpaka::extent::getProductOfExtents(extents); ++i)
+    {
+        correct = correct && (pDst[i] == 0x5a5a5a5au);
+    }
+    return correct;
+}
+
+//-----------------------------------------------------------------------------
+//! \return If the alignments up to the page size are honoured and larger ones are rejected.
+//-----------------------------------------------------------------------------
+auto checkAlignments()
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+    std::size_t const pageSizeBytes(alpaka::mem::alloc::cpu::detail::getPageSizeBytes());
+
+    // Rows aligned to pages.
+    alpaka::Vec<alpaka::dim::DimInt<2u>, Size> const extents(static_cast<Size>(3u), static_cast<Size>(5u));
+    auto buf(
+        alpaka::mem::buf::cpu::allocHugePages<double, Size>(
+            dev,
+            extents,
+            alpaka::mem::alloc::HugePages::Transparent,
+            pageSizeBytes,
+            pageSizeBytes));
+    bool correct(
+        (alpaka::mem::view::getPitchBytes<1u>(buf) == pageSizeBytes)
+        && ((reinterpret_cast<std::uintptr_t>(alpaka::mem::view::getPtrNative(buf)) % pageSizeBytes) == 0u));
+
+    // Small alignments.
+    for(std::size_t const alignmentBytes : {std::size_t(1u), std::size_t(8u), std::size_t(256u)})
+    {
+        auto small(alpaka::mem::buf::cpu::allocHugePages<char, Size>(dev, Size(1u), alpaka::mem::alloc::HugePages::Explicit, alignmentBytes));
+        correct = correct && ((reinterpret_cast<std::uintptr_t>(alpaka::mem::view::getPtrNative(small)) % alignmentBytes) == 0u);
+    }
+
+    // Alignments beyond the page size are rejected.
+    try
+    {
+        alpaka::mem::alloc::AllocCpuHugePages const alloc(alpaka::mem::alloc::HugePages::Transparent, 2u * pageSizeBytes);
+        correct = false;
+    }
+    catch(std::invalid_argument const &)
+    {
+    }
+    return correct;
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                          alpaka huge page benchmark                            " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+        bool correct(checkAlignments());
+
+#if ALPAKA_INTEGRATION_TEST
+        Size const extent(96u);
+        std::size_t const repetitionCount(3u);
+#else
+        Size const extent(320u);
+        std::size_t const repetitionCount(11u);
+#endif
+        alpaka::Vec<Dim, Size> const extents(extent, extent, extent);
+        std::size_t const sizeBytes(alpaka::extent::getProductOfExtents(extents) * sizeof(unsigned));
+
+        std::cout << "Two " << extent << "^3 unsigned buffers of " << sizeBytes << " bytes, huge page size " << alpaka::mem::alloc::cpu::detail::getHugePageSizeBytes() << " bytes, median copy over " << repetitionCount << " runs" << std::endl;
+        std::cout << "backing firstTouch[ms] copy[ms] copy[GB/s] anonHugePages[KiB]" << std::endl;
+
+        for(Backing const backing : {Backing::Heap, Backing::TransparentHugePages, Backing::ExplicitHugePages})
+        {
+            double msFirstTouch(0.0);
+            double msCopy(0.0);
+            std::size_t anonHugePagesKiB(0u);
+            correct = measureBacking(extents, backing, repetitionCount, msFirstTouch, msCopy, anonHugePagesKiB) && correct;
+
+            std::cout
+                << getName(backing)
+                << " " << msFirstTouch
+                << " " << msCopy
+                // A copy reads and writes every byte.
+                << " " << (2.0 * static_cast<double>(sizeBytes) / (msCopy * 1.0e6))
+                << " " << anonHugePagesKiB
+                << std::endl;
+        }
+
+        if(!correct)
+        {
+            std::cerr << "The results are wrong!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,422 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::exec::create
+#include <alpaka/examples/accs/EnabledAccs.hpp>     // EnabledAccs
+
+#include <algorithm>                                // std::sort, std::min
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <functional>                               // std::function
+#include <iostream>                                 // std::cout
+#include <string>                                   // std::string
+#include <thread>                                   // std::thread
+#include <type_traits>                              // std::is_same, std::integral_constant
+#include <vector>                                   // std::vector
+
+//#############################################################################
+//! A kernel doing nothing.
+//! It is used to measure the pure launch overhead of the executors and streams.
+//#############################################################################
+class EmptyKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc) const
+    -> void
+    {
+        boost::ignore_unused(acc);
+    }
+};
+
+using Clock = std::chrono::high_resolution_clock;
+
+//-----------------------------------------------------------------------------
+//! \return The given percentile of the sorted durations in microseconds.
+//-----------------------------------------------------------------------------
+auto percentileUs(
+    std::vector<Clock::duration> const & sortedDurations,
+    double const & percentile)
+-> double
+{
+    auto const idx(
+        std::min(
+            static_cast<std::size_t>(percentile * static_cast<double>(sortedDurations.size())),
+            sortedDurations.size() - 1u));
+    return std::chrono::duration<double, std::micro>(sortedDurations[idx]).count();
+}
+
+//-----------------------------------------------------------------------------
+//! \return The median duration of creating a thread pool, running one task per worker and destroying the pool again.
+//! This is the overhead every AccCpuThreads launch had to pay before the device owned a persistent pool.
+//-----------------------------------------------------------------------------
+auto measureThreadPoolCreationUs(
+    std::size_t const & blockThreadCount,
+    std::size_t const & launchCount)
+-> double
+{
+    struct ThreadPoolYield
+    {
+        static auto yield()
+        -> void
+        {
+            std::this_thread::yield();
+        }
+    };
+    using ThreadPool = alpaka::core::detail::ConcurrentExecPool<
+        std::size_t,
+        std::thread,
+        std::promise,
+        ThreadPoolYield>;
+
+    std::vector<Clock::duration> durations;
+    durations.reserve(launchCount);
+    for(std::size_t i(0u); i < launchCount; ++i)
+    {
+        auto const tpStart(Clock::now());
+        {
+            ThreadPool threadPool(blockThreadCount, blockThreadCount);
+            std::vector<std::future<void>> futures;
+            for(std::size_t t(0u); t < blockThreadCount; ++t)
+            {
+                futures.emplace_back(threadPool.enqueueTask([](){}));
+            }
+            for(auto && future : futures)
+            {
+                future.wait();
+            }
+        }
+        durations.emplace_back(Clock::now() - tpStart);
+    }
+
+    std::sort(durations.begin(), durations.end());
+    return percentileUs(durations, 0.5);
+}
+
+//-----------------------------------------------------------------------------
+//! Measures and prints the launch costs of the given executor in the given stream.
+//!
+//! Every launch is timed three times:
+//! * enqueue: The return of stream::enqueue. For a synchronous stream this already includes the execution.
+//! * complete: The return of wait::wait on the stream after the enqueue (launch-to-completion).
+//! * direct: Invoking the executor without any stream. This is the pure execution cost of the executor.
+//! The difference between complete and direct is the cost of the stream.
+//! The launches per second are measured separately by enqueuing all launches back-to-back and waiting once at the end.
+//! They are measured once with single enqueues, once with batches of four launches and once with batches of batchSize launches.
+//-----------------------------------------------------------------------------
+template<
+    typename TStream,
+    typename TExec>
+auto measureLaunches(
+    std::string const & streamName,
+    TStream & stream,
+    TExec const & exec,
+    std::size_t const & launchCount)
+-> void
+{
+    // Warm up. The first launch creates the device thread pools.
+    alpaka::stream::enqueue(stream, exec);
+    alpaka::wait::wait(stream);
+
+    std::vector<Clock::duration> enqueueDurations;
+    std::vector<Clock::duration> completeDurations;
+    std::vector<Clock::duration> directDurations;
+    enqueueDurations.reserve(launchCount);
+    completeDurations.reserve(launchCount);
+    directDurations.reserve(launchCount);
+
+    for(std::size_t i(0u); i < launchCount; ++i)
+    {
+        auto const tpStart(Clock::now());
+        alpaka::stream::enqueue(stream, exec);
+        auto const tpEnqueued(Clock::now());
+        alpaka::wait::wait(stream);
+        auto const tpCompleted(Clock::now());
+
+        enqueueDurations.emplace_back(tpEnqueued - tpStart);
+        completeDurations.emplace_back(tpCompleted - tpStart);
+    }
+
+    for(std::size_t i(0u); i < launchCount; ++i)
+    {
+        auto const tpStart(Clock::now());
+        exec();
+        directDurations.emplace_back(Clock::now() - tpStart);
+    }
+
+    auto const tpThroughputStart(Clock::now());
+    for(std::size_t i(0u); i < launchCount; ++i)
+    {
+        alpaka::stream::enqueue(stream, exec);
+    }
+    alpaka::wait::wait(stream);
+    auto const throughputS(std::chrono::duration<double>(Clock::now() - tpThroughputStart).count());
+
+    std::size_t const batch4Count(launchCount / 4u);
+    auto const tpBatch4Start(Clock::now());
+    for(std::size_t i(0u); i < batch4Count; ++i)
+    {
+        alpaka::stream::enqueueBatch(stream, exec, exec, exec, exec);
+    }
+    alpaka::wait::wait(stream);
+    auto const batch4S(std::chrono::duration<double>(Clock::now() - tpBatch4Start).count());
+
+    std::size_t const batchSize(20u);
+    std::size_t const batchCount(launchCount / batchSize);
+    std::vector<TExec> const vExecs(batchSize, exec);
+    auto const tpBatchStart(Clock::now());
+    for(std::size_t i(0u); i < batchCount; ++i)
+    {
+        alpaka::stream::enqueueBatchRange(stream, vExecs.begin(), vExecs.end());
+    }
+    alpaka::wait::wait(stream);
+    auto const batchS(std::chrono::duration<double>(Clock::now() - tpBatchStart).count());
+
+    std::sort(enqueueDurations.begin(), enqueueDurations.end());
+    std::sort(completeDurations.begin(), completeDurations.end());
+    std::sort(directDurations.begin(), directDurations.end());
+
+    std::cout
+        << " " << streamName
+        << " " << percentileUs(enqueueDurations, 0.5)
+        << " " << percentileUs(enqueueDurations, 0.99)
+        << " " << percentileUs(completeDurations, 0.5)
+        << " " << percentileUs(completeDurations, 0.99)
+        << " " << percentileUs(directDurations, 0.5)
+        << " " << percentileUs(directDurations, 0.99)
+        << " " << (static_cast<double>(launchCount) / throughputS)
+        << " " << (static_cast<double>(4u * batch4Count) / batch4S)
+        << " " << (static_cast<double>(batchSize * batchCount) / batchS);
+}
+
+//-----------------------------------------------------------------------------
+//! \return If the tasks of batches enqueued into the given stream are executed in order.
+//-----------------------------------------------------------------------------
+template<
+    typename TStream>
+auto checkBatchOrder(
+    TStream & stream)
+-> bool
+{
+    std::vector<std::size_t> order;
+    auto const record(
+        [&order](std::size_t const & i)
+        {
+            return
+                [&order, i]()
+                {
+                    order.push_back(i);
+                };
+        });
+
+    alpaka::stream::enqueueBatch(stream, record(0u), record(1u), record(2u));
+    std::vector<std::function<void()>> vTasks;
+    for(std::size_t i(3u); i < 23u; ++i)
+    {
+        vTasks.emplace_back(record(i));
+    }
+    alpaka::stream::enqueueBatchRange(stream, vTasks.begin(), vTasks.end());
+    alpaka::wait::wait(stream);
+
+    for(std::size_t i(0u); i < 23u; ++i)
+    {
+        if((order.size() <= i) || (order[i] != i))
+        {
+            return false;
+        }
+    }
+    return order.size() == 23u;
+}
+
+//#############################################################################
+//! Measures the launch latencies of an accelerator for all grid and block shapes it supports.
+//#############################################################################
+struct LaunchLatencyBenchmark
+{
+    //-----------------------------------------------------------------------------
+    //! Benchmarks the accelerator.
+    //-----------------------------------------------------------------------------
+    template<
+        typename TAcc>
+    auto operator()(
+        std::size_t const & launchCount)
+    -> void
+    {
+        // Only the CPU accelerators can be used with the CPU streams.
+        benchmark<TAcc>(
+            launchCount,
+            std::integral_constant<
+                bool,
+                std::is_same<alpaka::dev::Dev<TAcc>, alpaka::dev::DevCpu>::value>());
+    }
+
+private:
+    //-----------------------------------------------------------------------------
+    //!
+    //-----------------------------------------------------------------------------
+    template<
+        typename TAcc>
+    auto benchmark(
+        std::size_t const & launchCount,
+        std::true_type const &)
+    -> void
+    {
+        using Size = alpaka::size::Size<TAcc>;
+
+        auto dev(alpaka::dev::cpu::getDev());
+        alpaka::stream::StreamCpuSync streamSync(dev);
+        alpaka::stream::StreamCpuAsync streamAsync(dev);
+
+        auto const accDevProps(alpaka::acc::getAccDevProps<TAcc>(dev));
+
+#if ALPAKA_INTEGRATION_TEST
+        Size const gridBlockCountMax(16u);
+        Size const blockThreadCountMax(4u);
+#else
+        Size const gridBlockCountMax(1024u);
+        Size const blockThreadCountMax(64u);
+#endif
+        for(Size gridBlockCount(1u); gridBlockCount <= gridBlockCountMax; gridBlockCount *= 16u)
+        {
+            for(Size blockThreadCount(1u); blockThreadCount <= blockThreadCountMax; blockThreadCount *= 4u)
+            {
+                if((blockThreadCount > accDevProps.m_blockThreadsCountMax)
+                    || (blockThreadCount > accDevProps.m_blockThreadExtentsMax[0u]))
+                {
+                    break;
+                }
+
+                alpaka::Vec<alpaka::dim::DimInt<1u>, Size> const gridBlockExtents(gridBlockCount);
+                alpaka::Vec<alpaka::dim::DimInt<1u>, Size> const blockThreadExtents(blockThreadCount);
+                alpaka::workdiv::WorkDivMembers<alpaka::dim::DimInt<1u>, Size> const workDiv(
+                    gridBlockExtents,
+                    blockThreadExtents);
+
+                EmptyKernel kernel;
+                auto const exec(alpaka::exec::create<TAcc>(
+                    workDiv,
+                    kernel));
+
+                std::cout << alpaka::acc::getAccName<TAcc>() << " " << gridBlockCount << " " << blockThreadCount;
+                measureLaunches("sync", streamSync, exec, launchCount);
+                std::cout << std::endl;
+
+                std::cout << alpaka::acc::getAccName<TAcc>() << " " << gridBlockCount << " " << blockThreadCount;
+                measureLaunches("async", streamAsync, exec, launchCount);
+                std::cout << std::endl;
+            }
+        }
+    }
+    //-----------------------------------------------------------------------------
+    //!
+    //-----------------------------------------------------------------------------
+    template<
+        typename TAcc>
+    auto benchmark(
+        std::size_t const &,
+        std::false_type const &)
+    -> void
+    {}
+};
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                        alpaka launch latency benchmark                         " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+        // Logs the enabled accelerators.
+        alpaka::examples::accs::writeEnabledAccs<alpaka::dim::DimInt<1u>, std::size_t>(std::cout);
+
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        std::size_t const launchCount(100u);
+#else
+        std::size_t const launchCount(2000u);
+#endif
+
+        std::cout << "Empty kernel, " << launchCount << " launches per row, all times in us." << std::endl;
+        std::cout << "enqueue: return of stream::enqueue, complete: launch-to-completion, direct: executor invoked without a stream" << std::endl;
+        std::cout << "batch4/batch20: launches enqueued with stream::enqueueBatch in batches of 4 and with stream::enqueueBatchRange in batches of 20" << std::endl;
+        std::cout << "accelerator gridBlocks blockThreads stream enqueueP50 enqueueP99 completeP50 completeP99 directP50 directP99 launches/s batch4Launches/s batch20Launches/s" << std::endl;
+
+        LaunchLatencyBenchmark launchLatencyBenchmark;
+
+        // Execute the benchmark on all enabled accelerators.
+        alpaka::core::forEachType<
+            alpaka::examples::accs::EnabledAccs<alpaka::dim::DimInt<1u>, std::size_t>>(
+                launchLatencyBenchmark,
+                launchCount);
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_SIMD_ENABLED
+        // AccCpuSimd is not part of the enabled accelerator list because it can not sync blocks with more than one thread but the empty kernel never syncs.
+        launchLatencyBenchmark.template operator()<alpaka::acc::AccCpuSimd<alpaka::dim::DimInt<1u>, std::size_t>>(
+            launchCount);
+#endif
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED
+        // For reference: the cost of creating a thread pool per launch as AccCpuThreads did before it used the device thread pool.
+        std::cout << std::endl;
+        std::cout << "blockThreads poolCreationP50[us]" << std::endl;
+        for(std::size_t blockThreadCount(1u); blockThreadCount <= 16u; blockThreadCount *= 4u)
+        {
+            std::cout
+                << blockThreadCount
+                << " " << measureThreadPoolCreationUs(blockThreadCount, launchCount / 10u)
+                << std::endl;
+        }
+#endif
+
+        auto dev(alpaka::dev::cpu::getDev());
+        alpaka::stream::StreamCpuSync streamSync(dev);
+        alpaka::stream::StreamCpuAsync streamAsync(dev);
+        alpaka::stream::StreamCpuParallel streamParallel(dev);
+        if(!checkBatchOrder(streamSync) || !checkBatchOrder(streamAsync) || !checkBatchOrder(streamParallel))
+        {
+            std::cerr << "The tasks of a batch have not been executed in order!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
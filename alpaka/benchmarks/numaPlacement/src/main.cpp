@@ -0,0 +1,248 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::mem::buf::cpu::allocNuma
+
+#include <algorithm>                                // std::sort
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <iostream>                                 // std::cout
+#include <numeric>                                  // std::accumulate
+#include <vector>                                   // std::vector
+
+using Dim = alpaka::dim::DimInt<2u>;
+using Size = std::size_t;
+using Buf = alpaka::mem::buf::BufCpu<float, Dim, Size>;
+
+//#############################################################################
+//! A kernel incrementing the row at its grid block index.
+//#############################################################################
+class RowIncrementKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        float * const pMem,
+        Size const & width,
+        Size const & pitchElems) const
+    -> void
+    {
+        auto const row(alpaka::idx::getIdx<alpaka::Grid, alpaka::Blocks>(acc)[0u]);
+
+        float * const pRow(pMem + row * pitchElems);
+        for(Size i(0u); i < width; ++i)
+        {
+            pRow[i] += 1.0f;
+        }
+    }
+};
+
+//#############################################################################
+//! The ways the benchmark creates a buffer.
+//#############################################################################
+enum class Creation
+{
+    SingleThreadSet,
+    ParallelFirstTouch,
+    Interleave
+};
+
+//-----------------------------------------------------------------------------
+//! \return The name of the creation.
+//-----------------------------------------------------------------------------
+auto getName(
+    Creation const & creation)
+-> char const *
+{
+    switch(creation)
+    {
+    case Creation::SingleThreadSet: return "singleThreadSet";
+    case Creation::ParallelFirstTouch: return "parallelFirstTouch";
+    case Creation::Interleave: return "interleave";
+    }
+    return "unknown";
+}
+
+//-----------------------------------------------------------------------------
+//! \return A new buffer created in the given way.
+//-----------------------------------------------------------------------------
+auto createBuf(
+    alpaka::dev::DevCpu & dev,
+    alpaka::Vec<Dim, Size> const & extents,
+    Creation const & creation)
+-> Buf
+{
+    switch(creation)
+    {
+    case Creation::ParallelFirstTouch:
+        return alpaka::mem::buf::cpu::allocNuma<float, Size>(dev, extents);
+    case Creation::Interleave:
+        return alpaka::mem::buf::cpu::allocNuma<float, Size>(dev, extents, alpaka::dev::cpu::NumaPolicy::Interleave);
+    default:
+        {
+            // The usual way: a single thread touches all pages.
+            alpaka::stream::StreamCpuSync stream(dev);
+            auto buf(alpaka::mem::buf::alloc<float, Size>(dev, extents));
+            alpaka::mem::view::set(stream, buf, 0u, extents);
+            return buf;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+//! Creates a buffer, runs the row kernel over it and prints the placement and the times.
+//!
+//! \return If all pages have been placed and the kernel results are correct.
+//-----------------------------------------------------------------------------
+auto measureCreation(
+    alpaka::Vec<Dim, Size> const & extents,
+    Creation const & creation,
+    std::size_t const & repetitionCount)
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::stream::StreamCpuSync stream(dev);
+
+    auto const tpStart(std::chrono::high_resolution_clock::now());
+    Buf buf(createBuf(dev, extents, creation));
+    double const msCreate(std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - tpStart).count());
+
+    // The kernels start from zero.
+    alpaka::mem::view::set(stream, buf, 0u, extents);
+    auto const pitchElems(alpaka::mem::view::getPitchBytes<1u>(buf) / sizeof(float));
+
+    double msKernel(0.0);
+#ifdef ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLED
+    using Acc = alpaka::acc::AccCpuThreadsBlocks<alpaka::dim::DimInt<1u>, Size>;
+
+    // One block per row with the same static schedule as the first touch.
+    alpaka::Vec<alpaka::dim::DimInt<1u>, Size> const gridBlockExtents(extents[0u]);
+    alpaka::Vec<alpaka::dim::DimInt<1u>, Size> const blockThreadExtents(static_cast<Size>(1u));
+    alpaka::workdiv::WorkDivMembers<alpaka::dim::DimInt<1u>, Size> const workDiv(
+        gridBlockExtents,
+        blockThreadExtents);
+    auto exec(alpaka::exec::create<Acc>(
+        workDiv,
+        RowIncrementKernel(),
+        alpaka::mem::view::getPtrNative(buf),
+        extents[1u],
+        pitchElems));
+    exec.setSchedule(alpaka::exec::Schedule(alpaka::exec::ScheduleKind::Static));
+
+    std::vector<std::chrono::high_resolution_clock::duration> durations;
+    durations.reserve(repetitionCount);
+    for(std::size_t i(0u); i < repetitionCount; ++i)
+    {
+        auto const tpKernelStart(std::chrono::high_resolution_clock::now());
+        alpaka::stream::enqueue(stream, exec);
+        durations.emplace_back(std::chrono::high_resolution_clock::now() - tpKernelStart);
+    }
+    std::sort(durations.begin(), durations.end());
+    msKernel = std::chrono::duration<double, std::milli>(durations[durations.size() / 2u]).count();
+    float const expected(static_cast<float>(repetitionCount));
+#else
+    float const expected(0.0f);
+#endif
+
+    bool correct(true);
+    float const * const pMem(alpaka::mem::view::getPtrNative(buf));
+    for(Size row(0u); row < extents[0u]; ++row)
+    {
+        for(Size i(0u); i < extents[1u]; ++i)
+        {
+            correct = correct && (pMem[row * pitchElems + i] == expected);
+        }
+    }
+
+    std::cout << getName(creation) << " " << msCreate << " " << msKernel;
+    if(creation != Creation::SingleThreadSet)
+    {
+        // All pages have been touched before the buffer was returned.
+        auto const pageCounts(alpaka::mem::buf::cpu::getPageNodeCounts(buf));
+        std::size_t const pageSizeBytes(alpaka::mem::alloc::cpu::detail::getPageSizeBytes());
+        std::size_t const pageCount((extents[0u] * pitchElems * sizeof(float) + pageSizeBytes - 1u) / pageSizeBytes);
+        correct = correct && (pageCounts.empty() || (std::accumulate(pageCounts.begin(), pageCounts.end(), std::size_t(0u)) == pageCount));
+        for(std::size_t const nodePageCount : pageCounts)
+        {
+            std::cout << " " << nodePageCount;
+        }
+    }
+    std::cout << std::endl;
+    return correct;
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                        alpaka NUMA placement benchmark                         " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        alpaka::Vec<Dim, Size> const extents(static_cast<Size>(256u), static_cast<Size>(1000u));
+        std::size_t const repetitionCount(3u);
+#else
+        alpaka::Vec<Dim, Size> const extents(static_cast<Size>(8192u), static_cast<Size>(8192u));
+        std::size_t const repetitionCount(11u);
+#endif
+
+        std::cout << "A " << extents[0u] << "x" << extents[1u] << " float buffer on " << alpaka::dev::cpu::detail::getNumaNodeMask() << " (node mask)" << std::endl;
+#ifndef ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLED
+        std::cout << "AccCpuThreadsBlocks is not enabled, the kernel is not run." << std::endl;
+#endif
+        std::cout << "creation create[ms] rowKernel[ms] pagesPerNode" << std::endl;
+
+        bool correct(true);
+        for(Creation const creation : {Creation::SingleThreadSet, Creation::ParallelFirstTouch, Creation::Interleave})
+        {
+            correct = measureCreation(extents, creation, repetitionCount) && correct;
+        }
+
+        if(!correct)
+        {
+            std::cerr << "The results are wrong!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
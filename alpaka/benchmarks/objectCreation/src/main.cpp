@@ -0,0 +1,212 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::event::EventCpu, alpaka::stream::StreamCpuAsync, alpaka::stream::StreamCpuSync
+
+#include <boost/uuid/uuid.hpp>                      // boost::uuids::uuid
+#include <boost/uuid/uuid_generators.hpp>           // boost::uuids::random_generator
+
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <future>                                   // std::promise, std::shared_future
+#include <iostream>                                 // std::cout
+#include <string>                                   // std::string
+
+using Clock = std::chrono::high_resolution_clock;
+
+//-----------------------------------------------------------------------------
+//! Calls the function the given number of times and prints the calls per second.
+//-----------------------------------------------------------------------------
+template<
+    typename TFnObj>
+auto measureThroughput(
+    std::string const & name,
+    std::size_t const & count,
+    TFnObj const & f)
+-> void
+{
+    // Warm up. This fills the recycling pools of the device.
+    f();
+
+    auto const tpStart(Clock::now());
+    for(std::size_t i(0u); i < count; ++i)
+    {
+        f();
+    }
+    auto const durationS(std::chrono::duration<double>(Clock::now() - tpStart).count());
+
+    std::cout
+        << name
+        << " " << count
+        << " " << (1.0e6 * durationS / static_cast<double>(count))
+        << " " << (static_cast<double>(count) / durationS)
+        << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+//! Waits for an event that has never been enqueued with a synchronous stream, destroys it and re-enqueues the recycled event while it is pending.
+//!
+//! A stale waited-for state of the recycled event would make it drop the second enqueue and complete at the first position.
+//!
+//! \return If the recycled event completed at the position of its last enqueue.
+//-----------------------------------------------------------------------------
+auto checkEventRecycledAfterSyncWait(
+    alpaka::dev::DevCpu & dev)
+-> bool
+{
+    {
+        alpaka::stream::StreamCpuSync streamSync(dev);
+        alpaka::event::EventCpu const event(dev);
+        alpaka::wait::wait(streamSync, event);
+    }
+
+    // The recycling pool hands out the implementation of the event destroyed last.
+    alpaka::event::EventCpu event(dev);
+    alpaka::event::EventCpu eventBetween(dev);
+    alpaka::stream::StreamCpuAsync stream(dev);
+
+    std::promise<void> promise0;
+    std::promise<void> promise1;
+    std::shared_future<void> const future0(promise0.get_future().share());
+    std::shared_future<void> const future1(promise1.get_future().share());
+
+    alpaka::stream::enqueue(stream, [future0](){future0.wait();});
+    alpaka::stream::enqueue(stream, event);
+    alpaka::stream::enqueue(stream, eventBetween);
+    alpaka::stream::enqueue(stream, [future1](){future1.wait();});
+    alpaka::stream::enqueue(stream, event);
+
+    promise0.set_value();
+    alpaka::wait::wait(eventBetween);
+    bool const completedAtLastEnqueue(!alpaka::event::test(event));
+
+    promise1.set_value();
+    alpaka::wait::wait(stream);
+
+    return completedAtLastEnqueue && alpaka::event::test(event);
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                       alpaka object creation benchmark                         " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        std::size_t const count(1000u);
+#else
+        std::size_t const count(100000u);
+#endif
+
+        auto dev(alpaka::dev::cpu::getDev());
+        alpaka::stream::StreamCpuAsync streamAsync(dev);
+
+        std::cout << "Create and destroy throughput, the events and asynchronous streams are recycled by the device" << std::endl;
+        std::cout << "object count time/object[us] objects/s" << std::endl;
+
+        // For reference: the cost of the random UUID every stream and event used to generate on construction.
+        measureThroughput(
+            "uuid",
+            count,
+            []()
+            {
+                boost::uuids::uuid const uuid = boost::uuids::random_generator()();
+                boost::ignore_unused(uuid);
+            });
+
+        measureThroughput(
+            "event",
+            count,
+            [&dev]()
+            {
+                alpaka::event::EventCpu event(dev);
+                boost::ignore_unused(event);
+            });
+
+        bool recycledEventsReady(true);
+        measureThroughput(
+            "eventEnqueueWait",
+            count,
+            [&dev, &streamAsync, &recycledEventsReady]()
+            {
+                alpaka::event::EventCpu event(dev);
+                recycledEventsReady = alpaka::event::test(event) && recycledEventsReady;
+                alpaka::stream::enqueue(streamAsync, event);
+                alpaka::wait::wait(event);
+            });
+
+        bool recycledStreamsEmpty(true);
+        measureThroughput(
+            "streamAsync",
+            count,
+            [&dev, &recycledStreamsEmpty]()
+            {
+                alpaka::stream::StreamCpuAsync stream(dev);
+                recycledStreamsEmpty = alpaka::stream::empty(stream) && recycledStreamsEmpty;
+            });
+
+        measureThroughput(
+            "streamAsyncEnqueueWait",
+            count,
+            [&dev]()
+            {
+                alpaka::stream::StreamCpuAsync stream(dev);
+                alpaka::stream::enqueue(stream, [](){});
+                alpaka::wait::wait(stream);
+            });
+
+        // Different streams and events have to compare unequal even if one of them reuses the implementation of a destroyed one.
+        bool idsUnique(true);
+        {
+            alpaka::event::EventCpu const event0(dev);
+            alpaka::event::EventCpu const event1(dev);
+            alpaka::stream::StreamCpuAsync const stream0(dev);
+            alpaka::stream::StreamCpuAsync const stream1(dev);
+            idsUnique = (event0 != event1) && (stream0 != stream1) && (stream0 != streamAsync);
+        }
+
+        bool const recycledAfterSyncWait(checkEventRecycledAfterSyncWait(dev));
+
+        if(!recycledEventsReady || !recycledStreamsEmpty || !idsUnique || !recycledAfterSyncWait)
+        {
+            std::cerr << "A recycled event or stream was not reset to its initial state!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
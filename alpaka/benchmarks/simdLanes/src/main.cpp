@@ -0,0 +1,298 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::exec::create
+
+#include <algorithm>                                // std::sort
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <iostream>                                 // std::cout
+#include <stdexcept>                                // std::logic_error
+#include <vector>                                   // std::vector
+
+//#############################################################################
+//! A kernel written for the GPU thread model.
+//! Every thread scales and adds the elements at its grid thread index with a grid-stride loop.
+//#############################################################################
+class AxpyKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename TElem>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::size_t const & numElements,
+        TElem const & alpha,
+        TElem const * const pX,
+        TElem * const pY) const
+    -> void
+    {
+        auto const gridThreadIdx(alpaka::idx::getIdx<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+        auto const gridThreadExtent(alpaka::workdiv::getWorkDiv<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+
+        for(std::size_t i(gridThreadIdx); i < numElements; i += gridThreadExtent)
+        {
+            pY[i] = alpha * pX[i] + pY[i];
+        }
+    }
+};
+
+//#############################################################################
+//! A kernel counting the threads of its block in a block shared variable.
+//! Every thread writes the count it has seen, so the counts are only consecutive if all threads of a block share the variable.
+//#############################################################################
+class BlockSharedCountKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::size_t * const pCounts) const
+    -> void
+    {
+        auto & count(alpaka::block::shared::allocVar<std::size_t>(acc));
+        auto const blockThreadIdx(alpaka::idx::getIdx<alpaka::Block, alpaka::Threads>(acc)[0u]);
+        // The lanes run in order, so the first one initializes the variable before the others use it.
+        if(blockThreadIdx == 0u)
+        {
+            count = 0u;
+        }
+        ++count;
+        pCounts[alpaka::idx::getIdx<alpaka::Grid, alpaka::Threads>(acc)[0u]] = count;
+    }
+};
+
+//#############################################################################
+//! A kernel synchronizing the threads of its block.
+//#############################################################################
+class SyncKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc) const
+    -> void
+    {
+        alpaka::block::sync::syncBlockThreads(acc);
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! \return The median run time in milliseconds of the kernel on the given accelerator with the given number of threads per block.
+//! The grid contains one thread per element.
+//-----------------------------------------------------------------------------
+template<
+    typename TAcc>
+auto measureAxpyMs(
+    std::size_t const & blockThreadCount,
+    std::vector<float> const & x,
+    std::vector<float> & y,
+    std::size_t const & repetitionCount)
+-> double
+{
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::stream::StreamCpuSync stream(dev);
+
+    alpaka::Vec<alpaka::dim::DimInt<1u>, std::size_t> const gridBlockExtents(x.size() / blockThreadCount);
+    alpaka::Vec<alpaka::dim::DimInt<1u>, std::size_t> const blockThreadExtents(blockThreadCount);
+    alpaka::workdiv::WorkDivMembers<alpaka::dim::DimInt<1u>, std::size_t> const workDiv(
+        gridBlockExtents,
+        blockThreadExtents);
+
+    AxpyKernel kernel;
+    auto const exec(alpaka::exec::create<TAcc>(
+        workDiv,
+        kernel,
+        x.size(),
+        2.0f,
+        x.data(),
+        y.data()));
+
+    std::vector<std::chrono::high_resolution_clock::duration> durations;
+    durations.reserve(repetitionCount);
+    for(std::size_t i(0u); i < repetitionCount; ++i)
+    {
+        auto const tpStart(std::chrono::high_resolution_clock::now());
+        alpaka::stream::enqueue(stream, exec);
+        durations.emplace_back(std::chrono::high_resolution_clock::now() - tpStart);
+    }
+
+    std::sort(durations.begin(), durations.end());
+    return std::chrono::duration<double, std::milli>(durations[durations.size() / 2u]).count();
+}
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_SIMD_ENABLED
+//-----------------------------------------------------------------------------
+//! \return If all threads of a block have shared the block shared memory and syncBlockThreads has only been allowed for single thread blocks.
+//-----------------------------------------------------------------------------
+auto checkSimdBlockRestrictions()
+-> bool
+{
+    using Acc = alpaka::acc::AccCpuSimd<alpaka::dim::DimInt<1u>, std::size_t>;
+    using Vec1 = alpaka::Vec<alpaka::dim::DimInt<1u>, std::size_t>;
+
+    auto dev(alpaka::dev::cpu::getDev());
+    alpaka::stream::StreamCpuSync stream(dev);
+
+    std::size_t const blockThreadCount(alpaka::core::vectorization::GetVectorizationSizeElems<float>::value);
+    std::size_t const gridBlockCount(4u);
+    Vec1 const gridBlockExtents(gridBlockCount);
+    alpaka::workdiv::WorkDivMembers<alpaka::dim::DimInt<1u>, std::size_t> const workDiv(
+        gridBlockExtents,
+        Vec1(blockThreadCount));
+    alpaka::workdiv::WorkDivMembers<alpaka::dim::DimInt<1u>, std::size_t> const workDivSingleThread(
+        gridBlockExtents,
+        Vec1::ones());
+
+    std::vector<std::size_t> counts(gridBlockCount * blockThreadCount, 0u);
+    alpaka::stream::enqueue(
+        stream,
+        alpaka::exec::create<Acc>(
+            workDiv,
+            BlockSharedCountKernel(),
+            counts.data()));
+
+    bool correct(true);
+    for(std::size_t i(0u); i < counts.size(); ++i)
+    {
+        correct = correct && (counts[i] == (i % blockThreadCount) + 1u);
+    }
+
+    // A single thread is trivially synchronized.
+    alpaka::stream::enqueue(
+        stream,
+        alpaka::exec::create<Acc>(
+            workDivSingleThread,
+            SyncKernel()));
+
+    if(blockThreadCount > 1u)
+    {
+        bool thrown(false);
+        try
+        {
+            alpaka::stream::enqueue(
+                stream,
+                alpaka::exec::create<Acc>(
+                    workDiv,
+                    SyncKernel()));
+        }
+        catch(std::logic_error const &)
+        {
+            thrown = true;
+        }
+        correct = correct && thrown;
+    }
+
+    return correct;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                          alpaka SIMD lane benchmark                            " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        std::size_t const numElements(1u << 16u);
+        std::size_t const repetitionCount(3u);
+#else
+        std::size_t const numElements(1u << 24u);
+        std::size_t const repetitionCount(11u);
+#endif
+        std::vector<float> const x(numElements, 1.0f);
+        std::vector<float> y(numElements, 0.0f);
+
+        std::size_t const vectorWidth(alpaka::core::vectorization::GetVectorizationSizeElems<float>::value);
+        std::cout << "y = 2 * x + y, " << numElements << " floats, one grid thread per element, median over " << repetitionCount << " runs" << std::endl;
+        std::cout << "accelerator blockThreads time[ms] elements/ns" << std::endl;
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED
+        {
+            using Acc = alpaka::acc::AccCpuSerial<alpaka::dim::DimInt<1u>, std::size_t>;
+            auto const ms(measureAxpyMs<Acc>(1u, x, y, repetitionCount));
+            std::cout << alpaka::acc::getAccName<Acc>() << " 1 " << ms << " " << (static_cast<double>(numElements) / (ms * 1.0e6)) << std::endl;
+        }
+#endif
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_SIMD_ENABLED
+        {
+            using Acc = alpaka::acc::AccCpuSimd<alpaka::dim::DimInt<1u>, std::size_t>;
+            for(std::size_t blockThreadCount(1u); blockThreadCount <= vectorWidth; blockThreadCount *= 2u)
+            {
+                auto const ms(measureAxpyMs<Acc>(blockThreadCount, x, y, repetitionCount));
+                std::cout << alpaka::acc::getAccName<Acc>() << " " << blockThreadCount << " " << ms << " " << (static_cast<double>(numElements) / (ms * 1.0e6)) << std::endl;
+            }
+        }
+#else
+        std::cout << "AccCpuSimd is not enabled." << std::endl;
+#endif
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_SIMD_ENABLED
+        if(!checkSimdBlockRestrictions())
+        {
+            std::cerr << "The threads of an AccCpuSimd block did not share the block shared memory or syncBlockThreads did not throw for a block with more than one thread!" << std::endl;
+            return EXIT_FAILURE;
+        }
+#endif
+        // Every element has been updated once per run (including the runs of all accelerators).
+        float const expected(y.front());
+        for(auto const & elem : y)
+        {
+            if(elem != expected)
+            {
+                std::cerr << "The results are wrong!" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
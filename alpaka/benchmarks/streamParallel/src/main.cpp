@@ -0,0 +1,254 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::stream::StreamCpuParallel
+
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <cstdint>                                  // std::uint32_t
+#include <iostream>                                 // std::cout
+#include <stdexcept>                                // std::runtime_error
+#include <string>                                   // std::string
+#include <thread>                                   // std::thread::hardware_concurrency
+#include <vector>                                   // std::vector
+
+using Clock = std::chrono::high_resolution_clock;
+using Size = std::size_t;
+using Val = std::uint32_t;
+using Vec1 = alpaka::Vec<alpaka::dim::DimInt<1u>, Size>;
+using Buf = alpaka::mem::buf::Buf<alpaka::dev::DevCpu, Val, alpaka::dim::DimInt<1u>, Size>;
+
+//#############################################################################
+//! The buffers of one independent chain of tasks.
+//#############################################################################
+struct Chain
+{
+    Buf m_bufIn;
+    Buf m_bufCopy;
+    Buf m_bufOut;
+    Buf m_bufResult;
+};
+
+//-----------------------------------------------------------------------------
+//! Enqueues independent chains of a set, a copy, a compute task and a copy back into the stream and prints the duration.
+//!
+//! The tasks of a chain access the same buffers and have to run in order, the chains are independent of each other.
+//! The compute task declares its buffers with stream::cpu::withMemAccesses, otherwise it would order all chains.
+//!
+//! \return If every chain produced the expected result.
+//-----------------------------------------------------------------------------
+template<
+    typename TStream>
+auto measureChains(
+    std::string const & streamName,
+    TStream & stream,
+    std::vector<Chain> & chains,
+    Size const & elemCount,
+    Size const & roundCount)
+-> bool
+{
+    Vec1 const extent(elemCount);
+
+    auto const tpStart(Clock::now());
+    for(Size chainIdx(0u); chainIdx < chains.size(); ++chainIdx)
+    {
+        auto & chain(chains[chainIdx]);
+        alpaka::mem::view::set(stream, chain.m_bufIn, static_cast<std::uint8_t>(chainIdx + 1u), extent);
+        alpaka::mem::view::copy(stream, chain.m_bufCopy, chain.m_bufIn, extent);
+
+        Val const * const pIn(alpaka::mem::view::getPtrNative(chain.m_bufCopy));
+        Val * const pOut(alpaka::mem::view::getPtrNative(chain.m_bufOut));
+        alpaka::stream::enqueue(
+            stream,
+            alpaka::stream::cpu::withMemAccesses(
+                [pIn, pOut, elemCount, roundCount]()
+                {
+                    for(Size i(0u); i < elemCount; ++i)
+                    {
+                        Val val(pIn[i]);
+                        for(Size round(0u); round < roundCount; ++round)
+                        {
+                            val = val * 1664525u + 1013904223u;
+                        }
+                        pOut[i] = val;
+                    }
+                },
+                {alpaka::stream::cpu::memRead(chain.m_bufCopy), alpaka::stream::cpu::memWrite(chain.m_bufOut)}));
+
+        alpaka::mem::view::copy(stream, chain.m_bufResult, chain.m_bufOut, extent);
+    }
+    alpaka::wait::wait(stream);
+    auto const durationMs(std::chrono::duration<double, std::milli>(Clock::now() - tpStart).count());
+
+    std::cout
+        << streamName
+        << " " << chains.size()
+        << " " << elemCount
+        << " " << durationMs
+        << std::endl;
+
+    bool resultsCorrect(true);
+    for(Size chainIdx(0u); chainIdx < chains.size(); ++chainIdx)
+    {
+        Val const byte(static_cast<Val>(chainIdx + 1u));
+        Val expected(byte | (byte << 8u) | (byte << 16u) | (byte << 24u));
+        for(Size round(0u); round < roundCount; ++round)
+        {
+            expected = expected * 1664525u + 1013904223u;
+        }
+
+        Val const * const pResult(alpaka::mem::view::getPtrNative(chains[chainIdx].m_bufResult));
+        for(Size i(0u); i < elemCount; ++i)
+        {
+            if(pResult[i] != expected)
+            {
+                resultsCorrect = false;
+                break;
+            }
+        }
+    }
+
+    // Clear the results so that the next measurement can not pass with stale data.
+    for(auto & chain : chains)
+    {
+        alpaka::mem::view::set(stream, chain.m_bufResult, 0u, extent);
+    }
+    alpaka::wait::wait(stream);
+
+    return resultsCorrect;
+}
+
+//-----------------------------------------------------------------------------
+//! Enqueues a task that throws followed by a task without declared accesses into the stream and waits for the stream and the device.
+//!
+//! The exception of a task is dropped and the task still counts as completed, otherwise the waits would never return.
+//!
+//! \return If the task after the throwing one has run.
+//-----------------------------------------------------------------------------
+template<
+    typename TStream>
+auto checkThrowingTask(
+    std::string const & streamName,
+    TStream & stream,
+    alpaka::dev::DevCpu & dev)
+-> bool
+{
+    bool ranAfterThrow(false);
+    alpaka::stream::enqueue(
+        stream,
+        []()
+        {
+            throw std::runtime_error("Task exception");
+        });
+    alpaka::stream::enqueue(
+        stream,
+        [&ranAfterThrow]()
+        {
+            ranAfterThrow = true;
+        });
+    alpaka::wait::wait(stream);
+    alpaka::wait::wait(dev);
+
+    std::cout << streamName << " " << (ranAfterThrow ? "completed" : "skipped") << std::endl;
+
+    return ranAfterThrow;
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                        alpaka parallel stream benchmark                        " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        Size const chainCount(8u);
+        Size const elemCount(1u << 14u);
+        Size const roundCount(16u);
+#else
+        Size const chainCount(64u);
+        Size const elemCount(1u << 20u);
+        Size const roundCount(64u);
+#endif
+
+        auto dev(alpaka::dev::cpu::getDev());
+        Vec1 const extent(elemCount);
+
+        std::vector<Chain> chains;
+        chains.reserve(chainCount);
+        for(Size chainIdx(0u); chainIdx < chainCount; ++chainIdx)
+        {
+            chains.emplace_back(
+                Chain{
+                    alpaka::mem::buf::alloc<Val, Size>(dev, extent),
+                    alpaka::mem::buf::alloc<Val, Size>(dev, extent),
+                    alpaka::mem::buf::alloc<Val, Size>(dev, extent),
+                    alpaka::mem::buf::alloc<Val, Size>(dev, extent)});
+        }
+
+        std::cout << "Independent chains of set, copy, compute and copy, " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+        std::cout << "stream chains elements duration[ms]" << std::endl;
+
+        alpaka::stream::StreamCpuAsync streamAsync(dev);
+        alpaka::stream::StreamCpuParallel streamParallel(dev);
+
+        bool resultsCorrect(true);
+        resultsCorrect = measureChains("async", streamAsync, chains, elemCount, roundCount) && resultsCorrect;
+        resultsCorrect = measureChains("parallel", streamParallel, chains, elemCount, roundCount) && resultsCorrect;
+
+        if(!resultsCorrect)
+        {
+            std::cerr << "A chain produced a wrong result!" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::cout << std::endl;
+        std::cout << "A throwing task followed by a task ordered after it" << std::endl;
+        std::cout << "stream next task" << std::endl;
+
+        bool completedAfterThrow(true);
+        completedAfterThrow = checkThrowingTask("async", streamAsync, dev) && completedAfterThrow;
+        completedAfterThrow = checkThrowingTask("parallel", streamParallel, dev) && completedAfterThrow;
+
+        if(!completedAfterThrow)
+        {
+            std::cerr << "A task after a throwing task has not run!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,289 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::stream::StreamCpuAsync
+
+#include <algorithm>                                // std::max
+#include <atomic>                                   // std::atomic
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <future>                                   // std::promise, std::shared_future
+#include <iostream>                                 // std::cout
+#include <memory>                                   // std::unique_ptr
+#include <thread>                                   // std::thread::hardware_concurrency, std::this_thread::sleep_for
+#include <vector>                                   // std::vector
+
+using Clock = std::chrono::high_resolution_clock;
+
+//-----------------------------------------------------------------------------
+//! Records the number of threads currently running the stream tasks of the device if it is the largest one seen.
+//-----------------------------------------------------------------------------
+auto recordStreamThreadCount(
+    alpaka::dev::DevCpu const & dev,
+    std::atomic<std::size_t> & streamThreadCountMax)
+-> void
+{
+    auto const streamThreadCount(dev.m_spDevCpuImpl->getStreamThreadCount());
+    auto streamThreadCountSeen(streamThreadCountMax.load());
+    while((streamThreadCountSeen < streamThreadCount)
+        && !streamThreadCountMax.compare_exchange_weak(streamThreadCountSeen, streamThreadCount))
+    {
+    }
+}
+
+//-----------------------------------------------------------------------------
+//! \return If the number of threads running the stream tasks of the device has returned to the size of the stream thread pool within a second.
+//-----------------------------------------------------------------------------
+auto waitForStreamHelpersToExit(
+    alpaka::dev::DevCpu const & dev)
+-> bool
+{
+    auto const poolSize(static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u)));
+    auto const tpStart(Clock::now());
+    while(dev.m_spDevCpuImpl->getStreamThreadCount() > poolSize)
+    {
+        if(Clock::now() - tpStart > std::chrono::seconds(1))
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+//! Pushes the items through a pipeline of one stream per stage and prints the throughput.
+//!
+//! Every stage waits for the event recorded by the previous stage after it has processed the item.
+//! The waiting streams are suspended instead of blocking a thread, so the whole pipeline runs on the stream thread pool of the device.
+//! Prints the largest number of threads that has run a stage.
+//!
+//! \return If every stage has processed every item in order and the pipeline has not needed more threads than the stream thread pool has.
+//-----------------------------------------------------------------------------
+auto measurePipeline(
+    std::size_t const & stageCount,
+    std::size_t const & itemCount)
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+
+    std::vector<std::unique_ptr<alpaka::stream::StreamCpuAsync>> streams;
+    streams.reserve(stageCount);
+    for(std::size_t stage(0u); stage < stageCount; ++stage)
+    {
+        streams.emplace_back(new alpaka::stream::StreamCpuAsync(dev));
+    }
+
+    // An event that is waited for can not be re-enqueued before it has been completed, so every item uses its own events.
+    std::vector<alpaka::event::EventCpu> events;
+    events.reserve(stageCount * itemCount);
+    for(std::size_t i(0u); i < stageCount * itemCount; ++i)
+    {
+        events.emplace_back(dev);
+    }
+
+    // The number of stages that have processed the item.
+    std::vector<std::size_t> itemStages(itemCount, 0u);
+    std::atomic<bool> inOrder(true);
+    std::atomic<std::size_t> streamThreadCountMax(0u);
+
+    auto const tpStart(Clock::now());
+    for(std::size_t item(0u); item < itemCount; ++item)
+    {
+        for(std::size_t stage(0u); stage < stageCount; ++stage)
+        {
+            auto & stream(*streams[stage]);
+            if(stage > 0u)
+            {
+                alpaka::wait::wait(stream, events[item * stageCount + stage - 1u]);
+            }
+            alpaka::stream::enqueue(
+                stream,
+                [&dev, &itemStages, &inOrder, &streamThreadCountMax, item, stage]()
+                {
+                    recordStreamThreadCount(dev, streamThreadCountMax);
+                    if(itemStages[item] != stage)
+                    {
+                        inOrder = false;
+                    }
+                    itemStages[item] = stage + 1u;
+                });
+            alpaka::stream::enqueue(stream, events[item * stageCount + stage]);
+        }
+    }
+    auto const tpSubmitted(Clock::now());
+    for(auto && stream : streams)
+    {
+        alpaka::wait::wait(*stream);
+    }
+    auto const durationS(std::chrono::duration<double>(Clock::now() - tpStart).count());
+
+    std::cout
+        << stageCount
+        << " " << itemCount
+        << " " << std::chrono::duration<double, std::milli>(tpSubmitted - tpStart).count()
+        << " " << (1.0e3 * durationS)
+        << " " << (static_cast<double>(stageCount * itemCount) / durationS)
+        << " " << streamThreadCountMax
+        << std::endl;
+
+    for(auto const & itemStage : itemStages)
+    {
+        if(itemStage != stageCount)
+        {
+            inOrder = false;
+        }
+    }
+    // The stages never block a thread, so more threads than the pool has are only added if a worker has been descheduled for long.
+    return inOrder && (streamThreadCountMax <= static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u)) + 1u);
+}
+
+//-----------------------------------------------------------------------------
+//! Lets the task of every stream block the host until the task of the next stream has run.
+//!
+//! The tasks are enqueued in the order in which they block, so they only complete if blocked workers of the stream thread pool are compensated, even if there are more streams than hardware threads.
+//! A pool with a fixed number of workers and no compensation deadlocks here.
+//! Prints the largest number of threads that has run a task.
+//!
+//! \return If every task has run after the task of the next stream, no more threads than blocked tasks plus the pool size have been used and the helper threads have exited afterwards.
+//-----------------------------------------------------------------------------
+auto checkHostWaitAcrossStreams(
+    std::size_t const & streamCount)
+-> bool
+{
+    auto dev(alpaka::dev::cpu::getDev());
+
+    std::vector<std::unique_ptr<alpaka::stream::StreamCpuAsync>> streams;
+    streams.reserve(streamCount);
+    std::vector<std::promise<void>> promises(streamCount);
+    std::vector<std::shared_future<void>> futures;
+    futures.reserve(streamCount);
+    for(std::size_t i(0u); i < streamCount; ++i)
+    {
+        streams.emplace_back(new alpaka::stream::StreamCpuAsync(dev));
+        futures.emplace_back(promises[i].get_future().share());
+    }
+
+    std::atomic<std::size_t> completedCount(0u);
+    std::atomic<bool> inOrder(true);
+    std::atomic<std::size_t> streamThreadCountMax(0u);
+
+    auto const tpStart(Clock::now());
+    for(std::size_t i(0u); i < streamCount; ++i)
+    {
+        alpaka::stream::enqueue(
+            *streams[i],
+            [&dev, &promises, &futures, &completedCount, &inOrder, &streamThreadCountMax, i, streamCount]()
+            {
+                recordStreamThreadCount(dev, streamThreadCountMax);
+                if(i + 1u < streamCount)
+                {
+                    futures[i + 1u].wait();
+                }
+                if(completedCount.fetch_add(1u) != streamCount - 1u - i)
+                {
+                    inOrder = false;
+                }
+                promises[i].set_value();
+            });
+    }
+    for(auto && stream : streams)
+    {
+        alpaka::wait::wait(*stream);
+    }
+
+    auto const durationMs(std::chrono::duration<double, std::milli>(Clock::now() - tpStart).count());
+    bool const helpersExited(waitForStreamHelpersToExit(dev));
+
+    std::cout
+        << streamCount
+        << " " << durationMs
+        << " " << streamThreadCountMax
+        << " " << dev.m_spDevCpuImpl->getStreamThreadCount()
+        << std::endl;
+
+    // At most one thread per blocked task is needed on top of the pool.
+    auto const poolSize(static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u)));
+    return inOrder
+        && (completedCount == streamCount)
+        && (streamThreadCountMax <= streamCount + poolSize)
+        && helpersExited;
+}
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                        alpaka stream pipeline benchmark                        " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        std::size_t const itemCount(20u);
+        std::size_t const stageCountMax(64u);
+#else
+        std::size_t const itemCount(100u);
+        std::size_t const stageCountMax(256u);
+#endif
+
+        std::cout << "One StreamCpuAsync per stage, every stage waits for the event of the previous one, " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+        std::cout << "stages items submit[ms] complete[ms] stageTasks/s threads" << std::endl;
+
+        bool inOrder(true);
+        for(std::size_t stageCount(4u); stageCount <= stageCountMax; stageCount *= 4u)
+        {
+            inOrder = measurePipeline(stageCount, itemCount) && inOrder;
+        }
+
+        if(!inOrder)
+        {
+            std::cerr << "A stage processed an item before the previous stage or the pipeline used more threads than the stream thread pool has!" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::cout << std::endl;
+        std::cout << "One StreamCpuAsync per task, every task blocks until the task of the next stream has run" << std::endl;
+        std::cout << "streams complete[ms] threads threadsAfterwards" << std::endl;
+
+        auto const hostWaitStreamCount(2u * static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u)) + 2u);
+        if(!checkHostWaitAcrossStreams(hostWaitStreamCount))
+        {
+            std::cerr << "A task blocking on another stream completed out of order or the number of threads was not bounded!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
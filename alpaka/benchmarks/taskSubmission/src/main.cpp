@@ -0,0 +1,506 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <alpaka/alpaka.hpp>                        // alpaka::exec::create
+
+#include <boost/config.hpp>                         // BOOST_NOINLINE
+
+#include <algorithm>                                // std::sort, std::min
+#include <atomic>                                   // std::atomic
+#include <chrono>                                   // std::chrono::high_resolution_clock
+#include <cstdlib>                                  // std::malloc, std::free
+#include <ctime>                                    // std::clock
+#include <iostream>                                 // std::cout
+#include <new>                                      // std::bad_alloc, std::nothrow_t
+#include <stdexcept>                                // std::runtime_error
+#include <string>                                   // std::string
+#include <thread>                                   // std::thread, std::this_thread::sleep_for
+#include <vector>                                   // std::vector
+
+//-----------------------------------------------------------------------------
+//! \return The number of heap allocations done by the whole program.
+//-----------------------------------------------------------------------------
+auto allocationCount()
+-> std::atomic<std::size_t> &
+{
+    static std::atomic<std::size_t> count(0u);
+    return count;
+}
+
+//-----------------------------------------------------------------------------
+//! Counts and performs a heap allocation for all forms of the global allocation functions.
+//-----------------------------------------------------------------------------
+auto countedAlloc(
+    std::size_t size) noexcept
+-> void *
+{
+    ++allocationCount();
+    return std::malloc(size == 0u ? 1u : size);
+}
+//-----------------------------------------------------------------------------
+//! Frees memory of countedAlloc for all forms of the global deallocation functions.
+//!
+//! It is not inlined into the deallocation functions, otherwise GCC pairs the new expressions of the callers with std::free and warns about a mismatch.
+//-----------------------------------------------------------------------------
+BOOST_NOINLINE auto countedFree(
+    void * p) noexcept
+-> void
+{
+    std::free(p);
+}
+
+// All replaceable forms are defined so that every allocation is paired with the deallocation using the same heap.
+//-----------------------------------------------------------------------------
+//! Counting global allocation function.
+//-----------------------------------------------------------------------------
+auto operator new(
+    std::size_t size)
+-> void *
+{
+    if(void * p = countedAlloc(size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+//-----------------------------------------------------------------------------
+//! Counting global array allocation function.
+//-----------------------------------------------------------------------------
+auto operator new[](
+    std::size_t size)
+-> void *
+{
+    if(void * p = countedAlloc(size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+//-----------------------------------------------------------------------------
+//! Counting global non-throwing allocation function.
+//-----------------------------------------------------------------------------
+auto operator new(
+    std::size_t size,
+    std::nothrow_t const &) noexcept
+-> void *
+{
+    return countedAlloc(size);
+}
+//-----------------------------------------------------------------------------
+//! Counting global non-throwing array allocation function.
+//-----------------------------------------------------------------------------
+auto operator new[](
+    std::size_t size,
+    std::nothrow_t const &) noexcept
+-> void *
+{
+    return countedAlloc(size);
+}
+//-----------------------------------------------------------------------------
+//! Global deallocation function matching the counting allocation functions.
+//-----------------------------------------------------------------------------
+auto operator delete(
+    void * p) noexcept
+-> void
+{
+    countedFree(p);
+}
+//-----------------------------------------------------------------------------
+//! Global array deallocation function matching the counting allocation functions.
+//-----------------------------------------------------------------------------
+auto operator delete[](
+    void * p) noexcept
+-> void
+{
+    countedFree(p);
+}
+//-----------------------------------------------------------------------------
+//! Global sized deallocation function matching the counting allocation functions.
+//-----------------------------------------------------------------------------
+auto operator delete(
+    void * p,
+    std::size_t) noexcept
+-> void
+{
+    countedFree(p);
+}
+//-----------------------------------------------------------------------------
+//! Global sized array deallocation function matching the counting allocation functions.
+//-----------------------------------------------------------------------------
+auto operator delete[](
+    void * p,
+    std::size_t) noexcept
+-> void
+{
+    countedFree(p);
+}
+//-----------------------------------------------------------------------------
+//! Global non-throwing deallocation function matching the counting allocation functions.
+//-----------------------------------------------------------------------------
+auto operator delete(
+    void * p,
+    std::nothrow_t const &) noexcept
+-> void
+{
+    countedFree(p);
+}
+//-----------------------------------------------------------------------------
+//! Global non-throwing array deallocation function matching the counting allocation functions.
+//-----------------------------------------------------------------------------
+auto operator delete[](
+    void * p,
+    std::nothrow_t const &) noexcept
+-> void
+{
+    countedFree(p);
+}
+
+using ThreadPool = alpaka::dev::cpu::detail::DevCpuImpl::ThreadPool;
+
+//-----------------------------------------------------------------------------
+//! The result of submitting a number of tasks.
+//-----------------------------------------------------------------------------
+struct SubmissionResult
+{
+    double m_allocationsPerTask;
+    double m_tasksPerSecond;
+};
+
+//-----------------------------------------------------------------------------
+//! Submits the tasks in rounds of one task per worker with a future each and waits for the futures.
+//-----------------------------------------------------------------------------
+auto measureWithFutures(
+    ThreadPool & threadPool,
+    std::size_t const & roundCount)
+-> SubmissionResult
+{
+    std::size_t const numWorkers(threadPool.getConcurrentExecutionCount());
+    std::vector<std::future<void>> futures;
+    futures.reserve(numWorkers);
+
+    auto const allocationsStart(allocationCount().load());
+    auto const tpStart(std::chrono::high_resolution_clock::now());
+    for(std::size_t round(0u); round < roundCount; ++round)
+    {
+        for(std::size_t worker(0u); worker < numWorkers; ++worker)
+        {
+            futures.emplace_back(threadPool.enqueueTask([](){}));
+        }
+        for(auto && future : futures)
+        {
+            future.wait();
+        }
+        futures.clear();
+    }
+    auto const durationS(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - tpStart).count());
+    auto const allocations(allocationCount().load() - allocationsStart);
+
+    double const taskCount(static_cast<double>(roundCount * numWorkers));
+    return {static_cast<double>(allocations) / taskCount, taskCount / durationS};
+}
+
+//-----------------------------------------------------------------------------
+//! Submits the tasks in rounds of one task per worker into a task group and waits for the group.
+//-----------------------------------------------------------------------------
+auto measureWithTaskGroup(
+    ThreadPool & threadPool,
+    std::size_t const & roundCount)
+-> SubmissionResult
+{
+    std::size_t const numWorkers(threadPool.getConcurrentExecutionCount());
+    ThreadPool::TaskGroup taskGroup;
+
+    auto const allocationsStart(allocationCount().load());
+    auto const tpStart(std::chrono::high_resolution_clock::now());
+    for(std::size_t round(0u); round < roundCount; ++round)
+    {
+        for(std::size_t worker(0u); worker < numWorkers; ++worker)
+        {
+            threadPool.enqueueTaskNoFuture([](){}, &taskGroup);
+        }
+        taskGroup.wait();
+    }
+    auto const durationS(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - tpStart).count());
+    auto const allocations(allocationCount().load() - allocationsStart);
+
+    double const taskCount(static_cast<double>(roundCount * numWorkers));
+    return {static_cast<double>(allocations) / taskCount, taskCount / durationS};
+}
+
+//-----------------------------------------------------------------------------
+//! Measures and prints the time from the enqueue of a task into an idle pool until the task starts.
+//!
+//! Before every enqueue the submitting thread sleeps for the given gap so that the worker runs into its idle path.
+//! The CPU time consumed by the whole process per task shows what the worker burns while it is idle.
+//-----------------------------------------------------------------------------
+auto measureIdleWakeup(
+    std::string const & policyName,
+    alpaka::core::detail::IdlePolicy const & idlePolicy,
+    std::chrono::microseconds const & gap,
+    std::size_t const & taskCount)
+-> void
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    ThreadPool threadPool(1u, 128u, idlePolicy);
+    ThreadPool::TaskGroup taskGroup;
+
+    std::vector<Clock::duration> durations;
+    durations.reserve(taskCount);
+    Clock::time_point tpTaskStart;
+
+    auto const cpuStart(std::clock());
+    for(std::size_t i(0u); i < taskCount; ++i)
+    {
+        std::this_thread::sleep_for(gap);
+        auto const tpEnqueue(Clock::now());
+        threadPool.enqueueTaskNoFuture([&tpTaskStart](){tpTaskStart = Clock::now();}, &taskGroup);
+        taskGroup.wait();
+        durations.emplace_back(tpTaskStart - tpEnqueue);
+    }
+    auto const cpuUs(1.0e6 * static_cast<double>(std::clock() - cpuStart) / static_cast<double>(CLOCKS_PER_SEC));
+
+    std::sort(durations.begin(), durations.end());
+    auto const percentileUs(
+        [&durations](double const & percentile)
+        {
+            auto const idx(
+                std::min(
+                    static_cast<std::size_t>(percentile * static_cast<double>(durations.size())),
+                    durations.size() - 1u));
+            return std::chrono::duration<double, std::micro>(durations[idx]).count();
+        });
+
+    std::cout
+        << policyName
+        << " " << gap.count()
+        << " " << percentileUs(0.5)
+        << " " << percentileUs(0.99)
+        << " " << (cpuUs / static_cast<double>(taskCount))
+        << std::endl;
+}
+
+//#############################################################################
+//! A kernel doing nothing.
+//#############################################################################
+class EmptyKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! The kernel entry point.
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc) const
+    -> void
+    {
+        boost::ignore_unused(acc);
+    }
+};
+
+//-----------------------------------------------------------------------------
+//! Program entry point.
+//-----------------------------------------------------------------------------
+auto main()
+-> int
+{
+    try
+    {
+        std::cout << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << "                       alpaka task submission benchmark                         " << std::endl;
+        std::cout << "################################################################################" << std::endl;
+        std::cout << std::endl;
+
+#if ALPAKA_INTEGRATION_TEST
+        std::size_t const roundCount(1000u);
+#else
+        std::size_t const roundCount(100000u);
+#endif
+        bool allocationFree(true);
+
+        std::cout << "ConcurrentExecPool, empty tasks, one task per worker and round, " << roundCount << " rounds" << std::endl;
+        std::cout << "workers submission allocations/task tasks/s" << std::endl;
+        for(std::size_t numWorkers(1u); numWorkers <= 4u; numWorkers *= 2u)
+        {
+            ThreadPool threadPool(numWorkers, 128u);
+
+            // Warm up the task slots and the queue nodes.
+            measureWithTaskGroup(threadPool, 10u);
+
+            auto const resultFutures(measureWithFutures(threadPool, roundCount));
+            auto const resultTaskGroup(measureWithTaskGroup(threadPool, roundCount));
+
+            std::cout << numWorkers << " future " << resultFutures.m_allocationsPerTask << " " << resultFutures.m_tasksPerSecond << std::endl;
+            std::cout << numWorkers << " taskGroup " << resultTaskGroup.m_allocationsPerTask << " " << resultTaskGroup.m_tasksPerSecond << std::endl;
+
+            if(resultTaskGroup.m_allocationsPerTask != 0.0)
+            {
+                allocationFree = false;
+            }
+        }
+
+        {
+            using IdlePolicy = alpaka::core::detail::IdlePolicy;
+
+            std::cout << std::endl;
+            std::cout << "ConcurrentExecPool idle policies, one worker, " << (roundCount / 10u) << " tasks per row, times in us" << std::endl;
+            std::cout << "policy gap enqueueToStartP50 enqueueToStartP99 cpuTime/task" << std::endl;
+            for(auto const gap : {std::chrono::microseconds(0), std::chrono::microseconds(20), std::chrono::microseconds(200)})
+            {
+                measureIdleWakeup("park", IdlePolicy::park(), gap, roundCount / 10u);
+                measureIdleWakeup("yield", IdlePolicy::yield(), gap, roundCount / 10u);
+                measureIdleWakeup("hybrid", IdlePolicy::hybrid(), gap, roundCount / 10u);
+                // A spinning worker on a single core only steals the time slices of the submitting thread.
+                if(std::thread::hardware_concurrency() > 1u)
+                {
+                    measureIdleWakeup("spin", IdlePolicy::spin(), gap, roundCount / 10u);
+                }
+            }
+        }
+
+        {
+            // Enqueuing into an asynchronous stream uses the same task slots.
+            auto dev(alpaka::dev::cpu::getDev());
+            alpaka::stream::StreamCpuAsync stream(dev);
+
+            using Acc = alpaka::acc::AccCpuSerial<alpaka::dim::DimInt<1u>, std::size_t>;
+            alpaka::Vec<alpaka::dim::DimInt<1u>, std::size_t> const extents(static_cast<std::size_t>(1u));
+            alpaka::workdiv::WorkDivMembers<alpaka::dim::DimInt<1u>, std::size_t> const workDiv(
+                extents,
+                extents);
+            EmptyKernel kernel;
+            auto const exec(alpaka::exec::create<Acc>(
+                workDiv,
+                kernel));
+
+            // Warm up the task slots and the queue nodes.
+            for(std::size_t i(0u); i < 10u; ++i)
+            {
+                alpaka::stream::enqueue(stream, exec);
+            }
+            alpaka::wait::wait(stream);
+
+            // Only the enqueue calls are counted, waiting for the stream creates an event.
+            std::size_t allocations(0u);
+            for(std::size_t round(0u); round < roundCount / 10u; ++round)
+            {
+                auto const allocationsStart(allocationCount().load());
+                alpaka::stream::enqueue(stream, exec);
+                allocations += allocationCount().load() - allocationsStart;
+                alpaka::wait::wait(stream);
+            }
+            std::cout << std::endl;
+            std::cout << "StreamCpuAsync enqueue of an " << alpaka::acc::getAccName<Acc>() << " executor: allocations/enqueue " << (static_cast<double>(allocations) / static_cast<double>(roundCount / 10u)) << std::endl;
+        }
+
+        {
+            // A burst of tasks into a stream with a small queue does not grow the queue.
+            auto dev(alpaka::dev::cpu::getDev());
+            std::size_t const queueCapacity(16u);
+            std::size_t const burstSize(queueCapacity * 64u);
+            auto const slowTask([](){std::this_thread::sleep_for(std::chrono::microseconds(10));});
+            // Waiting for a stream enqueues an event, so it is only done after the queue has drained to not fail with QueueFullPolicy::Fail.
+            auto const waitStream(
+                [](alpaka::stream::StreamCpuAsync & stream)
+                {
+                    while(!alpaka::stream::empty(stream))
+                    {
+                        std::this_thread::yield();
+                    }
+                    alpaka::wait::wait(stream);
+                });
+
+            std::cout << std::endl;
+            std::cout << "StreamCpuAsync burst of " << burstSize << " tasks into a queue of " << queueCapacity << std::endl;
+            std::cout << "policy allocations/enqueue rejected tasks/s" << std::endl;
+            for(auto const queueFullPolicy : {alpaka::stream::StreamCpuAsync::QueueFullPolicy::Block, alpaka::stream::StreamCpuAsync::QueueFullPolicy::Spin, alpaka::stream::StreamCpuAsync::QueueFullPolicy::Fail})
+            {
+                alpaka::stream::StreamCpuAsync stream(dev, queueCapacity, queueFullPolicy);
+
+                // Warm up the task slots by filling the queue.
+                for(std::size_t i(0u); i < queueCapacity * 2u; ++i)
+                {
+                    try
+                    {
+                        alpaka::stream::enqueue(stream, slowTask);
+                    }
+                    catch(std::runtime_error const &)
+                    {}
+                }
+                waitStream(stream);
+
+                std::size_t rejected(0u);
+                auto const allocationsStart(allocationCount().load());
+                auto const tpStart(std::chrono::high_resolution_clock::now());
+                for(std::size_t i(0u); i < burstSize; ++i)
+                {
+                    try
+                    {
+                        alpaka::stream::enqueue(stream, slowTask);
+                    }
+                    catch(std::runtime_error const &)
+                    {
+                        ++rejected;
+                    }
+                }
+                auto const allocations(allocationCount().load() - allocationsStart);
+                waitStream(stream);
+                auto const durationS(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - tpStart).count());
+
+                std::cout
+                    << (queueFullPolicy == alpaka::stream::StreamCpuAsync::QueueFullPolicy::Block ? "block" : (queueFullPolicy == alpaka::stream::StreamCpuAsync::QueueFullPolicy::Spin ? "spin" : "fail"))
+                    << " " << (static_cast<double>(allocations) / static_cast<double>(burstSize))
+                    << " " << rejected
+                    << " " << (static_cast<double>(burstSize - rejected) / durationS)
+                    << std::endl;
+
+                // Besides the message of the exceptions thrown for rejected tasks only the last task slots are allocated.
+                // There are at most as many slots as queued tasks plus the running task plus the one of the producer.
+                if((allocations > rejected + 2u)
+                    || ((queueFullPolicy == alpaka::stream::StreamCpuAsync::QueueFullPolicy::Fail) ? (rejected == 0u) : (rejected != 0u)))
+                {
+                    std::cerr << "The stream queue did not apply the backpressure of its policy!" << std::endl;
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+
+        if(!allocationFree)
+        {
+            std::cerr << "Enqueuing tasks into a task group allocated memory in the steady state!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Unknown Exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -23,6 +23,7 @@
 
 #include <alpaka/alpaka.hpp>
 
+#include <chrono>           // std::chrono::milliseconds, std::chrono::nanoseconds
 #include <type_traits>      // std::decay
 #include <utility>          // std::forward
 
@@ -68,5 +69,31 @@ namespace alpaka
             // Return the duration.
             return std::chrono::duration_cast<std::chrono::milliseconds>(durElapsed).count();
         }
+        //-----------------------------------------------------------------------------
+        //! \return The run time of the given kernel measured by events around it.
+        //!
+        //! In contrast to measureKernelRunTimeMs only the stop event is waited for, so the tasks enqueued prior to the kernel are not drained separately.
+        //! The events of the device have to support event::elapsedTime.
+        //-----------------------------------------------------------------------------
+        template<
+            typename TStream,
+            typename TExec>
+        auto measureKernelRunTimeNs(
+            TStream & stream,
+            TExec && exec)
+        -> std::chrono::nanoseconds::rep
+        {
+            auto const dev(alpaka::dev::getDev(stream));
+            alpaka::event::Event<TStream> start(dev);
+            alpaka::event::Event<TStream> stop(dev);
+
+            alpaka::stream::enqueue(stream, start);
+            alpaka::stream::enqueue(stream, std::forward<TExec>(exec));
+            alpaka::stream::enqueue(stream, stop);
+
+            alpaka::wait::wait(stop);
+
+            return alpaka::event::elapsedTime(start, stop).count();
+        }
     }
 }
@@ -72,6 +72,17 @@ namespace alpaka
                     typename TSize>
                 using AccCpuThreadsIfAvailableElseVoid = void;
 #endif
+#ifdef ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLED
+                template<
+                    typename TDim,
+                    typename TSize>
+                using AccCpuThreadsBlocksIfAvailableElseVoid = acc::AccCpuThreadsBlocks<TDim, TSize>;
+#else
+                template<
+                    typename TDim,
+                    typename TSize>
+                using AccCpuThreadsBlocksIfAvailableElseVoid = void;
+#endif
 #ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
                 template<
                     typename TDim,
@@ -129,6 +140,8 @@ namespace alpaka
 #endif
                 //#############################################################################
                 //! A vector containing all available accelerators and void's.
+                //!
+                //! AccCpuSimd is not part of it because it does not support syncBlockThreads for blocks with more than one thread.
                 //#############################################################################
                 template<
                     typename TDim,
@@ -137,6 +150,7 @@ namespace alpaka
                     boost::mpl::vector<
                         AccCpuSerialIfAvailableElseVoid<TDim, TSize>,
                         AccCpuThreadsIfAvailableElseVoid<TDim, TSize>,
+                        AccCpuThreadsBlocksIfAvailableElseVoid<TDim, TSize>,
                         AccCpuFibersIfAvailableElseVoid<TDim, TSize>,
                         AccCpuOmp2BlocksIfAvailableElseVoid<TDim, TSize>,
                         AccCpuOmp2ThreadsIfAvailableElseVoid<TDim, TSize>,
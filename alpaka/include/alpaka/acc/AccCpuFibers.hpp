@@ -24,11 +24,11 @@
 // Base classes.
 #include <alpaka/workdiv/WorkDivMembers.hpp>    // workdiv::WorkDivMembers
 #include <alpaka/idx/gb/IdxGbRef.hpp>           // IdxGbRef
-#include <alpaka/idx/bt/IdxBtRefFiberIdMap.hpp> // IdxBtRefFiberIdMap
-#include <alpaka/atomic/AtomicNoOp.hpp>         // AtomicNoOp
+#include <alpaka/idx/bt/IdxBtFiberLocal.hpp>    // IdxBtFiberLocal
+#include <alpaka/atomic/AtomicStlLock.hpp>      // AtomicStlLock
 #include <alpaka/math/MathStl.hpp>              // MathStl
 #include <alpaka/block/shared/BlockSharedAllocMasterSync.hpp>   // BlockSharedAllocMasterSync
-#include <alpaka/block/sync/BlockSyncFiberIdMapBarrier.hpp>     // BlockSyncFiberIdMapBarrier
+#include <alpaka/block/sync/BlockSyncBarrierFiber.hpp>  // BlockSyncBarrierFiber
 #include <alpaka/rand/RandStl.hpp>              // RandStl
 
 // Specialized traits.
@@ -76,11 +76,11 @@ namespace alpaka
         class AccCpuFibers final :
             public workdiv::WorkDivMembers<TDim, TSize>,
             public idx::gb::IdxGbRef<TDim, TSize>,
-            public idx::bt::IdxBtRefFiberIdMap<TDim, TSize>,
-            public atomic::AtomicNoOp,
+            public idx::bt::IdxBtFiberLocal<TDim, TSize>,
+            public atomic::AtomicStlLock,
             public math::MathStl,
             public block::shared::BlockSharedAllocMasterSync,
-            public block::sync::BlockSyncFiberIdMapBarrier<TSize>,
+            public block::sync::BlockSyncBarrierFiber<TSize>,
             public rand::RandStl
         {
         public:
@@ -102,15 +102,14 @@ namespace alpaka
                 TWorkDiv const & workDiv) :
                     workdiv::WorkDivMembers<TDim, TSize>(workDiv),
                     idx::gb::IdxGbRef<TDim, TSize>(m_gridBlockIdx),
-                    idx::bt::IdxBtRefFiberIdMap<TDim, TSize>(m_fibersToIndices),
-                    atomic::AtomicNoOp(),
+                    idx::bt::IdxBtFiberLocal<TDim, TSize>(),
+                    atomic::AtomicStlLock(),
                     math::MathStl(),
                     block::shared::BlockSharedAllocMasterSync(
                         [this](){block::sync::syncBlockThreads(*this);},
                         [this](){return (m_masterFiberId == boost::this_fiber::get_id());}),
-                    block::sync::BlockSyncFiberIdMapBarrier<TSize>(
-                        m_threadsPerBlockCount,
-                        m_fibersToBarrier),
+                    block::sync::BlockSyncBarrierFiber<TSize>(
+                        m_threadsPerBlockCount),
                     rand::RandStl(),
                     m_gridBlockIdx(Vec<TDim, TSize>::zeros()),
                     m_threadsPerBlockCount(workdiv::getWorkDiv<Block, Threads>(workDiv).prod())
@@ -151,15 +150,10 @@ namespace alpaka
 
         private:
             // getIdx
-            typename idx::bt::IdxBtRefFiberIdMap<TDim, TSize>::FiberIdToIdxMap mutable m_fibersToIndices;  //!< The mapping of fibers id's to indices.
             alignas(16u) Vec<TDim, TSize> mutable m_gridBlockIdx;    //!< The index of the currently executed block.
 
             // syncBlockThreads
             TSize const m_threadsPerBlockCount;                         //!< The number of threads per block the barrier has to wait for.
-            std::map<
-                boost::fibers::fiber::id,
-                TSize> mutable m_fibersToBarrier;                      //!< The mapping of fibers id's to their current barrier.
-            //!< We have to keep the current and the last barrier because one of the fibers can reach the next barrier before another fiber was wakeup from the last one and has checked if it can run.
 
             // allocBlockSharedArr
             boost::fibers::fiber::id mutable m_masterFiberId;           //!< The id of the master fiber.
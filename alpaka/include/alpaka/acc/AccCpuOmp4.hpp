@@ -192,7 +192,8 @@ namespace alpaka
 #endif
                     return {
                         // m_multiProcessorCount
-                        static_cast<TSize>(1),
+                        // The executor runs as many teams concurrently as there are cores for all of their threads.
+                        static_cast<TSize>(::omp_get_num_procs()),
                         // m_blockThreadsCountMax
                         blockThreadsCountMax,
                         // m_blockThreadExtentsMax
@@ -0,0 +1,310 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Base classes.
+#include <alpaka/workdiv/WorkDivMembers.hpp>    // workdiv::WorkDivMembers
+#include <alpaka/idx/gb/IdxGbRef.hpp>           // IdxGbRef
+#include <alpaka/idx/bt/IdxBtRef.hpp>           // IdxBtRef
+#include <alpaka/atomic/AtomicNoOp.hpp>         // AtomicNoOp
+#include <alpaka/math/MathStl.hpp>              // MathStl
+#include <alpaka/block/shared/BlockSharedAllocSimdLanes.hpp>   // BlockSharedAllocSimdLanes
+#include <alpaka/block/sync/BlockSyncSimdLanes.hpp>  // BlockSyncSimdLanes
+#include <alpaka/rand/RandStl.hpp>              // RandStl
+
+// Specialized traits.
+#include <alpaka/acc/Traits.hpp>                // acc::traits::AccType
+#include <alpaka/dev/Traits.hpp>                // dev::traits::DevType
+#include <alpaka/exec/Traits.hpp>               // exec::traits::ExecType
+#include <alpaka/size/Traits.hpp>               // size::traits::SizeType
+
+// Implementation details.
+#include <alpaka/dev/DevCpu.hpp>                // dev::DevCpu
+#include <alpaka/core/Vectorize.hpp>            // core::vectorization::GetVectorizationSizeElems
+
+#include <boost/core/ignore_unused.hpp>         // boost::ignore_unused
+
+#include <memory>                               // std::unique_ptr
+#include <typeinfo>                             // typeid
+
+namespace alpaka
+{
+    namespace exec
+    {
+        template<
+            typename TDim,
+            typename TSize,
+            typename TKernelFnObj,
+            typename... TArgs>
+        class ExecCpuSimd;
+    }
+    namespace acc
+    {
+        //#############################################################################
+        //! The CPU SIMD lane accelerator.
+        //!
+        //! This accelerator allows vectorized kernel execution on a CPU device.
+        //! The blocks are executed serially and the threads of a block are executed as the lanes of a single loop the compiler can vectorize.
+        //! The block size is restricted to the number of float elements in a vector register.
+        //! The block shared memory is allocated once per block by the first lane and shared by all lanes of the block.
+        //!
+        //! Restriction: The lanes are executed one after another, so a lane can not wait for the following ones.
+        //! syncBlockThreads throws std::logic_error for blocks with more than one thread.
+        //! Kernels synchronizing their block threads have to be run with a single thread per block.
+        //#############################################################################
+        template<
+            typename TDim,
+            typename TSize>
+        class AccCpuSimd final :
+            public workdiv::WorkDivMembers<TDim, TSize>,
+            public idx::gb::IdxGbRef<TDim, TSize>,
+            public idx::bt::IdxBtRef<TDim, TSize>,
+            public atomic::AtomicNoOp,
+            public math::MathStl,
+            public block::shared::BlockSharedAllocSimdLanes,
+            public block::sync::BlockSyncSimdLanes<TSize>,
+            public rand::RandStl
+        {
+        public:
+            // Partial specialization with the correct TDim and TSize is not allowed.
+            template<
+                typename TDim2,
+                typename TSize2,
+                typename TKernelFnObj,
+                typename... TArgs>
+            friend class ::alpaka::exec::ExecCpuSimd;
+
+        private:
+            //-----------------------------------------------------------------------------
+            //! Constructor.
+            //-----------------------------------------------------------------------------
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_ACC_NO_CUDA AccCpuSimd(
+                TWorkDiv const & workDiv) :
+                    workdiv::WorkDivMembers<TDim, TSize>(workDiv),
+                    idx::gb::IdxGbRef<TDim, TSize>(m_gridBlockIdx),
+                    idx::bt::IdxBtRef<TDim, TSize>(m_blockThreadIdx),
+                    atomic::AtomicNoOp(),
+                    math::MathStl(),
+                    block::shared::BlockSharedAllocSimdLanes(),
+                    block::sync::BlockSyncSimdLanes<TSize>(workdiv::getWorkDiv<Block, Threads>(workDiv).prod()),
+                    rand::RandStl(),
+                    m_gridBlockIdx(Vec<TDim, TSize>::zeros()),
+                    m_blockThreadIdx(Vec<TDim, TSize>::zeros())
+            {}
+
+        public:
+            //-----------------------------------------------------------------------------
+            //! Copy constructor.
+            // Do not copy most members because they are initialized by the executor for each execution.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA AccCpuSimd(AccCpuSimd const &) = delete;
+            //-----------------------------------------------------------------------------
+            //! Move constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA AccCpuSimd(AccCpuSimd &&) = delete;
+            //-----------------------------------------------------------------------------
+            //! Copy assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA auto operator=(AccCpuSimd const &) -> AccCpuSimd & = delete;
+            //-----------------------------------------------------------------------------
+            //! Move assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA auto operator=(AccCpuSimd &&) -> AccCpuSimd & = delete;
+            //-----------------------------------------------------------------------------
+            //! Destructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~AccCpuSimd() = default;
+
+            //-----------------------------------------------------------------------------
+            //! \return The pointer to the externally allocated block shared memory.
+            //-----------------------------------------------------------------------------
+            template<
+                typename T>
+            ALPAKA_FN_ACC_NO_CUDA auto getBlockSharedExternMem() const
+            -> T *
+            {
+                return reinterpret_cast<T*>(m_externalSharedMem.get());
+            }
+
+        private:
+            // getIdx
+            alignas(16u) Vec<TDim, TSize> mutable m_gridBlockIdx;    //!< The index of the currently executed block.
+            alignas(16u) Vec<TDim, TSize> mutable m_blockThreadIdx;  //!< The index of the currently executed lane.
+
+            // getBlockSharedExternMem
+            std::unique_ptr<uint8_t, boost::alignment::aligned_delete> mutable m_externalSharedMem;  //!< External block shared memory.
+        };
+    }
+
+    namespace acc
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU SIMD lane accelerator accelerator type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct AccType<
+                acc::AccCpuSimd<TDim, TSize>>
+            {
+                using type = acc::AccCpuSimd<TDim, TSize>;
+            };
+            //#############################################################################
+            //! The CPU SIMD lane accelerator device properties get trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct GetAccDevProps<
+                acc::AccCpuSimd<TDim, TSize>>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getAccDevProps(
+                    dev::DevCpu const & dev)
+                -> acc::AccDevProps<TDim, TSize>
+                {
+                    boost::ignore_unused(dev);
+
+                    auto const blockThreadsCountMax(static_cast<TSize>(core::vectorization::GetVectorizationSizeElems<float>::value));
+
+                    return {
+                        // m_multiProcessorCount
+                        static_cast<TSize>(1),
+                        // m_blockThreadsCountMax
+                        blockThreadsCountMax,
+                        // m_blockThreadExtentsMax
+                        Vec<TDim, TSize>::all(blockThreadsCountMax),
+                        // m_gridBlockExtentsMax
+                        Vec<TDim, TSize>::all(std::numeric_limits<TSize>::max())};
+                }
+            };
+            //#############################################################################
+            //! The CPU SIMD lane accelerator name trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct GetAccName<
+                acc::AccCpuSimd<TDim, TSize>>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                ALPAKA_FN_HOST_ACC static auto getAccName()
+                -> std::string
+                {
+                    return "AccCpuSimd<" + std::to_string(TDim::value) + "," + typeid(TSize).name() + ">";
+                }
+            };
+        }
+    }
+    namespace dev
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU SIMD lane accelerator device type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct DevType<
+                acc::AccCpuSimd<TDim, TSize>>
+            {
+                using type = dev::DevCpu;
+            };
+            //#############################################################################
+            //! The CPU SIMD lane accelerator device type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct DevManType<
+                acc::AccCpuSimd<TDim, TSize>>
+            {
+                using type = dev::DevManCpu;
+            };
+        }
+    }
+    namespace dim
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU SIMD lane accelerator dimension getter trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct DimType<
+                acc::AccCpuSimd<TDim, TSize>>
+            {
+                using type = TDim;
+            };
+        }
+    }
+    namespace exec
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU SIMD lane accelerator executor type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct ExecType<
+                acc::AccCpuSimd<TDim, TSize>,
+                TKernelFnObj,
+                TArgs...>
+            {
+                using type = exec::ExecCpuSimd<TDim, TSize, TKernelFnObj, TArgs...>;
+            };
+        }
+    }
+    namespace size
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU SIMD lane accelerator size type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct SizeType<
+                acc::AccCpuSimd<TDim, TSize>>
+            {
+                using type = TSize;
+            };
+        }
+    }
+}
@@ -24,11 +24,11 @@
 // Base classes.
 #include <alpaka/workdiv/WorkDivMembers.hpp>        // workdiv::WorkDivMembers
 #include <alpaka/idx/gb/IdxGbRef.hpp>               // IdxGbRef
-#include <alpaka/idx/bt/IdxBtRefThreadIdMap.hpp>    // IdxBtRefThreadIdMap
+#include <alpaka/idx/bt/IdxBtThreadLocal.hpp>       // IdxBtThreadLocal
 #include <alpaka/atomic/AtomicStlLock.hpp>          // AtomicStlLock
 #include <alpaka/math/MathStl.hpp>                  // MathStl
 #include <alpaka/block/shared/BlockSharedAllocMasterSync.hpp>   // BlockSharedAllocMasterSync
-#include <alpaka/block/sync/BlockSyncThreadIdMapBarrier.hpp>    // BlockSyncThreadIdMapBarrier
+#include <alpaka/block/sync/BlockSyncBarrierThreadSpin.hpp>     // BlockSyncBarrierThreadSpin
 #include <alpaka/rand/RandStl.hpp>              // RandStl
 
 // Specialized traits.
@@ -73,11 +73,11 @@ namespace alpaka
         class AccCpuThreads final :
             public workdiv::WorkDivMembers<TDim, TSize>,
             public idx::gb::IdxGbRef<TDim, TSize>,
-            public idx::bt::IdxBtRefThreadIdMap<TDim, TSize>,
+            public idx::bt::IdxBtThreadLocal<TDim, TSize>,
             public atomic::AtomicStlLock,
             public math::MathStl,
             public block::shared::BlockSharedAllocMasterSync,
-            public block::sync::BlockSyncThreadIdMapBarrier<TSize>,
+            public block::sync::BlockSyncBarrierThreadSpin<TSize>,
             public rand::RandStl
         {
         public:
@@ -99,18 +99,16 @@ namespace alpaka
                 TWorkDiv const & workDiv) :
                     workdiv::WorkDivMembers<TDim, TSize>(workDiv),
                     idx::gb::IdxGbRef<TDim, TSize>(m_gridBlockIdx),
-                    idx::bt::IdxBtRefThreadIdMap<TDim, TSize>(m_threadsToIndices),
+                    idx::bt::IdxBtThreadLocal<TDim, TSize>(),
                     atomic::AtomicStlLock(),
                     math::MathStl(),
                     block::shared::BlockSharedAllocMasterSync(
                         [this](){block::sync::syncBlockThreads(*this);},
-                        [this](){return (m_idMasterThread == std::this_thread::get_id());}),
-                    block::sync::BlockSyncThreadIdMapBarrier<TSize>(
-                        m_threadsPerBlockCount,
-                        m_mThreadsToBarrier),
+                        [](){return (idx::bt::IdxBtThreadLocal<TDim, TSize>::threadLocalBlockThreadIdx().sum() == 0);}),
+                    block::sync::BlockSyncBarrierThreadSpin<TSize>(
+                        workdiv::getWorkDiv<Block, Threads>(workDiv).prod()),
                     rand::RandStl(),
-                    m_gridBlockIdx(Vec<TDim, TSize>::zeros()),
-                    m_threadsPerBlockCount(workdiv::getWorkDiv<Block, Threads>(workDiv).prod())
+                    m_gridBlockIdx(Vec<TDim, TSize>::zeros())
             {}
 
         public:
@@ -148,19 +146,8 @@ namespace alpaka
 
         private:
             // getIdx
-            std::mutex mutable m_mtxMapInsert;                              //!< The mutex used to secure insertion into the ThreadIdToIdxMap.
-            typename idx::bt::IdxBtRefThreadIdMap<TDim, TSize>::ThreadIdToIdxMap mutable m_threadsToIndices;    //!< The mapping of thread id's to indices.
             alignas(16u) Vec<TDim, TSize> mutable m_gridBlockIdx;           //!< The index of the currently executed block.
 
-            // syncBlockThreads
-            TSize const m_threadsPerBlockCount;                             //!< The number of threads per block the barrier has to wait for.
-            std::map<
-                std::thread::id,
-                TSize> mutable m_mThreadsToBarrier;                         //!< The mapping of thread id's to their current barrier.
-
-            // allocBlockSharedArr
-            std::thread::id mutable m_idMasterThread;                       //!< The id of the master thread.
-
             // getBlockSharedExternMem
             std::unique_ptr<uint8_t, boost::alignment::aligned_delete> mutable m_externalSharedMem;      //!< External block shared memory.
         };
@@ -208,7 +195,8 @@ namespace alpaka
 #endif
                     return {
                         // m_multiProcessorCount
-                        static_cast<TSize>(1),
+                        // The executor runs as many blocks concurrently as there are cores for all of their threads.
+                        std::max(static_cast<TSize>(1), static_cast<TSize>(std::thread::hardware_concurrency())),
                         // m_blockThreadsCountMax
                         blockThreadsCountMax,
                         // m_blockThreadExtentsMax
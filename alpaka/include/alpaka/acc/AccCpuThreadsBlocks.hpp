@@ -0,0 +1,302 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Base classes.
+#include <alpaka/workdiv/WorkDivMembers.hpp>    // workdiv::WorkDivMembers
+#include <alpaka/idx/gb/IdxGbRef.hpp>           // IdxGbRef
+#include <alpaka/idx/bt/IdxBtZero.hpp>          // IdxBtZero
+#include <alpaka/atomic/AtomicStlLock.hpp>      // AtomicStlLock
+#include <alpaka/math/MathStl.hpp>              // MathStl
+#include <alpaka/block/shared/BlockSharedAllocNoSync.hpp>  // BlockSharedAllocNoSync
+#include <alpaka/block/sync/BlockSyncNoOp.hpp>  // BlockSyncNoOp
+#include <alpaka/rand/RandStl.hpp>              // RandStl
+
+// Specialized traits.
+#include <alpaka/acc/Traits.hpp>                // acc::traits::AccType
+#include <alpaka/dev/Traits.hpp>                // dev::traits::DevType
+#include <alpaka/exec/Traits.hpp>               // exec::traits::ExecType
+#include <alpaka/size/Traits.hpp>               // size::traits::SizeType
+
+// Implementation details.
+#include <alpaka/dev/DevCpu.hpp>                // dev::DevCpu
+
+#include <boost/core/ignore_unused.hpp>         // boost::ignore_unused
+
+#include <algorithm>                            // std::max
+#include <memory>                               // std::unique_ptr
+#include <thread>                               // std::thread
+#include <typeinfo>                             // typeid
+
+namespace alpaka
+{
+    namespace exec
+    {
+        template<
+            typename TDim,
+            typename TSize,
+            typename TKernelFnObj,
+            typename... TArgs>
+        class ExecCpuThreadsBlocks;
+    }
+    namespace acc
+    {
+        //#############################################################################
+        //! The CPU threads block accelerator.
+        //!
+        //! This accelerator allows parallel kernel execution on a CPU device.
+        //! It uses the worker threads of the device to implement the grid block parallelism.
+        //! The distribution of the blocks onto the threads can be selected per launch by an exec::Schedule.
+        //! The block size is restricted to 1x1x1.
+        //#############################################################################
+        template<
+            typename TDim,
+            typename TSize>
+        class AccCpuThreadsBlocks final :
+            public workdiv::WorkDivMembers<TDim, TSize>,
+            public idx::gb::IdxGbRef<TDim, TSize>,
+            public idx::bt::IdxBtZero<TDim, TSize>,
+            public atomic::AtomicStlLock,
+            public math::MathStl,
+            public block::shared::BlockSharedAllocNoSync,
+            public block::sync::BlockSyncNoOp,
+            public rand::RandStl
+        {
+        public:
+            // Partial specialization with the correct TDim and TSize is not allowed.
+            template<
+                typename TDim2,
+                typename TSize2,
+                typename TKernelFnObj,
+                typename... TArgs>
+            friend class ::alpaka::exec::ExecCpuThreadsBlocks;
+
+        private:
+            //-----------------------------------------------------------------------------
+            //! Constructor.
+            //-----------------------------------------------------------------------------
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_ACC_NO_CUDA AccCpuThreadsBlocks(
+                TWorkDiv const & workDiv) :
+                    workdiv::WorkDivMembers<TDim, TSize>(workDiv),
+                    idx::gb::IdxGbRef<TDim, TSize>(m_gridBlockIdx),
+                    idx::bt::IdxBtZero<TDim, TSize>(),
+                    atomic::AtomicStlLock(),
+                    math::MathStl(),
+                    block::shared::BlockSharedAllocNoSync(),
+                    block::sync::BlockSyncNoOp(),
+                    rand::RandStl(),
+                    m_gridBlockIdx(Vec<TDim, TSize>::zeros())
+            {}
+
+        public:
+            //-----------------------------------------------------------------------------
+            //! Copy constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA AccCpuThreadsBlocks(AccCpuThreadsBlocks const &) = delete;
+            //-----------------------------------------------------------------------------
+            //! Move constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA AccCpuThreadsBlocks(AccCpuThreadsBlocks &&) = delete;
+            //-----------------------------------------------------------------------------
+            //! Copy assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA auto operator=(AccCpuThreadsBlocks const &) -> AccCpuThreadsBlocks & = delete;
+            //-----------------------------------------------------------------------------
+            //! Move assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA auto operator=(AccCpuThreadsBlocks &&) -> AccCpuThreadsBlocks & = delete;
+            //-----------------------------------------------------------------------------
+            //! Destructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~AccCpuThreadsBlocks() = default;
+
+            //-----------------------------------------------------------------------------
+            //! \return The pointer to the externally allocated block shared memory.
+            //-----------------------------------------------------------------------------
+            template<
+                typename T>
+            ALPAKA_FN_ACC_NO_CUDA auto getBlockSharedExternMem() const
+            -> T *
+            {
+                return reinterpret_cast<T*>(m_externalSharedMem.get());
+            }
+
+        private:
+            // getIdx
+            alignas(16u) Vec<TDim, TSize> mutable m_gridBlockIdx;    //!< The index of the currently executed block.
+
+            // getBlockSharedExternMem
+            std::unique_ptr<uint8_t, boost::alignment::aligned_delete> mutable m_externalSharedMem;  //!< External block shared memory.
+        };
+    }
+
+    namespace acc
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads block accelerator accelerator type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct AccType<
+                acc::AccCpuThreadsBlocks<TDim, TSize>>
+            {
+                using type = acc::AccCpuThreadsBlocks<TDim, TSize>;
+            };
+            //#############################################################################
+            //! The CPU threads block accelerator device properties get trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct GetAccDevProps<
+                acc::AccCpuThreadsBlocks<TDim, TSize>>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getAccDevProps(
+                    dev::DevCpu const & dev)
+                -> alpaka::acc::AccDevProps<TDim, TSize>
+                {
+                    boost::ignore_unused(dev);
+
+                    return {
+                        // m_multiProcessorCount
+                        std::max(static_cast<TSize>(1), static_cast<TSize>(std::thread::hardware_concurrency())),
+                        // m_blockThreadsCountMax
+                        static_cast<TSize>(1),
+                        // m_blockThreadExtentsMax
+                        Vec<TDim, TSize>::ones(),
+                        // m_gridBlockExtentsMax
+                        Vec<TDim, TSize>::all(std::numeric_limits<TSize>::max())};
+                }
+            };
+            //#############################################################################
+            //! The CPU threads block accelerator name trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct GetAccName<
+                acc::AccCpuThreadsBlocks<TDim, TSize>>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                ALPAKA_FN_HOST_ACC static auto getAccName()
+                -> std::string
+                {
+                    return "AccCpuThreadsBlocks<" + std::to_string(TDim::value) + "," + typeid(TSize).name() + ">";
+                }
+            };
+        }
+    }
+    namespace dev
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads block accelerator device type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct DevType<
+                acc::AccCpuThreadsBlocks<TDim, TSize>>
+            {
+                using type = dev::DevCpu;
+            };
+            //#############################################################################
+            //! The CPU threads block accelerator device type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct DevManType<
+                acc::AccCpuThreadsBlocks<TDim, TSize>>
+            {
+                using type = dev::DevManCpu;
+            };
+        }
+    }
+    namespace dim
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads block accelerator dimension getter trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct DimType<
+                acc::AccCpuThreadsBlocks<TDim, TSize>>
+            {
+                using type = TDim;
+            };
+        }
+    }
+    namespace exec
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads block accelerator executor type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct ExecType<
+                acc::AccCpuThreadsBlocks<TDim, TSize>,
+                TKernelFnObj,
+                TArgs...>
+            {
+                using type = exec::ExecCpuThreadsBlocks<TDim, TSize, TKernelFnObj, TArgs...>;
+            };
+        }
+    }
+    namespace size
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads block accelerator size type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct SizeType<
+                acc::AccCpuThreadsBlocks<TDim, TSize>>
+            {
+                using type = TSize;
+            };
+        }
+    }
+}
@@ -41,10 +41,18 @@
     #include <alpaka/acc/AccCpuSerial.hpp>
     #include <alpaka/exec/ExecCpuSerial.hpp>
 #endif
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_SIMD_ENABLED
+    #include <alpaka/acc/AccCpuSimd.hpp>
+    #include <alpaka/exec/ExecCpuSimd.hpp>
+#endif
 #ifdef ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED
     #include <alpaka/acc/AccCpuThreads.hpp>
     #include <alpaka/exec/ExecCpuThreads.hpp>
 #endif
+#ifdef ALPAKA_ACC_CPU_B_THREADS_T_SEQ_ENABLED
+    #include <alpaka/acc/AccCpuThreadsBlocks.hpp>
+    #include <alpaka/exec/ExecCpuThreadsBlocks.hpp>
+#endif
 #ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
     #include <alpaka/acc/AccCpuFibers.hpp>
     #include <alpaka/exec/ExecCpuFibers.hpp>
@@ -102,24 +110,26 @@
     #endif
     #include <alpaka/block/shared/BlockSharedAllocMasterSync.hpp>
     #include <alpaka/block/shared/BlockSharedAllocNoSync.hpp>
+    #include <alpaka/block/shared/BlockSharedAllocSimdLanes.hpp>
     #include <alpaka/block/shared/Traits.hpp>
 
     //-----------------------------------------------------------------------------
     // sync
     //-----------------------------------------------------------------------------
+    #ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
+        #include <alpaka/block/sync/BlockSyncBarrierFiber.hpp>
+    #endif
+    #ifdef ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED
+        #include <alpaka/block/sync/BlockSyncBarrierThreadSpin.hpp>
+    #endif
     #if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) && defined(__CUDACC__)
         #include <alpaka/block/sync/BlockSyncCudaBuiltIn.hpp>
     #endif
-    #ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
-        #include <alpaka/block/sync/BlockSyncFiberIdMapBarrier.hpp>
-    #endif
     #include <alpaka/block/sync/BlockSyncNoOp.hpp>
     #ifdef _OPENMP
         #include <alpaka/block/sync/BlockSyncOmpBarrier.hpp>
     #endif
-    #ifdef ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED
-        #include <alpaka/block/sync/BlockSyncThreadIdMapBarrier.hpp>
-    #endif
+    #include <alpaka/block/sync/BlockSyncSimdLanes.hpp>
     #include <alpaka/block/sync/Traits.hpp>
 
 //-----------------------------------------------------------------------------
@@ -157,20 +167,27 @@
 //-----------------------------------------------------------------------------
 #include <alpaka/extent/Traits.hpp>
 
+//-----------------------------------------------------------------------------
+// graph
+//-----------------------------------------------------------------------------
+#include <alpaka/graph/GraphCpu.hpp>
+#include <alpaka/graph/Traits.hpp>
+
 //-----------------------------------------------------------------------------
 // idx
 //-----------------------------------------------------------------------------
 #if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) && defined(__CUDACC__)
     #include <alpaka/idx/bt/IdxBtCudaBuiltIn.hpp>
 #endif
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
+    #include <alpaka/idx/bt/IdxBtFiberLocal.hpp>
+#endif
 #ifdef _OPENMP
     #include <alpaka/idx/bt/IdxBtOmp.hpp>
 #endif
-#ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
-    #include <alpaka/idx/bt/IdxBtRefFiberIdMap.hpp>
-#endif
+#include <alpaka/idx/bt/IdxBtRef.hpp>
 #ifdef ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLED
-    #include <alpaka/idx/bt/IdxBtRefThreadIdMap.hpp>
+    #include <alpaka/idx/bt/IdxBtThreadLocal.hpp>
 #endif
 #include <alpaka/idx/bt/IdxBtZero.hpp>
 #if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) && defined(__CUDACC__)
@@ -196,6 +213,8 @@
 // mem
 //-----------------------------------------------------------------------------
 #include <alpaka/mem/alloc/AllocCpuBoostAligned.hpp>
+#include <alpaka/mem/alloc/AllocCpuCaching.hpp>
+#include <alpaka/mem/alloc/AllocCpuHugePages.hpp>
 #include <alpaka/mem/alloc/AllocCpuNew.hpp>
 #include <alpaka/mem/alloc/Traits.hpp>
 
@@ -237,6 +256,7 @@
     #include <alpaka/stream/StreamCudaRtSync.hpp>
 #endif
 #include <alpaka/stream/StreamCpuAsync.hpp>
+#include <alpaka/stream/StreamCpuParallel.hpp>
 #include <alpaka/stream/StreamCpuSync.hpp>
 #include <alpaka/stream/Traits.hpp>
 
@@ -23,6 +23,8 @@
 
 #include <alpaka/atomic/Traits.hpp>                 // AtomicOp
 
+#include <boost/core/ignore_unused.hpp>             // boost::ignore_unused
+
 #include <mutex>                                    // std::mutex, std::lock_guard
 
 namespace alpaka
@@ -70,7 +72,16 @@ namespace alpaka
             ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~AtomicStlLock() = default;
 
         private:
-            std::mutex mutable m_mtxAtomic; //!< The mutex protecting access for a atomic operation.
+            //-----------------------------------------------------------------------------
+            //! \return The mutex protecting access for a atomic operation.
+            //! It is shared by all accelerator instances because blocks executed concurrently own distinct accelerators.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_ACC_NO_CUDA static auto getMtxAtomic()
+            -> std::mutex &
+            {
+                static std::mutex mtxAtomic;
+                return mtxAtomic;
+            }
         };
 
         namespace traits
@@ -97,7 +108,8 @@ namespace alpaka
                 {
                     // \TODO: Currently not only the access to the same memory location is protected by a mutex but all atomic ops on all threads.
                     // We could use a list of mutexes and lock the mutex depending on the target memory location to allow multiple atomic ops on different targets concurrently.
-                    std::lock_guard<std::mutex> lock(atomic.m_mtxAtomic);
+                    boost::ignore_unused(atomic);
+                    std::lock_guard<std::mutex> lock(atomic::AtomicStlLock::getMtxAtomic());
                     return TOp()(addr, value);
                 }
             };
@@ -0,0 +1,187 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/block/shared/Traits.hpp>   // AllocVar, AllocArr
+
+#include <alpaka/core/Common.hpp>           // ALPAKA_FN_ACC_NO_CUDA
+
+#include <boost/align.hpp>                  // boost::aligned_alloc
+
+#include <cassert>                          // assert
+#include <vector>                           // std::vector
+#include <memory>                           // std::unique_ptr
+
+namespace alpaka
+{
+    namespace block
+    {
+        namespace shared
+        {
+            //#############################################################################
+            //! The block shared memory allocator for block threads executed as lanes of a single loop.
+            //!
+            //! The first lane of a block allocates the memory.
+            //! The following lanes get the memory of the allocation with the same position in their call sequence, so all lanes of a block share one allocation.
+            //! The executor has to call beginLane before each lane.
+            //#############################################################################
+            class BlockSharedAllocSimdLanes
+            {
+            public:
+                using BlockSharedAllocBase = BlockSharedAllocSimdLanes;
+
+                //-----------------------------------------------------------------------------
+                //! Default constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BlockSharedAllocSimdLanes() = default;
+                //-----------------------------------------------------------------------------
+                //! Copy constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BlockSharedAllocSimdLanes(BlockSharedAllocSimdLanes const &) = delete;
+                //-----------------------------------------------------------------------------
+                //! Move constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BlockSharedAllocSimdLanes(BlockSharedAllocSimdLanes &&) = delete;
+                //-----------------------------------------------------------------------------
+                //! Copy assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(BlockSharedAllocSimdLanes const &) -> BlockSharedAllocSimdLanes & = delete;
+                //-----------------------------------------------------------------------------
+                //! Move assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(BlockSharedAllocSimdLanes &&) -> BlockSharedAllocSimdLanes & = delete;
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~BlockSharedAllocSimdLanes() = default;
+
+                //-----------------------------------------------------------------------------
+                //! Restarts the call sequence for the next lane of the block.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto beginLane() const
+                -> void
+                {
+                    m_laneAllocIdx = 0u;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The memory of the next allocation of the current lane.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto nextAlloc(
+                    std::size_t const & sizeBytes) const
+                -> uint8_t *
+                {
+                    if(m_laneAllocIdx == m_sharedAllocs.size())
+                    {
+                        m_sharedAllocs.emplace_back(
+                            reinterpret_cast<uint8_t *>(
+                                boost::alignment::aligned_alloc(16u, sizeBytes)));
+                        m_sharedAllocSizes.emplace_back(sizeBytes);
+                    }
+                    // All lanes have to allocate the same sequence of variables.
+                    assert(m_sharedAllocSizes[m_laneAllocIdx] == sizeBytes);
+                    return m_sharedAllocs[m_laneAllocIdx++].get();
+                }
+
+            public:
+                std::vector<
+                    std::unique_ptr<
+                        uint8_t,
+                        boost::alignment::aligned_delete>> mutable
+                    m_sharedAllocs;                                 //!< Block shared memory.
+                std::vector<std::size_t> mutable m_sharedAllocSizes;  //!< The sizes of the block shared memory allocations.
+                std::size_t mutable m_laneAllocIdx = 0u;            //!< The position of the next allocation in the call sequence of the current lane.
+            };
+
+            namespace traits
+            {
+                //#############################################################################
+                //!
+                //#############################################################################
+                template<
+                    typename T>
+                struct AllocVar<
+                    T,
+                    BlockSharedAllocSimdLanes>
+                {
+                    //-----------------------------------------------------------------------------
+                    //
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_ACC_NO_CUDA static auto allocVar(
+                        block::shared::BlockSharedAllocSimdLanes const & blockSharedAlloc)
+                    -> T &
+                    {
+                        return
+                            std::ref(
+                                *reinterpret_cast<T*>(
+                                    blockSharedAlloc.nextAlloc(sizeof(T))));
+                    }
+                };
+                //#############################################################################
+                //!
+                //#############################################################################
+                template<
+                    typename T,
+                    std::size_t TnumElements>
+                struct AllocArr<
+                    T,
+                    TnumElements,
+                    BlockSharedAllocSimdLanes>
+                {
+                    static_assert(
+                        TnumElements > 0,
+                        "The number of elements to allocate in block shared memory must not be zero!");
+
+                    //-----------------------------------------------------------------------------
+                    //
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_ACC_NO_CUDA static auto allocArr(
+                        block::shared::BlockSharedAllocSimdLanes const & blockSharedAlloc)
+                    -> T *
+                    {
+                        return
+                            reinterpret_cast<T*>(
+                                blockSharedAlloc.nextAlloc(sizeof(T) * TnumElements));
+                    }
+                };
+                //#############################################################################
+                //!
+                //#############################################################################
+                template<>
+                struct FreeMem<
+                    BlockSharedAllocSimdLanes>
+                {
+                    //-----------------------------------------------------------------------------
+                    //
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_ACC_NO_CUDA static auto freeMem(
+                        block::shared::BlockSharedAllocSimdLanes const & blockSharedAlloc)
+                    -> void
+                    {
+                        blockSharedAlloc.m_sharedAllocs.clear();
+                        blockSharedAlloc.m_sharedAllocSizes.clear();
+                        blockSharedAlloc.m_laneAllocIdx = 0u;
+                    }
+                };
+            }
+        }
+    }
+}
@@ -24,12 +24,10 @@
 #include <alpaka/block/sync/Traits.hpp> // SyncBlockThreads
 
 #include <alpaka/core/BarrierFiber.hpp> // BarrierFibers
+#include <alpaka/core/Fibers.hpp>       // boost::fibers::fiber_specific_ptr
 
 #include <alpaka/core/Common.hpp>       // ALPAKA_FN_ACC
 
-#include <mutex>                        // std::mutex
-#include <map>                          // std::map
-
 namespace alpaka
 {
     namespace block
@@ -37,59 +35,72 @@ namespace alpaka
         namespace sync
         {
             //#############################################################################
-            //! The thread id map barrier block synchronization.
+            //! The fiber barrier block synchronization.
+            //!
+            //! Every fiber stores the number of barriers it has passed in fiber local storage.
             //#############################################################################
             template<
                 typename TSize>
-            class BlockSyncFiberIdMapBarrier
+            class BlockSyncBarrierFiber
             {
             public:
-                using BlockSyncBase = BlockSyncFiberIdMapBarrier;
+                using BlockSyncBase = BlockSyncBarrierFiber;
 
                 using Barrier = core::fibers::BarrierFiber<TSize>;
-                using ThreadIdToBarrierIdxMap = std::map<boost::fibers::fiber::id, TSize>;
-                using ThreadIdToBarrierIdxMapIterator = typename ThreadIdToBarrierIdxMap::iterator;
 
                 //-----------------------------------------------------------------------------
                 //! Default constructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA BlockSyncFiberIdMapBarrier(
-                    TSize const & numThreadsPerBlock,
-                    ThreadIdToBarrierIdxMap & threadIdToBarrierIdxMap) :
-                        m_threadsPerBlockCount(numThreadsPerBlock),
-                        m_threadIdToBarrierIdxMap(threadIdToBarrierIdxMap)
+                ALPAKA_FN_ACC_NO_CUDA BlockSyncBarrierFiber(
+                    TSize const & numThreadsPerBlock) :
+                        m_threadsPerBlockCount(numThreadsPerBlock)
                 {}
                 //-----------------------------------------------------------------------------
                 //! Copy constructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA BlockSyncFiberIdMapBarrier(BlockSyncFiberIdMapBarrier const &) = delete;
+                ALPAKA_FN_ACC_NO_CUDA BlockSyncBarrierFiber(BlockSyncBarrierFiber const &) = delete;
                 //-----------------------------------------------------------------------------
                 //! Move constructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA BlockSyncFiberIdMapBarrier(BlockSyncFiberIdMapBarrier &&) = delete;
+                ALPAKA_FN_ACC_NO_CUDA BlockSyncBarrierFiber(BlockSyncBarrierFiber &&) = delete;
                 //-----------------------------------------------------------------------------
                 //! Copy assignment operator.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA auto operator=(BlockSyncFiberIdMapBarrier const &) -> BlockSyncFiberIdMapBarrier & = delete;
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(BlockSyncBarrierFiber const &) -> BlockSyncBarrierFiber & = delete;
                 //-----------------------------------------------------------------------------
                 //! Move assignment operator.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA auto operator=(BlockSyncFiberIdMapBarrier &&) -> BlockSyncFiberIdMapBarrier & = delete;
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(BlockSyncBarrierFiber &&) -> BlockSyncBarrierFiber & = delete;
                 //-----------------------------------------------------------------------------
                 //! Destructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~BlockSyncFiberIdMapBarrier() = default;
+                ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~BlockSyncBarrierFiber() = default;
+
+                //-----------------------------------------------------------------------------
+                //! \return The number of barriers the calling fiber has passed in its current block thread.
+                //! It has to be reset by the executor before the kernel is invoked on this fiber.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA static auto fiberLocalBarrierIdx()
+                -> TSize &
+                {
+                    // The slot is allocated on the first use by a fiber and deleted when the fiber ends.
+                    static boost::fibers::fiber_specific_ptr<TSize> spBarrierIdx;
+                    auto * pBarrierIdx(spBarrierIdx.get());
+                    if(!pBarrierIdx)
+                    {
+                        pBarrierIdx = new TSize(0u);
+                        spBarrierIdx.reset(pBarrierIdx);
+                    }
+                    return *pBarrierIdx;
+                }
 
                 //-----------------------------------------------------------------------------
                 //! Syncs all threads in the current block.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA auto syncBlockThreads(
-                    ThreadIdToBarrierIdxMapIterator const & itFind) const
+                ALPAKA_FN_ACC_NO_CUDA auto syncBlockThreads() const
                 -> void
                 {
-                    assert(itFind != m_threadIdToBarrierIdxMap.end());
-
-                    auto & barrierIdx(itFind->second);
+                    auto & barrierIdx(fiberLocalBarrierIdx());
                     TSize const modBarrierIdx(barrierIdx % 2);
 
                     auto & bar(m_barriers[modBarrierIdx]);
@@ -109,7 +120,6 @@ namespace alpaka
 
                 TSize const & m_threadsPerBlockCount;           //!< The number of threads per block the barrier has to wait for.
 
-                ThreadIdToBarrierIdxMap & m_threadIdToBarrierIdxMap;
                 //!< We have to keep the current and the last barrier because one of the threads can reach the next barrier before a other thread was wakeup from the last one and has checked if it can run.
                 Barrier mutable m_barriers[2];           //!< The barriers for the synchronization of threads.
             };
@@ -122,18 +132,16 @@ namespace alpaka
                 template<
                     typename TSize>
                 struct SyncBlockThreads<
-                    BlockSyncFiberIdMapBarrier<TSize>>
+                    BlockSyncBarrierFiber<TSize>>
                 {
                     //-----------------------------------------------------------------------------
                     //
                     //-----------------------------------------------------------------------------
                     ALPAKA_FN_ACC_NO_CUDA static auto syncBlockThreads(
-                        block::sync::BlockSyncFiberIdMapBarrier<TSize> const & blockSync)
+                        block::sync::BlockSyncBarrierFiber<TSize> const & blockSync)
                     -> void
                     {
-                        auto const threadId(boost::this_fiber::get_id());
-                        typename block::sync::BlockSyncFiberIdMapBarrier<TSize>::ThreadIdToBarrierIdxMapIterator const itFind(blockSync.m_threadIdToBarrierIdxMap.find(threadId));
-                        blockSync.syncBlockThreads(itFind);
+                        blockSync.syncBlockThreads();
                     }
                 };
             }
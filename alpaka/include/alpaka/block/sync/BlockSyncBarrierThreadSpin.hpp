@@ -0,0 +1,115 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/block/sync/Traits.hpp>       // SyncBlockThreads
+
+#include <alpaka/core/BarrierThreadSpin.hpp>  // BarrierThreadSpin
+
+#include <alpaka/core/Common.hpp>             // ALPAKA_FN_ACC
+
+namespace alpaka
+{
+    namespace block
+    {
+        namespace sync
+        {
+            //#############################################################################
+            //! The spinning barrier block synchronization.
+            //!
+            //! A single sense-reversing barrier is reused for all syncs of a block.
+            //#############################################################################
+            template<
+                typename TSize>
+            class BlockSyncBarrierThreadSpin
+            {
+            public:
+                using BlockSyncBase = BlockSyncBarrierThreadSpin;
+
+                using Barrier = core::threads::BarrierThreadSpin<TSize>;
+
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //!
+                //! \param numThreadsPerBlock The number of threads of a block taking part in each synchronization.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BlockSyncBarrierThreadSpin(
+                    TSize const & numThreadsPerBlock) :
+                        m_barrier(numThreadsPerBlock)
+                {}
+                //-----------------------------------------------------------------------------
+                //! Copy constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BlockSyncBarrierThreadSpin(BlockSyncBarrierThreadSpin const &) = delete;
+                //-----------------------------------------------------------------------------
+                //! Move constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BlockSyncBarrierThreadSpin(BlockSyncBarrierThreadSpin &&) = delete;
+                //-----------------------------------------------------------------------------
+                //! Copy assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(BlockSyncBarrierThreadSpin const &) -> BlockSyncBarrierThreadSpin & = delete;
+                //-----------------------------------------------------------------------------
+                //! Move assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(BlockSyncBarrierThreadSpin &&) -> BlockSyncBarrierThreadSpin & = delete;
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~BlockSyncBarrierThreadSpin() = default;
+
+                //-----------------------------------------------------------------------------
+                //! Syncs all threads in the current block.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto syncBlockThreads() const
+                -> void
+                {
+                    m_barrier.wait();
+                }
+
+                Barrier mutable m_barrier;          //!< The barrier for the synchronization of threads.
+            };
+
+            namespace traits
+            {
+                //#############################################################################
+                //!
+                //#############################################################################
+                template<
+                    typename TSize>
+                struct SyncBlockThreads<
+                    BlockSyncBarrierThreadSpin<TSize>>
+                {
+                    //-----------------------------------------------------------------------------
+                    //
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_ACC_NO_CUDA static auto syncBlockThreads(
+                        block::sync::BlockSyncBarrierThreadSpin<TSize> const & blockSync)
+                    -> void
+                    {
+                        blockSync.syncBlockThreads();
+                    }
+                };
+            }
+        }
+    }
+}
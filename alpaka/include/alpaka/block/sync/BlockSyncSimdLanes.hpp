@@ -0,0 +1,109 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/block/sync/Traits.hpp> // SyncBlockThreads
+
+#include <alpaka/core/Common.hpp>       // ALPAKA_FN_ACC_NO_CUDA
+
+#include <stdexcept>                    // std::logic_error
+
+namespace alpaka
+{
+    namespace block
+    {
+        namespace sync
+        {
+            //#############################################################################
+            //! The block synchronization of block threads executed as lanes of a single loop.
+            //!
+            //! The lanes are executed one after another by the same thread.
+            //! A lane can not wait for the following lanes, so synchronization is only possible if there is a single lane.
+            //! syncBlockThreads throws std::logic_error for blocks with more than one lane instead of silently not synchronizing.
+            //#############################################################################
+            template<
+                typename TSize>
+            class BlockSyncSimdLanes
+            {
+            public:
+                using BlockSyncBase = BlockSyncSimdLanes;
+
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BlockSyncSimdLanes(
+                    TSize const & numLanes) :
+                        m_numLanes(numLanes)
+                {}
+                //-----------------------------------------------------------------------------
+                //! Copy constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BlockSyncSimdLanes(BlockSyncSimdLanes const &) = delete;
+                //-----------------------------------------------------------------------------
+                //! Move constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BlockSyncSimdLanes(BlockSyncSimdLanes &&) = delete;
+                //-----------------------------------------------------------------------------
+                //! Copy assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(BlockSyncSimdLanes const &) -> BlockSyncSimdLanes & = delete;
+                //-----------------------------------------------------------------------------
+                //! Move assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(BlockSyncSimdLanes &&) -> BlockSyncSimdLanes & = delete;
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~BlockSyncSimdLanes() = default;
+
+            public:
+                TSize const m_numLanes;
+            };
+
+            namespace traits
+            {
+                //#############################################################################
+                //!
+                //#############################################################################
+                template<
+                    typename TSize>
+                struct SyncBlockThreads<
+                    BlockSyncSimdLanes<TSize>>
+                {
+                    //-----------------------------------------------------------------------------
+                    //
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_ACC_NO_CUDA static auto syncBlockThreads(
+                        block::sync::BlockSyncSimdLanes<TSize> const & blockSync)
+                    -> void
+                    {
+                        // A single lane is trivially synchronized.
+                        if(blockSync.m_numLanes > static_cast<TSize>(1u))
+                        {
+                            throw std::logic_error("syncBlockThreads is not supported for blocks with more than one thread executed as SIMD lanes!");
+                        }
+                    }
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>   // ALPAKA_FN_ACC_NO_CUDA
+
+#include <atomic>                   // std::atomic
+#include <condition_variable>       // std::condition_variable
+#include <mutex>                    // std::mutex
+#include <thread>                   // std::thread::hardware_concurrency
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace threads
+        {
+            //#############################################################################
+            //! A reusable sense-reversing barrier that spins before it parks the waiting threads.
+            //!
+            //! The last thread reaching the barrier resets the counter and flips the global sense.
+            //! All other threads spin on the sense for a bounded number of iterations and then sleep on a condition variable.
+            //! The mutex is only taken if a thread had to be parked, so a barrier with all threads arriving in time is lock free.
+            //! Because the counter is reset before the sense is flipped, the barrier can be reused immediately and no second barrier is required.
+            //#############################################################################
+            template<
+                typename TSize>
+            class BarrierThreadSpin final
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //!
+                //! \param numThreads The number of threads taking part in each barrier.
+                //! \param spinCount The number of sense checks before a thread is parked.
+                //!  If there are more threads than hardware threads spinning only delays the thread that has to arrive, so the default does not spin at all in this case.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA explicit BarrierThreadSpin(
+                    TSize const & numThreads,
+                    std::size_t const & spinCount = defaultSpinCount()) :
+                        m_numThreads(numThreads),
+                        m_spinCount(
+                            (static_cast<std::size_t>(numThreads) <= std::thread::hardware_concurrency())
+                            ? spinCount
+                            : static_cast<std::size_t>(0u)),
+                        m_numThreadsToWaitFor(numThreads),
+                        m_sense(false),
+                        m_numThreadsParked(0u)
+                {}
+                //-----------------------------------------------------------------------------
+                //! Copy constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BarrierThreadSpin(BarrierThreadSpin const &) = delete;
+                //-----------------------------------------------------------------------------
+                //! Move constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA BarrierThreadSpin(BarrierThreadSpin &&) = delete;
+                //-----------------------------------------------------------------------------
+                //! Copy assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(BarrierThreadSpin const &) -> BarrierThreadSpin & = delete;
+                //-----------------------------------------------------------------------------
+                //! Move assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(BarrierThreadSpin &&) -> BarrierThreadSpin & = delete;
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA ~BarrierThreadSpin() = default;
+
+                //-----------------------------------------------------------------------------
+                //! \return The number of sense checks used by default before a thread is parked.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA static auto defaultSpinCount()
+                -> std::size_t
+                {
+                    return static_cast<std::size_t>(1u) << 12u;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Waits for all the other threads to reach the barrier.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto wait()
+                -> void
+                {
+                    // A thread can only arrive after the previous barrier has been released, so the sense it waits for is the opposite of the current one.
+                    bool const localSense(!m_sense.load(std::memory_order_relaxed));
+
+                    if(m_numThreadsToWaitFor.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+                    {
+                        m_numThreadsToWaitFor.store(m_numThreads, std::memory_order_relaxed);
+                        m_sense.store(localSense, std::memory_order_seq_cst);
+
+                        // Parked threads increment the counter before they check the sense, so either they see the new sense or we see them.
+                        if(m_numThreadsParked.load(std::memory_order_seq_cst) > 0u)
+                        {
+                            {
+                                std::lock_guard<std::mutex> lock(m_mtxPark);
+                            }
+                            m_cvPark.notify_all();
+                        }
+                    }
+                    else
+                    {
+                        for(std::size_t i(0u); i < m_spinCount; ++i)
+                        {
+                            if(m_sense.load(std::memory_order_acquire) == localSense)
+                            {
+                                return;
+                            }
+                        }
+
+                        std::unique_lock<std::mutex> lock(m_mtxPark);
+                        m_numThreadsParked.fetch_add(1u, std::memory_order_seq_cst);
+                        m_cvPark.wait(lock, [this, localSense] { return m_sense.load(std::memory_order_seq_cst) == localSense; });
+                        m_numThreadsParked.fetch_sub(1u, std::memory_order_relaxed);
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return The number of threads taking part in each barrier.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto getNumThreads() const
+                -> TSize
+                {
+                    return m_numThreads;
+                }
+
+            private:
+                TSize const m_numThreads;
+                std::size_t const m_spinCount;
+
+                std::atomic<TSize> m_numThreadsToWaitFor;
+                std::atomic<bool> m_sense;
+
+                std::atomic<std::size_t> m_numThreadsParked;
+                std::mutex m_mtxPark;
+                std::condition_variable m_cvPark;
+            };
+        }
+    }
+}
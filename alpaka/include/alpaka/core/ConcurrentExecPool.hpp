@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <alpaka/core/RingQueue.hpp>   // core::detail::RingQueue
+
 #include <boost/predef.h>   // workarounds
 #include <boost/version.hpp>// workarounds
 
@@ -42,12 +44,19 @@
     #endif
 #endif
 
+#include <algorithm>        // std::any_of
 #include <stdexcept>        // std::current_exception
 #include <vector>           // std::vector
 #include <exception>        // std::runtime_error
-#include <utility>          // std::forward
+#include <utility>          // std::forward, std::declval
 #include <atomic>           // std::atomic
 #include <future>           // std::future
+#include <memory>           // std::unique_ptr
+#include <limits>           // std::numeric_limits
+#include <mutex>            // std::unique_lock
+#include <new>              // placement new
+#include <thread>           // std::this_thread::yield, std::this_thread::get_id
+#include <type_traits>      // std::aligned_storage, std::decay, std::integral_constant
 
 namespace alpaka
 {
@@ -81,14 +90,17 @@ namespace alpaka
                 }
                 //-----------------------------------------------------------------------------
                 //! Pushes the given value onto the back of the queue.
+                //!
+                //! \return true because the queue grows as required.
                 //-----------------------------------------------------------------------------
                 auto push(
                     T const & t)
-                -> void
+                -> bool
                 {
                     std::lock_guard<std::mutex> lk(m_Mutex);
 
                     std::queue<T>::push(t);
+                    return true;
                 }
                 //-----------------------------------------------------------------------------
                 //! Pops the given value from the front of the queue.
@@ -129,6 +141,11 @@ namespace alpaka
             class ITaskPkg
             {
             public:
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                virtual ~ITaskPkg() = default;
+
                 //-----------------------------------------------------------------------------
                 //! Runs this task.
                 //-----------------------------------------------------------------------------
@@ -158,7 +175,32 @@ namespace alpaka
                 virtual auto setException(
                     std::exception_ptr const & exceptPtr)
                 -> void = 0;
+                //-----------------------------------------------------------------------------
+                //! Destroys the task after it has been run or an exception has been set.
+                //-----------------------------------------------------------------------------
+                virtual auto release() noexcept
+                -> void
+                {
+                    delete this;
+                }
+            };
+
+            //#############################################################################
+            //! Releases a task instead of deleting it.
+            //#############################################################################
+            struct TaskPkgReleaser
+            {
+                //-----------------------------------------------------------------------------
+                //!
+                //-----------------------------------------------------------------------------
+                auto operator()(
+                    ITaskPkg * pTaskPkg) const noexcept
+                -> void
+                {
+                    pTaskPkg->release();
+                }
             };
+            using TaskPkgPtr = std::unique_ptr<ITaskPkg, TaskPkgReleaser>;
 
             //#############################################################################
             //! TaskPkg with return type.
@@ -260,6 +302,310 @@ namespace alpaka
                 TFnObj m_FnObj;
             };
 
+            //#############################################################################
+            //! A counter of the uncompleted tasks enqueued without a future.
+            //!
+            //! It replaces a vector of futures when a caller only has to wait for a set of tasks.
+            //! The first exception thrown by one of the tasks is kept and rethrown by get.
+            //!
+            //! \tparam TMutex The mutex type used for locking threads.
+            //! \tparam TCondVar The condition variable type used to make the threads wait for the completion of the tasks.
+            //#############################################################################
+            template<
+                typename TMutex,
+                typename TCondVar>
+            class TaskGroup final
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //-----------------------------------------------------------------------------
+                TaskGroup() :
+                    m_mtxTasks(),
+                    m_cvTasksCompleted(),
+                    m_numTasksPending(0u),
+                    m_exceptPtr()
+                {}
+                //-----------------------------------------------------------------------------
+                //! Copy constructor.
+                //-----------------------------------------------------------------------------
+                TaskGroup(TaskGroup const &) = delete;
+                //-----------------------------------------------------------------------------
+                //! Move constructor.
+                //-----------------------------------------------------------------------------
+                TaskGroup(TaskGroup &&) = delete;
+                //-----------------------------------------------------------------------------
+                //! Copy assignment operator.
+                //-----------------------------------------------------------------------------
+                auto operator=(TaskGroup const &) -> TaskGroup & = delete;
+                //-----------------------------------------------------------------------------
+                //! Move assignment operator.
+                //-----------------------------------------------------------------------------
+                auto operator=(TaskGroup &&) -> TaskGroup & = delete;
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ~TaskGroup() = default;
+
+                //-----------------------------------------------------------------------------
+                //! Registers a task that has not been completed yet.
+                //-----------------------------------------------------------------------------
+                auto addTask()
+                -> void
+                {
+                    std::lock_guard<TMutex> lock(m_mtxTasks);
+                    ++m_numTasksPending;
+                }
+                //-----------------------------------------------------------------------------
+                //! Marks a task as completed.
+                //! The mutex is held while notifying so the group can be destroyed as soon as wait returns.
+                //-----------------------------------------------------------------------------
+                auto completeTask() noexcept
+                -> void
+                {
+                    std::lock_guard<TMutex> lock(m_mtxTasks);
+                    if(--m_numTasksPending == 0u)
+                    {
+                        m_cvTasksCompleted.notify_all();
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Stores the exception of a task if it is the first one.
+                //-----------------------------------------------------------------------------
+                auto setException(
+                    std::exception_ptr const & exceptPtr) noexcept
+                -> void
+                {
+                    std::lock_guard<TMutex> lock(m_mtxTasks);
+                    if(!m_exceptPtr)
+                    {
+                        m_exceptPtr = exceptPtr;
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Waits until all tasks of the group have been completed.
+                //! Like std::future::wait this does not rethrow the exceptions of the tasks.
+                //-----------------------------------------------------------------------------
+                auto wait()
+                -> void
+                {
+                    std::unique_lock<TMutex> lock(m_mtxTasks);
+                    m_cvTasksCompleted.wait(lock, [this]() { return m_numTasksPending == 0u; });
+                }
+                //-----------------------------------------------------------------------------
+                //! Waits until all tasks of the group have been completed.
+                //! Like std::future::get this rethrows the first exception thrown by one of the tasks.
+                //-----------------------------------------------------------------------------
+                auto get()
+                -> void
+                {
+                    std::exception_ptr exceptPtr;
+                    {
+                        std::unique_lock<TMutex> lock(m_mtxTasks);
+                        m_cvTasksCompleted.wait(lock, [this]() { return m_numTasksPending == 0u; });
+                        std::swap(exceptPtr, m_exceptPtr);
+                    }
+                    if(exceptPtr)
+                    {
+                        std::rethrow_exception(exceptPtr);
+                    }
+                }
+
+            private:
+                TMutex m_mtxTasks;
+                TCondVar m_cvTasksCompleted;
+                std::size_t m_numTasksPending;
+                std::exception_ptr m_exceptPtr;
+            };
+
+            //#############################################################################
+            //! The storage a task enqueued without a future is constructed in.
+            //!
+            //! Slots are recycled by the pool so enqueuing a task does not allocate once enough slots exist.
+            //! Tasks not fitting into a slot are allocated separately.
+            //#############################################################################
+            struct TaskSlot
+            {
+                typename std::aligned_storage<256u>::type m_storage;
+            };
+
+            //#############################################################################
+            //! TaskPkg reporting its completion to a TaskGroup instead of a promise.
+            //!
+            //! \tparam TFnObj The type of the function to execute.
+            //! \tparam TTaskGroup The type of the group the completion is reported to.
+            //#############################################################################
+            template<
+                typename TFnObj,
+                typename TTaskGroup>
+            class TaskPkgNoFuture final :
+                public ITaskPkg
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //!
+                //! \param pTaskGroup The group the completion is reported to. Can be nullptr.
+                //! \param pTaskSlot The slot this task has been constructed in or nullptr if it has been allocated with new.
+                //! \param pqFreeTaskSlots The queue the slot is returned to.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TFnObjFwd>
+                TaskPkgNoFuture(
+                    TFnObjFwd && func,
+                    TTaskGroup * pTaskGroup,
+                    TaskSlot * pTaskSlot,
+                    ThreadSafeQueue<TaskSlot *> * pqFreeTaskSlots) :
+                        m_FnObj(std::forward<TFnObjFwd>(func)),
+                        m_pTaskGroup(pTaskGroup),
+                        m_pTaskSlot(pTaskSlot),
+                        m_pqFreeTaskSlots(pqFreeTaskSlots)
+                {}
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! The execution function.
+                //-----------------------------------------------------------------------------
+                virtual auto run()
+                -> void final
+                {
+                    this->m_FnObj();
+                }
+            public:
+                //-----------------------------------------------------------------------------
+                //! Sets an exception.
+                //-----------------------------------------------------------------------------
+                virtual auto setException(
+                    std::exception_ptr const & exceptPtr)
+                -> void final
+                {
+                    if(m_pTaskGroup)
+                    {
+                        m_pTaskGroup->setException(exceptPtr);
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Destroys the task and returns its slot before the completion is reported.
+                //! This guarantees that the function object is destroyed before a waiting thread continues.
+                //-----------------------------------------------------------------------------
+                virtual auto release() noexcept
+                -> void final
+                {
+                    auto const pTaskGroup(m_pTaskGroup);
+                    auto const pTaskSlot(m_pTaskSlot);
+                    auto const pqFreeTaskSlots(m_pqFreeTaskSlots);
+
+                    if(pTaskSlot)
+                    {
+                        this->~TaskPkgNoFuture();
+                        pqFreeTaskSlots->push(pTaskSlot);
+                    }
+                    else
+                    {
+                        delete this;
+                    }
+
+                    if(pTaskGroup)
+                    {
+                        pTaskGroup->completeTask();
+                    }
+                }
+
+            private:
+                TFnObj m_FnObj;
+                TTaskGroup * m_pTaskGroup;
+                TaskSlot * m_pTaskSlot;
+                ThreadSafeQueue<TaskSlot *> * m_pqFreeTaskSlots;
+            };
+
+            //#############################################################################
+            //! What enqueuing a task into a pool with a full queue does.
+            //! Only queues with a fixed capacity like RingQueue can be full.
+            //#############################################################################
+            enum class QueueFullPolicy
+            {
+                Block,  //!< The enqueuing thread waits until a concurrent executor has taken a task from the queue.
+                Spin,   //!< The enqueuing thread retries until there is space in the queue.
+                Fail,   //!< A std::runtime_error is thrown and the task is discarded.
+            };
+
+            //#############################################################################
+            //! What an idle concurrent executor does while it waits for new work.
+            //!
+            //! It first polls the queue m_spinCount times, then yields m_yieldCount times and polling again each time, and finally parks on the condition variable.
+            //! Parked executors are only woken up if there are any, so spinning executors do not make an enqueue more expensive.
+            //#############################################################################
+            struct IdlePolicy
+            {
+                std::size_t m_spinCount;    //!< The number of queue polls before the executor starts to yield.
+                std::size_t m_yieldCount;   //!< The number of yields before the executor is parked.
+
+                //-----------------------------------------------------------------------------
+                //! \return A policy parking idle executors immediately.
+                //! This has the lowest CPU usage and the highest latency between enqueue and start of a task.
+                //-----------------------------------------------------------------------------
+                static auto park()
+                -> IdlePolicy
+                {
+                    return {0u, 0u};
+                }
+                //-----------------------------------------------------------------------------
+                //! \return A policy polling the queue forever.
+                //! This has the lowest latency but every idle executor occupies a core.
+                //-----------------------------------------------------------------------------
+                static auto spin()
+                -> IdlePolicy
+                {
+                    return {std::numeric_limits<std::size_t>::max(), 0u};
+                }
+                //-----------------------------------------------------------------------------
+                //! \return A policy yielding forever.
+                //-----------------------------------------------------------------------------
+                static auto yield()
+                -> IdlePolicy
+                {
+                    return {0u, std::numeric_limits<std::size_t>::max()};
+                }
+                //-----------------------------------------------------------------------------
+                //! \return A policy spinning and yielding for a few microseconds before parking.
+                //! Spinning is skipped on single core machines where it would only delay the thread enqueuing the work.
+                //-----------------------------------------------------------------------------
+                static auto hybrid()
+                -> IdlePolicy
+                {
+                    return {
+                        (std::thread::hardware_concurrency() > 1u) ? static_cast<std::size_t>(1u << 12u) : static_cast<std::size_t>(0u),
+                        static_cast<std::size_t>(16u)};
+                }
+            };
+
+            //#############################################################################
+            //! Yields the current concurrent execution with the given yield type.
+            //#############################################################################
+            template<
+                typename TYield>
+            struct IdleYield
+            {
+                static auto yield()
+                -> void
+                {
+                    TYield::yield();
+                }
+            };
+            //#############################################################################
+            //! Yields the current thread if no yield type is given.
+            //#############################################################################
+            template<>
+            struct IdleYield<
+                void>
+            {
+                static auto yield()
+                -> void
+                {
+                    std::this_thread::yield();
+                }
+            };
+
             //#############################################################################
             //! ConcurrentExecPool using yield.
             //!
@@ -269,6 +615,7 @@ namespace alpaka
             //! \tparam TMutex Unused. The mutex type used for locking threads.
             //! \tparam TCondVar Unused. The condition variable type used to make the threads wait if there is no work.
             //! \tparam TisYielding Boolean value if the threads should yield instead of wait for a condition variable.
+            //! \tparam TQueue The task queue type. If it has a fixed capacity, enqueuing into a full queue yields until there is space.
             //#############################################################################
             template<
                 typename TSize,
@@ -277,7 +624,8 @@ namespace alpaka
                 typename TYield,
                 typename TMutex = void,
                 typename TCondVar = void,
-                bool TisYielding = true>
+                bool TisYielding = true,
+                template<typename TElem> class TQueue = ThreadSafeQueue>
             class ConcurrentExecPool final
             {
             public:
@@ -336,7 +684,7 @@ namespace alpaka
 
                     joinAllConcurrentExecs();
 
-                    auto currentTaskPackage(std::unique_ptr<ITaskPkg>{nullptr});
+                    auto currentTaskPackage(TaskPkgPtr{nullptr});
 
                     // Signal to each incomplete task that it will not complete due to pool destruction.
                     while(popTask(currentTaskPackage))
@@ -365,7 +713,7 @@ namespace alpaka
                 auto enqueueTask(
                     TFnObj && task,
                     TArgs && ... args)
-                -> typename std::result_of< decltype(&TPromise<typename std::result_of<TFnObj(TArgs...)>::type>::get_future)(TPromise<typename std::result_of<TFnObj(TArgs...)>::type>) >::type
+                -> decltype(std::declval<TPromise<typename std::result_of<TFnObj(TArgs...)>::type> &>().get_future())
                 {
                     auto boundTask(std::bind(std::forward<TFnObj>(task), std::forward<TArgs>(args)...));
 
@@ -378,7 +726,10 @@ namespace alpaka
 
                     auto future(packagePtr->m_Promise.get_future());
 
-                    m_qTasks.push(static_cast<ITaskPkg *>(packagePtr.get()));
+                    while(!m_qTasks.push(static_cast<ITaskPkg *>(packagePtr.get())))
+                    {
+                        TYield::yield();
+                    }
 
                     // No longer in danger, can revoke ownership so m_qTasks is not left with dangling reference.
                     packagePtr.release();
@@ -394,13 +745,28 @@ namespace alpaka
                     return m_vConcurrentExecs.size();
                 }
                 //-----------------------------------------------------------------------------
+                //! Adds concurrent executors until the pool contains at least the given number of them.
+                //! NOTE: This is not thread safe. Concurrent calls have to be synchronized by the caller.
+                //-----------------------------------------------------------------------------
+                auto growConcurrentExecutionCount(
+                    TSize concurrentExecutionCount)
+                -> void
+                {
+                    m_vConcurrentExecs.reserve(concurrentExecutionCount);
+
+                    for(TSize concurrentExec(static_cast<TSize>(m_vConcurrentExecs.size())); concurrentExec < concurrentExecutionCount; ++concurrentExec)
+                    {
+                        m_vConcurrentExecs.emplace_back(std::bind(&ConcurrentExecPool::concurrentExecFn, this));
+                    }
+                }
+                //-----------------------------------------------------------------------------
                 //! \return If the work queue is empty.
                 //-----------------------------------------------------------------------------
                 auto isQueueEmpty() const
                 -> bool
                 {
 #if (BOOST_VERSION < 105700)
-                    return const_cast<ThreadSafeQueue<ITaskPkg *> &>(m_qTasks).empty();
+                    return const_cast<TQueue<ITaskPkg *> &>(m_qTasks).empty();
 #else
                     return m_qTasks.empty();
 #endif
@@ -415,7 +781,7 @@ namespace alpaka
                     // Checks whether pool is being destroyed, if so, stop running.
                     while(!m_bShutdownFlag.load(std::memory_order_relaxed))
                     {
-                        auto currentTaskPackage(std::unique_ptr<ITaskPkg>{nullptr});
+                        auto currentTaskPackage(TaskPkgPtr{nullptr});
 
                         // Use popTask so we only ever have one reference to the ITaskPkg
                         if(popTask(currentTaskPackage))
@@ -443,7 +809,7 @@ namespace alpaka
                 //! Pops a task from the queue.
                 //-----------------------------------------------------------------------------
                 auto popTask(
-                    std::unique_ptr<ITaskPkg> & out)
+                    TaskPkgPtr & out)
                 -> bool
                 {
                     ITaskPkg * tempPtr(nullptr);
@@ -458,16 +824,19 @@ namespace alpaka
 
             private:
                 std::vector<TConcurrentExec> m_vConcurrentExecs;
-                ThreadSafeQueue<ITaskPkg *> m_qTasks;
+                TQueue<ITaskPkg *> m_qTasks;
                 std::atomic<bool> m_bShutdownFlag;
             };
 
             //#############################################################################
             //! ConcurrentExecPool using a condition variable to wait for new work.
             //!
+            //! How long idle concurrent executors spin and yield before they wait for the condition variable is selected by the IdlePolicy of the pool.
+            //!
             //! \tparam TConcurrentExec The type of concurrent executor (for example std::thread).
             //! \tparam TPromise The promise type returned by the task.
-            //! \tparam TYield Unused. The type is required to have a static method "void yield()" to yield the current thread if there is no work.
+            //! \tparam TYield The type is required to have a static method "void yield()" to yield the current thread if there is no work. If it is void, std::this_thread::yield is used.
+            //! \tparam TQueue The task queue type. If it has a fixed capacity, the QueueFullPolicy of the pool selects what enqueuing into a full queue does.
             //! \tparam TMutex The mutex type used for locking threads.
             //! \tparam TCondVar The condition variable type used to make the threads wait if there is no work.
             //#############################################################################
@@ -477,7 +846,8 @@ namespace alpaka
                 template<typename TFnObjReturn> class TPromise,
                 typename TYield,
                 typename TMutex,
-                typename TCondVar>
+                typename TCondVar,
+                template<typename TElem> class TQueue>
             class ConcurrentExecPool<
                 TSize,
                 TConcurrentExec,
@@ -485,9 +855,12 @@ namespace alpaka
                 TYield,
                 TMutex,
                 TCondVar,
-                false> final
+                false,
+                TQueue> final
             {
             public:
+                using TaskGroup = detail::TaskGroup<TMutex, TCondVar>;
+
                 //-----------------------------------------------------------------------------
                 //! Constructor.
                 //!
@@ -497,15 +870,25 @@ namespace alpaka
                 //!                                     This is also the maximum number of tasks worked on concurrently.
                 //! \param queueSize  The maximum number of tasks that can be queued for completion.
                 //!                     Currently running tasks do not belong to the queue anymore.
+                //! \param idlePolicy What idle concurrent executors do before they wait for the condition variable.
+                //! \param queueFullPolicy What enqueuing into a full queue does.
                 //-----------------------------------------------------------------------------
                 ConcurrentExecPool(
                     TSize concurrentExecutionCount,
-                    TSize queueSize = 128u) :
+                    TSize queueSize = 128u,
+                    IdlePolicy const & idlePolicy = IdlePolicy::park(),
+                    QueueFullPolicy const & queueFullPolicy = QueueFullPolicy::Block) :
                     m_vConcurrentExecs(),
                     m_qTasks(queueSize),
+                    m_qFreeTaskSlots(queueSize),
+                    m_idlePolicy(idlePolicy),
+                    m_queueFullPolicy(queueFullPolicy),
                     m_mtxWakeup(),
                     m_bShutdownFlag(false),
-                    m_cvWakeup()
+                    m_numConcurrentExecsParked(0u),
+                    m_numProducersBlocked(0u),
+                    m_cvWakeup(),
+                    m_cvNotFull()
                 {
                     m_vConcurrentExecs.reserve(concurrentExecutionCount);
 
@@ -551,7 +934,7 @@ namespace alpaka
 
                     joinAllConcurrentExecs();
 
-                    auto currentTaskPackage(std::unique_ptr<ITaskPkg>{nullptr});
+                    auto currentTaskPackage(TaskPkgPtr{nullptr});
 
                     // Signal to each incomplete task that it will not complete due to pool destruction.
                     while(popTask(currentTaskPackage))
@@ -559,6 +942,14 @@ namespace alpaka
                         auto const except(std::runtime_error("Could not perform task before ConcurrentExecPool destruction"));
                         currentTaskPackage->setException(std::make_exception_ptr(except));
                     }
+                    currentTaskPackage.reset();
+
+                    // All tasks have returned their slots.
+                    TaskSlot * pTaskSlot(nullptr);
+                    while(m_qFreeTaskSlots.pop(pTaskSlot))
+                    {
+                        delete pTaskSlot;
+                    }
                 }
 
                 //-----------------------------------------------------------------------------
@@ -580,7 +971,7 @@ namespace alpaka
                 auto enqueueTask(
                     TFnObj && task,
                     TArgs && ... args)
-                -> typename std::result_of< decltype(&TPromise<typename std::result_of<TFnObj(TArgs...)>::type>::get_future)(TPromise<typename std::result_of<TFnObj(TArgs...)>::type>) >::type
+                -> decltype(std::declval<TPromise<typename std::result_of<TFnObj(TArgs...)>::type> &>().get_future())
                 {
                     auto boundTask(std::bind(std::forward<TFnObj>(task), std::forward<TArgs>(args)...));
 
@@ -593,16 +984,114 @@ namespace alpaka
 
                     auto future(packagePtr->m_Promise.get_future());
 
-                    m_qTasks.push(static_cast<ITaskPkg *>(packagePtr.get()));
+                    pushTask(static_cast<ITaskPkg *>(packagePtr.get()));
 
                     // No longer in danger, can revoke ownership so m_qTasks is not left with dangling reference.
                     packagePtr.release();
 
-                    m_cvWakeup.notify_one();
+                    wakeupParkedConcurrentExec();
 
                     return future;
                 }
                 //-----------------------------------------------------------------------------
+                //! Runs the given function on one of the pool in First In First Out (FIFO) order without creating a future.
+                //!
+                //! The task is constructed in a recycled slot, so once the pool has enough slots no memory is allocated.
+                //! Function objects larger than a slot are allocated separately.
+                //!
+                //! \tparam TFnObj   The function type. It has to be callable without arguments.
+                //! \param task     Function object to be called on the pool.
+                //! \param pTaskGroup The group the completion and the exceptions of the task are reported to.
+                //!                 If it is nullptr, nobody is notified and exceptions are dropped.
+                //!
+                //! If the queue is full, this blocks, spins or throws a std::runtime_error depending on the QueueFullPolicy of the pool.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TFnObj>
+                auto enqueueTaskNoFuture(
+                    TFnObj && task,
+                    TaskGroup * pTaskGroup = nullptr)
+                -> void
+                {
+                    auto packagePtr(createTaskNoFuture(std::forward<TFnObj>(task), pTaskGroup));
+                    pushTask(packagePtr.get());
+                    packagePtr.release();
+
+                    wakeupParkedConcurrentExec();
+                }
+                //-----------------------------------------------------------------------------
+                //! Runs the given function like enqueueTaskNoFuture but only if there is space in the queue.
+                //!
+                //! \return false if the queue is full. The task is discarded in this case.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TFnObj>
+                auto tryEnqueueTaskNoFuture(
+                    TFnObj && task,
+                    TaskGroup * pTaskGroup = nullptr)
+                -> bool
+                {
+                    auto packagePtr(createTaskNoFuture(std::forward<TFnObj>(task), pTaskGroup));
+                    if(!m_qTasks.push(packagePtr.get()))
+                    {
+                        return false;
+                    }
+                    packagePtr.release();
+
+                    wakeupParkedConcurrentExec();
+                    return true;
+                }
+                //-----------------------------------------------------------------------------
+                //! Applies the QueueFullPolicy after tryEnqueueTaskNoFuture failed.
+                //!
+                //! Blocks until the queue has space, yields once or throws a std::runtime_error.
+                //! This allows callers to release their own locks before they wait for the queue.
+                //! NOTE: Blocking requires TQueue to have a method "bool full() const".
+                //-----------------------------------------------------------------------------
+                auto waitForQueueSpace()
+                -> void
+                {
+                    switch(m_queueFullPolicy)
+                    {
+                    case QueueFullPolicy::Fail:
+                        throwQueueFull();
+                        break;
+                    case QueueFullPolicy::Spin:
+                        IdleYield<TYield>::yield();
+                        break;
+                    case QueueFullPolicy::Block:
+                        {
+                            std::unique_lock<TMutex> lock(m_mtxWakeup);
+
+                            m_numProducersBlocked.fetch_add(1u, std::memory_order_seq_cst);
+                            std::atomic_thread_fence(std::memory_order_seq_cst);
+                            m_cvNotFull.wait(lock, [this]() { return !m_qTasks.full(); });
+                            m_numProducersBlocked.fetch_sub(1u, std::memory_order_relaxed);
+                        }
+                        break;
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Pops the next task and runs it on the calling thread.
+                //!
+                //! A pool without concurrent executors is a plain task queue whose tasks are only run by calling this method.
+                //!
+                //! \return false if the queue was empty.
+                //-----------------------------------------------------------------------------
+                auto runNextTask()
+                -> bool
+                {
+                    auto currentTaskPackage(TaskPkgPtr{nullptr});
+                    if(popTask(currentTaskPackage))
+                    {
+                        wakeupBlockedProducer();
+                        currentTaskPackage->runTask();
+                        return true;
+                    }
+                    return false;
+                }
+                //-----------------------------------------------------------------------------
                 //! \return The number of concurrent executors available.
                 //-----------------------------------------------------------------------------
                 auto getConcurrentExecutionCount() const
@@ -611,13 +1100,43 @@ namespace alpaka
                     return m_vConcurrentExecs.size();
                 }
                 //-----------------------------------------------------------------------------
+                //! Adds concurrent executors until the pool contains at least the given number of them.
+                //! NOTE: This is not thread safe. Concurrent calls have to be synchronized by the caller.
+                //-----------------------------------------------------------------------------
+                auto growConcurrentExecutionCount(
+                    TSize concurrentExecutionCount)
+                -> void
+                {
+                    m_vConcurrentExecs.reserve(concurrentExecutionCount);
+
+                    for(TSize concurrentExec(static_cast<TSize>(m_vConcurrentExecs.size())); concurrentExec < concurrentExecutionCount; ++concurrentExec)
+                    {
+                        m_vConcurrentExecs.emplace_back(std::bind(&ConcurrentExecPool::concurrentExecFn, this));
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! \return If the calling thread is one of the concurrent executors of this pool.
+                //-----------------------------------------------------------------------------
+                auto isCurrentThreadConcurrentExec() const
+                -> bool
+                {
+                    auto const currentThreadId(std::this_thread::get_id());
+                    return std::any_of(
+                        m_vConcurrentExecs.begin(),
+                        m_vConcurrentExecs.end(),
+                        [&currentThreadId](TConcurrentExec const & concurrentExec)
+                        {
+                            return concurrentExec.get_id() == currentThreadId;
+                        });
+                }
+                //-----------------------------------------------------------------------------
                 //! \return If the work queue is empty.
                 //-----------------------------------------------------------------------------
                 auto isQueueEmpty() const
                 -> bool
                 {
 #if (BOOST_VERSION < 105700)
-                    return const_cast<ThreadSafeQueue<ITaskPkg *> &>(m_qTasks).empty();
+                    return const_cast<TQueue<ITaskPkg *> &>(m_qTasks).empty();
 #else
                     return m_qTasks.empty();
 #endif
@@ -632,28 +1151,201 @@ namespace alpaka
                     // Checks whether pool is being destroyed, if so, stop running (lazy check without mutex).
                     while(!m_bShutdownFlag)
                     {
-                        auto currentTaskPackage(std::unique_ptr<ITaskPkg>{nullptr});
+                        auto currentTaskPackage(TaskPkgPtr{nullptr});
 
                         // Use popTask so we only ever have one reference to the ITaskPkg
                         if(popTask(currentTaskPackage))
                         {
+                            wakeupBlockedProducer();
                             currentTaskPackage->runTask();
                         }
                         else
                         {
-                            std::unique_lock<TMutex> lock(m_mtxWakeup);
+                            idle();
+                        }
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Waits for new work as defined by the idle policy.
+                //-----------------------------------------------------------------------------
+                auto idle()
+                -> void
+                {
+                    for(std::size_t i(0u); i < m_idlePolicy.m_spinCount; ++i)
+                    {
+                        if((!m_qTasks.empty()) || m_bShutdownFlag.load(std::memory_order_relaxed))
+                        {
+                            return;
+                        }
+                    }
+                    for(std::size_t i(0u); i < m_idlePolicy.m_yieldCount; ++i)
+                    {
+                        IdleYield<TYield>::yield();
+                        if((!m_qTasks.empty()) || m_bShutdownFlag.load(std::memory_order_relaxed))
+                        {
+                            return;
+                        }
+                    }
+
+                    std::unique_lock<TMutex> lock(m_mtxWakeup);
 
-                            // If the shutdown flag has been set since the last check, return now.
-                            if(m_bShutdownFlag)
+                    // If the shutdown flag has been set since the last check, return now.
+                    if(m_bShutdownFlag)
+                    {
+                        return;
+                    }
+
+                    // The executor announces that it is parked before it checks the queue a last time.
+                    // Together with the fence in wakeupParkedConcurrentExec either this check sees the new task or the enqueuing thread sees the parked executor.
+                    m_numConcurrentExecsParked.fetch_add(1u, std::memory_order_seq_cst);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    m_cvWakeup.wait(lock, [this]() { return ((!m_qTasks.empty()) || m_bShutdownFlag); });
+                    m_numConcurrentExecsParked.fetch_sub(1u, std::memory_order_relaxed);
+                }
+                //-----------------------------------------------------------------------------
+                //! Wakes up a parked concurrent executor after a task has been pushed if there is one.
+                //-----------------------------------------------------------------------------
+                auto wakeupParkedConcurrentExec()
+                -> void
+                {
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if(m_numConcurrentExecsParked.load(std::memory_order_seq_cst) > 0u)
+                    {
+                        // Acquiring the mutex once guarantees that a concurrent executor which has just seen the empty queue is already waiting and will not miss the notification.
+                        {
+                            std::lock_guard<TMutex> lock(m_mtxWakeup);
+                        }
+                        m_cvWakeup.notify_one();
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Creates a task without a future in a recycled slot and adds it to the task group.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TFnObj>
+                auto createTaskNoFuture(
+                    TFnObj && task,
+                    TaskGroup * pTaskGroup)
+                -> TaskPkgPtr
+                {
+                    using TaskPackage = TaskPkgNoFuture<typename std::decay<TFnObj>::type, TaskGroup>;
+
+                    // Tasks too large for a slot are allocated on their own.
+                    // The choice is made at compile time, so the slot code is not instantiated for them.
+                    ITaskPkg * const pTaskPkg(
+                        newTaskPkg<TaskPackage>(
+                            std::forward<TFnObj>(task),
+                            pTaskGroup,
+                            std::integral_constant<bool, (sizeof(TaskPackage) <= sizeof(TaskSlot))>()));
+
+                    // The group is only incremented after the task exists because it is decremented when the task is released.
+                    if(pTaskGroup)
+                    {
+                        pTaskGroup->addTask();
+                    }
+
+                    // Releasing the task if push throws or fails also completes it in the group.
+                    return TaskPkgPtr(pTaskPkg);
+                }
+                //-----------------------------------------------------------------------------
+                //! Creates the task package in a recycled slot.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TaskPackage,
+                    typename TFnObj>
+                auto newTaskPkg(
+                    TFnObj && task,
+                    TaskGroup * pTaskGroup,
+                    std::true_type const &)
+                -> ITaskPkg *
+                {
+                    TaskSlot * pTaskSlot(nullptr);
+                    if(!m_qFreeTaskSlots.pop(pTaskSlot))
+                    {
+                        pTaskSlot = new TaskSlot;
+                    }
+                    try
+                    {
+                        return new (&pTaskSlot->m_storage) TaskPackage(std::forward<TFnObj>(task), pTaskGroup, pTaskSlot, &m_qFreeTaskSlots);
+                    }
+                    catch(...)
+                    {
+                        m_qFreeTaskSlots.push(pTaskSlot);
+                        throw;
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Creates the task package on the heap.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TaskPackage,
+                    typename TFnObj>
+                auto newTaskPkg(
+                    TFnObj && task,
+                    TaskGroup * pTaskGroup,
+                    std::false_type const &)
+                -> ITaskPkg *
+                {
+                    return new TaskPackage(std::forward<TFnObj>(task), pTaskGroup, nullptr, nullptr);
+                }
+                //-----------------------------------------------------------------------------
+                //! Pushes the task into the queue and applies the QueueFullPolicy if the queue is full.
+                //-----------------------------------------------------------------------------
+                auto pushTask(
+                    ITaskPkg * pTaskPkg)
+                -> void
+                {
+                    if(!m_qTasks.push(pTaskPkg))
+                    {
+                        switch(m_queueFullPolicy)
+                        {
+                        case QueueFullPolicy::Fail:
+                            throwQueueFull();
+                            break;
+                        case QueueFullPolicy::Spin:
+                            while(!m_qTasks.push(pTaskPkg))
                             {
-                                return;
+                                IdleYield<TYield>::yield();
                             }
+                            break;
+                        case QueueFullPolicy::Block:
+                            {
+                                std::unique_lock<TMutex> lock(m_mtxWakeup);
 
-                            m_cvWakeup.wait(lock, [this]() { return ((!m_qTasks.empty()) || m_bShutdownFlag); });
+                                // The same handshake as for parked concurrent executors: either the retry sees the free space or the consumer sees the blocked producer.
+                                m_numProducersBlocked.fetch_add(1u, std::memory_order_seq_cst);
+                                std::atomic_thread_fence(std::memory_order_seq_cst);
+                                m_cvNotFull.wait(lock, [this, pTaskPkg]() { return m_qTasks.push(pTaskPkg); });
+                                m_numProducersBlocked.fetch_sub(1u, std::memory_order_relaxed);
+                            }
+                            break;
                         }
                     }
                 }
-
+                //-----------------------------------------------------------------------------
+                //! Throws the exception signaling a full queue.
+                //-----------------------------------------------------------------------------
+                static auto throwQueueFull()
+                -> void
+                {
+                    throw std::runtime_error("Could not enqueue the task because the queue of the ConcurrentExecPool is full");
+                }
+                //-----------------------------------------------------------------------------
+                //! Wakes up a producer blocked on a full queue after a task has been popped if there is one.
+                //-----------------------------------------------------------------------------
+                auto wakeupBlockedProducer()
+                -> void
+                {
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if(m_numProducersBlocked.load(std::memory_order_seq_cst) > 0u)
+                    {
+                        {
+                            std::lock_guard<TMutex> lock(m_mtxWakeup);
+                        }
+                        m_cvNotFull.notify_one();
+                    }
+                }
                 //-----------------------------------------------------------------------------
                 //! Joins all concurrent executors.
                 //-----------------------------------------------------------------------------
@@ -668,7 +1360,7 @@ namespace alpaka
                 //! Pops a task from the queue.
                 //-----------------------------------------------------------------------------
                 auto popTask(
-                    std::unique_ptr<ITaskPkg> & out)
+                    TaskPkgPtr & out)
                 -> bool
                 {
                     ITaskPkg * tempPtr(nullptr);
@@ -683,11 +1375,18 @@ namespace alpaka
 
             private:
                 std::vector<TConcurrentExec> m_vConcurrentExecs;
-                ThreadSafeQueue<ITaskPkg *> m_qTasks;
+                TQueue<ITaskPkg *> m_qTasks;
+                // There are never more free slots than tasks have been queued and running at once, so this queue does not need a fixed capacity.
+                ThreadSafeQueue<TaskSlot *> m_qFreeTaskSlots;
 
+                IdlePolicy const m_idlePolicy;
+                QueueFullPolicy const m_queueFullPolicy;
                 TMutex m_mtxWakeup;
                 std::atomic<bool> m_bShutdownFlag;
+                std::atomic<std::size_t> m_numConcurrentExecsParked;
+                std::atomic<std::size_t> m_numProducersBlocked;
                 TCondVar m_cvWakeup;
+                TCondVar m_cvNotFull;
             };
         }
     }
@@ -33,14 +33,22 @@
     #define NOMINMAX
 #endif
 
+#include <boost/version.hpp>            // BOOST_VERSION
+
 // Boost fiber:
 // http://olk.github.io/libs/fiber/doc/html/index.html
 // https://github.com/olk/boost-fiber
 #include <boost/fiber/fiber.hpp>        // boost::fibers::fiber
 #include <boost/fiber/operations.hpp>   // boost::this_fiber
-#include <boost/fiber/condition.hpp>    // boost::fibers::condition_variable
+// The header has been renamed when Boost.Fiber became part of Boost 1.62.
+#if BOOST_VERSION >= 106200
+    #include <boost/fiber/condition_variable.hpp>   // boost::fibers::condition_variable
+#else
+    #include <boost/fiber/condition.hpp>            // boost::fibers::condition_variable
+#endif
 #include <boost/fiber/mutex.hpp>        // boost::fibers::mutex
 #include <boost/fiber/future.hpp>       // boost::fibers::future
+#include <boost/fiber/fss.hpp>          // boost::fibers::fiber_specific_ptr
 //#include <boost/fiber/barrier.hpp>    // boost::fibers::barrier
 
 #if BOOST_COMP_MSVC
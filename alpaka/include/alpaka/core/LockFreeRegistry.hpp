@@ -0,0 +1,279 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>   // ALPAKA_FN_HOST
+
+#include <atomic>           // std::atomic
+#include <cstddef>          // std::size_t
+#include <memory>           // std::shared_ptr, std::weak_ptr
+#include <thread>           // std::this_thread::yield
+#include <vector>           // std::vector
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! A registry of weakly referenced objects that can be added and removed without locks.
+            //!
+            //! The entries are kept in a list of fixed size chunks of slots that only grows, so adding an object is a compare-and-swap on a free slot.
+            //! Removing an object clears its slot and waits until no concurrent getAll can still read the entry before it is deleted.
+            //! getAll only marks itself as reader while copying the weak pointers, so removes only wait for short periods.
+            //!
+            //! T may be incomplete where the registry is declared.
+            //#############################################################################
+            template<
+                typename T>
+            class LockFreeRegistry final
+            {
+            private:
+                static constexpr std::size_t chunkSlotCount = 64u;
+
+                //#############################################################################
+                //! A registered object.
+                //#############################################################################
+                struct Entry
+                {
+                    std::weak_ptr<T> m_wp;
+                };
+                //#############################################################################
+                //! A chunk of slots.
+                //#############################################################################
+                struct Chunk
+                {
+                    std::atomic<Entry *> m_apEntries[chunkSlotCount];
+                    std::atomic<Chunk *> m_pNext;
+                };
+
+                //#############################################################################
+                //! Marks a getAll as reader for the lifetime of this object, so removes wait for it even if it throws.
+                //#############################################################################
+                class ReadScope final
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    //! Constructor.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST explicit ReadScope(
+                        std::atomic<std::size_t> & numReaders) :
+                            m_numReaders(numReaders)
+                    {
+                        m_numReaders.fetch_add(1u, std::memory_order_seq_cst);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Copy constructor.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST ReadScope(ReadScope const &) = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Copy assignment operator.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto operator=(ReadScope const &) -> ReadScope & = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Destructor.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST ~ReadScope()
+                    {
+                        m_numReaders.fetch_sub(1u, std::memory_order_seq_cst);
+                    }
+
+                private:
+                    std::atomic<std::size_t> & m_numReaders;
+                };
+
+            public:
+                //! The handle of a registered object.
+                using Slot = std::atomic<Entry *>;
+
+            public:
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST LockFreeRegistry() :
+                    m_numReaders(0u)
+                {
+                    initChunk(m_firstChunk);
+                }
+                //-----------------------------------------------------------------------------
+                //! Copy constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST LockFreeRegistry(LockFreeRegistry const &) = delete;
+                //-----------------------------------------------------------------------------
+                //! Move constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST LockFreeRegistry(LockFreeRegistry &&) = delete;
+                //-----------------------------------------------------------------------------
+                //! Copy assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(LockFreeRegistry const &) -> LockFreeRegistry & = delete;
+                //-----------------------------------------------------------------------------
+                //! Move assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(LockFreeRegistry &&) -> LockFreeRegistry & = delete;
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST ~LockFreeRegistry()
+                {
+                    for(Chunk * pChunk(&m_firstChunk); pChunk != nullptr;)
+                    {
+                        for(auto & pEntry : pChunk->m_apEntries)
+                        {
+                            delete pEntry.load(std::memory_order_relaxed);
+                        }
+                        Chunk * const pNext(pChunk->m_pNext.load(std::memory_order_relaxed));
+                        if(pChunk != &m_firstChunk)
+                        {
+                            delete pChunk;
+                        }
+                        pChunk = pNext;
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Registers the object.
+                //!
+                //! \return The slot to pass to remove.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto add(
+                    std::shared_ptr<T> const & sp)
+                -> Slot *
+                {
+                    Entry * const pEntry(new Entry{sp});
+
+                    for(Chunk * pChunk(&m_firstChunk);;)
+                    {
+                        for(auto & slot : pChunk->m_apEntries)
+                        {
+                            Entry * pExpected(nullptr);
+                            if((slot.load(std::memory_order_relaxed) == nullptr)
+                                && slot.compare_exchange_strong(pExpected, pEntry, std::memory_order_acq_rel))
+                            {
+                                return &slot;
+                            }
+                        }
+
+                        // All slots are in use. Append a new chunk unless another thread has been faster.
+                        Chunk * pNext(pChunk->m_pNext.load(std::memory_order_acquire));
+                        if(pNext == nullptr)
+                        {
+                            Chunk * const pNewChunk(new Chunk);
+                            initChunk(*pNewChunk);
+                            if(pChunk->m_pNext.compare_exchange_strong(pNext, pNewChunk, std::memory_order_acq_rel))
+                            {
+                                pNext = pNewChunk;
+                            }
+                            else
+                            {
+                                delete pNewChunk;
+                            }
+                        }
+                        pChunk = pNext;
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Unregisters the object registered in the given slot.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto remove(
+                    Slot * const pSlot)
+                -> void
+                {
+                    Entry * const pEntry(pSlot->exchange(nullptr, std::memory_order_seq_cst));
+
+                    // A concurrent getAll may have loaded the entry before it has been cleared.
+                    while(m_numReaders.load(std::memory_order_seq_cst) != 0u)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    delete pEntry;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return All registered objects that are still alive.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto getAll() const
+                -> std::vector<std::shared_ptr<T>>
+                {
+                    // The chunks are only freed by the destructor, so they can be counted without being a reader.
+                    std::size_t chunkCount(0u);
+                    for(Chunk const * pChunk(&m_firstChunk); pChunk != nullptr; pChunk = pChunk->m_pNext.load(std::memory_order_acquire))
+                    {
+                        ++chunkCount;
+                    }
+
+                    // Only the weak pointers are copied while reading.
+                    // Promoting them within the read would destroy the objects released meanwhile there and their destructors remove them from the registry which waits for the read to end.
+                    std::vector<std::weak_ptr<T>> vwp;
+                    vwp.reserve(chunkCount * chunkSlotCount);
+                    {
+                        ReadScope const readScope(m_numReaders);
+                        for(Chunk const * pChunk(&m_firstChunk); pChunk != nullptr; pChunk = pChunk->m_pNext.load(std::memory_order_acquire))
+                        {
+                            for(auto const & slot : pChunk->m_apEntries)
+                            {
+                                Entry const * const pEntry(slot.load(std::memory_order_seq_cst));
+                                if(pEntry != nullptr)
+                                {
+                                    vwp.emplace_back(pEntry->m_wp);
+                                }
+                            }
+                        }
+                    }
+
+                    // The entries of objects that are being destroyed have expired.
+                    std::vector<std::shared_ptr<T>> vsp;
+                    vsp.reserve(vwp.size());
+                    for(auto const & wp : vwp)
+                    {
+                        auto sp(wp.lock());
+                        if(sp)
+                        {
+                            vsp.emplace_back(std::move(sp));
+                        }
+                    }
+                    return vsp;
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! Clears all slots of the chunk.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto initChunk(
+                    Chunk & chunk)
+                -> void
+                {
+                    for(auto & slot : chunk.m_apEntries)
+                    {
+                        slot.store(nullptr, std::memory_order_relaxed);
+                    }
+                    chunk.m_pNext.store(nullptr, std::memory_order_relaxed);
+                }
+
+            private:
+                Chunk m_firstChunk;
+                std::atomic<std::size_t> mutable m_numReaders;  //!< The number of getAll calls reading the entries.
+            };
+        }
+    }
+}
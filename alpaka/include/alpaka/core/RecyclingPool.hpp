@@ -0,0 +1,196 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>          // std::size_t
+#include <memory>           // std::shared_ptr, std::weak_ptr, std::enable_shared_from_this
+#include <mutex>            // std::mutex
+#include <utility>          // std::forward, std::move
+#include <vector>           // std::vector
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! A pool of objects that are recycled instead of being destroyed when their last shared pointer is released.
+            //!
+            //! The objects are handed out as shared pointers whose deleter returns them to the pool.
+            //! Objects released after the pool has been destroyed or while it is full are deleted.
+            //! T has to provide a method recycle taking the constructor arguments that resets the object before it is handed out again.
+            //! It returns false if the object can not be reused with these arguments. The object is deleted and a new one constructed in this case.
+            //!
+            //! T only has to be complete where the pool is created and objects are acquired.
+            //! A pool can be held and cleared by classes that only know a forward declaration of T, because the objects are deleted through a function captured on construction.
+            //#############################################################################
+            template<
+                typename T>
+            class RecyclingPool final :
+                public std::enable_shared_from_this<RecyclingPool<T>>
+            {
+            private:
+                //#############################################################################
+                //! The deleter of the shared pointers handed out by the pool.
+                //#############################################################################
+                struct Recycler
+                {
+                    //-----------------------------------------------------------------------------
+                    //! Returns the object to the pool or deletes it.
+                    //-----------------------------------------------------------------------------
+                    auto operator()(
+                        T * const p) const
+                    -> void
+                    {
+                        auto const spPool(m_wpPool.lock());
+                        if(!spPool || !spPool->put(p))
+                        {
+                            deleteObject(p);
+                        }
+                    }
+
+                    std::weak_ptr<RecyclingPool> m_wpPool;
+                };
+
+            public:
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //!
+                //! \param capacity The maximum number of unused objects kept for recycling.
+                //-----------------------------------------------------------------------------
+                explicit RecyclingPool(
+                    std::size_t const & capacity) :
+                        m_capacity(capacity),
+                        m_pfnDeleteObject(&deleteObject)
+                {
+                    m_vpObjects.reserve(capacity);
+                }
+                //-----------------------------------------------------------------------------
+                //! Copy constructor.
+                //-----------------------------------------------------------------------------
+                RecyclingPool(RecyclingPool const &) = delete;
+                //-----------------------------------------------------------------------------
+                //! Move constructor.
+                //-----------------------------------------------------------------------------
+                RecyclingPool(RecyclingPool &&) = delete;
+                //-----------------------------------------------------------------------------
+                //! Copy assignment operator.
+                //-----------------------------------------------------------------------------
+                auto operator=(RecyclingPool const &) -> RecyclingPool & = delete;
+                //-----------------------------------------------------------------------------
+                //! Move assignment operator.
+                //-----------------------------------------------------------------------------
+                auto operator=(RecyclingPool &&) -> RecyclingPool & = delete;
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ~RecyclingPool()
+                {
+                    clear();
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return A recycled object or a new one constructed from the given arguments if there is no reusable one.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename... TArgs>
+                auto acquire(
+                    TArgs && ... args)
+                -> std::shared_ptr<T>
+                {
+                    T * p(nullptr);
+                    {
+                        std::lock_guard<std::mutex> lk(m_mtxObjects);
+                        if(!m_vpObjects.empty())
+                        {
+                            p = m_vpObjects.back();
+                            m_vpObjects.pop_back();
+                        }
+                    }
+
+                    if(p && !p->recycle(args...))
+                    {
+                        deleteObject(p);
+                        p = nullptr;
+                    }
+                    if(!p)
+                    {
+                        p = new T(std::forward<TArgs>(args)...);
+                    }
+
+                    return std::shared_ptr<T>(p, Recycler{this->shared_from_this()});
+                }
+                //-----------------------------------------------------------------------------
+                //! Deletes all unused objects.
+                //-----------------------------------------------------------------------------
+                auto clear()
+                -> void
+                {
+                    std::vector<T *> vpObjects;
+                    {
+                        std::lock_guard<std::mutex> lk(m_mtxObjects);
+                        vpObjects.swap(m_vpObjects);
+                    }
+                    for(auto const p : vpObjects)
+                    {
+                        m_pfnDeleteObject(p);
+                    }
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! Keeps the object for recycling if the pool is not full.
+                //!
+                //! \return If the object has been kept.
+                //-----------------------------------------------------------------------------
+                auto put(
+                    T * const p)
+                -> bool
+                {
+                    std::lock_guard<std::mutex> lk(m_mtxObjects);
+                    if(m_vpObjects.size() < m_capacity)
+                    {
+                        m_vpObjects.emplace_back(p);
+                        return true;
+                    }
+                    return false;
+                }
+                //-----------------------------------------------------------------------------
+                //! Deletes the object.
+                //-----------------------------------------------------------------------------
+                static auto deleteObject(
+                    T * const p)
+                -> void
+                {
+                    delete p;
+                }
+
+            private:
+                std::size_t const m_capacity;
+                void (* const m_pfnDeleteObject)(T *);  //!< Deletes an object where T may be incomplete.
+                std::mutex m_mtxObjects;
+                std::vector<T *> m_vpObjects;           //!< The unused objects.
+            };
+        }
+    }
+}
@@ -0,0 +1,282 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <boost/align.hpp>  // boost::alignment::aligned_alloc
+
+#include <atomic>           // std::atomic
+#include <cstddef>          // std::ptrdiff_t
+#include <memory>           // std::unique_ptr
+#include <new>              // std::bad_alloc, placement new
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! A bounded multi-producer multi-consumer queue on a fixed ring of cells.
+            //!
+            //! Every cell carries a sequence number telling producers and consumers whose turn it is, so push and pop only need one compare-and-swap on the shared position and touch one cell.
+            //! Cells and positions are aligned to cache lines so that producers and consumers working on neighbouring cells do not share a cache line.
+            //! C++11 new does not honour extended alignments, so they are allocated with an aligned allocator and the queue object itself has no extended alignment.
+            //! The capacity is rounded up to the next power of two and never grows. A push into a full queue fails instead of allocating.
+            //!
+            //! The interface matches the one of ThreadSafeQueue so that it can be used as the task queue of ConcurrentExecPool.
+            //#############################################################################
+            template<
+                typename T>
+            class RingQueue final
+            {
+            private:
+                static constexpr std::size_t cacheLineSize = 64u;
+
+                //#############################################################################
+                //! One element of the ring.
+                //#############################################################################
+                struct alignas(cacheLineSize) Cell
+                {
+                    std::atomic<std::size_t> m_sequence;
+                    T m_value;
+                };
+                //#############################################################################
+                //! The positions of the producers and the consumers, each on a cache line of its own.
+                //#############################################################################
+                struct Positions
+                {
+                    alignas(cacheLineSize) std::atomic<std::size_t> m_enqueuePos;
+                    alignas(cacheLineSize) std::atomic<std::size_t> m_dequeuePos;
+                };
+                //#############################################################################
+                //! Destroys and frees an array allocated by allocAligned.
+                //#############################################################################
+                template<
+                    typename TElem>
+                struct AlignedDeleter
+                {
+                    std::size_t m_count;
+
+                    auto operator()(
+                        TElem * const p) const
+                    -> void
+                    {
+                        for(std::size_t i(0u); i < m_count; ++i)
+                        {
+                            p[i].~TElem();
+                        }
+                        boost::alignment::aligned_free(p);
+                    }
+                };
+
+            public:
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //!
+                //! \param capacity The minimum number of elements the queue can hold.
+                //-----------------------------------------------------------------------------
+                explicit RingQueue(
+                    std::size_t const & capacity) :
+                        m_mask(roundUpToPowerOfTwo(capacity) - 1u),
+                        m_upCells(allocAligned<Cell>(m_mask + 1u)),
+                        m_upPositions(allocAligned<Positions>(1u))
+                {
+                    for(std::size_t i(0u); i <= m_mask; ++i)
+                    {
+                        m_upCells.get()[i].m_sequence.store(i, std::memory_order_relaxed);
+                    }
+                    m_upPositions->m_enqueuePos.store(0u, std::memory_order_relaxed);
+                    m_upPositions->m_dequeuePos.store(0u, std::memory_order_relaxed);
+                }
+                //-----------------------------------------------------------------------------
+                //! Copy constructor.
+                //-----------------------------------------------------------------------------
+                RingQueue(RingQueue const &) = delete;
+                //-----------------------------------------------------------------------------
+                //! Move constructor.
+                //-----------------------------------------------------------------------------
+                RingQueue(RingQueue &&) = delete;
+                //-----------------------------------------------------------------------------
+                //! Copy assignment operator.
+                //-----------------------------------------------------------------------------
+                auto operator=(RingQueue const &) -> RingQueue & = delete;
+                //-----------------------------------------------------------------------------
+                //! Move assignment operator.
+                //-----------------------------------------------------------------------------
+                auto operator=(RingQueue &&) -> RingQueue & = delete;
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ~RingQueue() = default;
+
+                //-----------------------------------------------------------------------------
+                //! \return The number of elements the queue can hold.
+                //-----------------------------------------------------------------------------
+                auto capacity() const
+                -> std::size_t
+                {
+                    return m_mask + 1u;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return If the queue is empty.
+                //! The result is only a snapshot if other threads are pushing or popping concurrently.
+                //-----------------------------------------------------------------------------
+                auto empty() const
+                -> bool
+                {
+                    auto const pos(m_upPositions->m_dequeuePos.load(std::memory_order_acquire));
+                    auto const seq(m_upCells.get()[pos & m_mask].m_sequence.load(std::memory_order_acquire));
+                    return static_cast<std::ptrdiff_t>(seq - (pos + 1u)) < 0;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return If the queue is full.
+                //! The result is only a snapshot if other threads are pushing or popping concurrently.
+                //-----------------------------------------------------------------------------
+                auto full() const
+                -> bool
+                {
+                    auto const pos(m_upPositions->m_enqueuePos.load(std::memory_order_acquire));
+                    auto const seq(m_upCells.get()[pos & m_mask].m_sequence.load(std::memory_order_acquire));
+                    return static_cast<std::ptrdiff_t>(seq - pos) < 0;
+                }
+                //-----------------------------------------------------------------------------
+                //! Pushes the given value onto the back of the queue.
+                //!
+                //! \return false if the queue is full.
+                //-----------------------------------------------------------------------------
+                auto push(
+                    T const & t)
+                -> bool
+                {
+                    auto pos(m_upPositions->m_enqueuePos.load(std::memory_order_relaxed));
+                    for(;;)
+                    {
+                        Cell & cell(m_upCells.get()[pos & m_mask]);
+                        auto const seq(cell.m_sequence.load(std::memory_order_acquire));
+                        auto const diff(static_cast<std::ptrdiff_t>(seq - pos));
+                        if(diff == 0)
+                        {
+                            // The cell is free in this round, try to claim it.
+                            if(m_upPositions->m_enqueuePos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+                            {
+                                cell.m_value = t;
+                                cell.m_sequence.store(pos + 1u, std::memory_order_release);
+                                return true;
+                            }
+                        }
+                        else if(diff < 0)
+                        {
+                            // The cell still holds the value of the previous round.
+                            return false;
+                        }
+                        else
+                        {
+                            // Another producer has been faster.
+                            pos = m_upPositions->m_enqueuePos.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Pops the front value of the queue.
+                //!
+                //! \return false if the queue is empty.
+                //-----------------------------------------------------------------------------
+                auto pop(
+                    T & t)
+                -> bool
+                {
+                    auto pos(m_upPositions->m_dequeuePos.load(std::memory_order_relaxed));
+                    for(;;)
+                    {
+                        Cell & cell(m_upCells.get()[pos & m_mask]);
+                        auto const seq(cell.m_sequence.load(std::memory_order_acquire));
+                        auto const diff(static_cast<std::ptrdiff_t>(seq - (pos + 1u)));
+                        if(diff == 0)
+                        {
+                            // The cell has been filled in this round, try to claim it.
+                            if(m_upPositions->m_dequeuePos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+                            {
+                                t = cell.m_value;
+                                // Hand the cell to the producer of the next round.
+                                cell.m_sequence.store(pos + m_mask + 1u, std::memory_order_release);
+                                return true;
+                            }
+                        }
+                        else if(diff < 0)
+                        {
+                            // The cell has not been filled yet.
+                            return false;
+                        }
+                        else
+                        {
+                            // Another consumer has been faster.
+                            pos = m_upPositions->m_dequeuePos.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! \return The given number of default constructed elements aligned to their alignment requirement.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TElem>
+                static auto allocAligned(
+                    std::size_t const & count)
+                -> std::unique_ptr<TElem, AlignedDeleter<TElem>>
+                {
+                    void * const p(boost::alignment::aligned_alloc(alignof(TElem), count * sizeof(TElem)));
+                    if(!p)
+                    {
+                        throw std::bad_alloc();
+                    }
+                    // The cells and positions of the pointer queues used by the pools are constructed without throwing.
+                    TElem * const pElems(static_cast<TElem *>(p));
+                    for(std::size_t i(0u); i < count; ++i)
+                    {
+                        new (pElems + i) TElem;
+                    }
+                    return std::unique_ptr<TElem, AlignedDeleter<TElem>>(pElems, AlignedDeleter<TElem>{count});
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The smallest power of two greater or equal to the given value and at least 2.
+                //-----------------------------------------------------------------------------
+                static auto roundUpToPowerOfTwo(
+                    std::size_t const & value)
+                -> std::size_t
+                {
+                    std::size_t powerOfTwo(2u);
+                    while(powerOfTwo < value)
+                    {
+                        powerOfTwo <<= 1u;
+                    }
+                    return powerOfTwo;
+                }
+
+            private:
+                std::size_t const m_mask;
+                std::unique_ptr<Cell, AlignedDeleter<Cell>> const m_upCells;
+                std::unique_ptr<Positions, AlignedDeleter<Positions>> const m_upPositions;
+            };
+        }
+    }
+}
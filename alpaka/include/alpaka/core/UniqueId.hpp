@@ -0,0 +1,49 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>           // std::atomic
+#include <cstdint>          // std::uint64_t
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace detail
+        {
+            //-----------------------------------------------------------------------------
+            //! \return A new ID for an object of the given kind.
+            //!
+            //! The IDs of a kind are counted up from zero and never reused, so unlike addresses they stay unique even if objects are recycled.
+            //! This is much cheaper than generating a random UUID which seeds a random engine for every object.
+            //-----------------------------------------------------------------------------
+            template<
+                typename TKind>
+            auto getNextUniqueId()
+            -> std::uint64_t
+            {
+                static std::atomic<std::uint64_t> nextId(0u);
+                return nextId.fetch_add(1u, std::memory_order_relaxed);
+            }
+        }
+    }
+}
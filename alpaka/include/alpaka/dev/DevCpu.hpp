@@ -23,33 +23,54 @@
 
 #include <alpaka/dev/Traits.hpp>        // dev::traits::DevType
 #include <alpaka/event/Traits.hpp>      // event::traits::EventType
-#include <alpaka/wait/Traits.hpp>       // CurrentThreadWaitFor
 #include <alpaka/mem/buf/Traits.hpp>    // mem::buf::traits::BufType
 #include <alpaka/mem/view/Traits.hpp>   // mem::view::traits::ViewType
 
 #include <alpaka/stream/Traits.hpp>     // stream::enqueue
 #include <alpaka/dev/cpu/SysInfo.hpp>   // getCpuName, getTotalGlobalMemSizeBytes, getFreeGlobalMemSizeBytes
+#include <alpaka/mem/alloc/AllocCpuCaching.hpp> // mem::alloc::cpu::detail::BlockCache
+
+#include <alpaka/core/ConcurrentExecPool.hpp>   // core::ConcurrentExecPool
+#include <alpaka/core/RecyclingPool.hpp>        // core::detail::RecyclingPool
+#include <alpaka/core/LockFreeRegistry.hpp>     // core::detail::LockFreeRegistry
 
 #include <boost/core/ignore_unused.hpp> // boost::ignore_unused
 
-#include <map>                          // std::map
+#include <algorithm>                    // std::max
+#include <atomic>                       // std::atomic
+#include <cassert>                      // assert
+#include <chrono>                       // std::chrono::milliseconds
+#include <cstdint>                      // std::uint64_t
 #include <sstream>                      // std::stringstream
 #include <limits>                       // std::numeric_limits
 #include <thread>                       // std::thread
-#include <mutex>                        // std::mutex
-#include <memory>                       // std::shared_ptr
+#include <mutex>                        // std::mutex, std::call_once
+#include <condition_variable>           // std::condition_variable
+#include <memory>                       // std::shared_ptr, std::enable_shared_from_this
 
 namespace alpaka
 {
+    namespace event
+    {
+        namespace cpu
+        {
+            namespace detail
+            {
+                class EventCpuImpl;
+            }
+        }
+    }
     namespace stream
     {
         class StreamCpuAsync;
+        class StreamCpuParallel;
 
         namespace cpu
         {
             namespace detail
             {
                 class StreamCpuAsyncImpl;
+                class StreamCpuParallelImpl;
             }
         }
     }
@@ -65,11 +86,27 @@ namespace alpaka
                 //#############################################################################
                 //! The CPU device implementation.
                 //#############################################################################
-                class DevCpuImpl
+                class DevCpuImpl :
+                    public std::enable_shared_from_this<DevCpuImpl>
                 {
                     friend stream::StreamCpuAsync;                   // stream::StreamCpuAsync::StreamCpuAsync calls RegisterAsyncStream.
                     friend stream::cpu::detail::StreamCpuAsyncImpl;  // StreamCpuAsyncImpl::~StreamCpuAsyncImpl calls UnregisterAsyncStream.
+                    friend stream::StreamCpuParallel;                   // stream::StreamCpuParallel::StreamCpuParallel calls RegisterParallelStream.
+                    friend stream::cpu::detail::StreamCpuParallelImpl;  // StreamCpuParallelImpl::~StreamCpuParallelImpl calls UnregisterParallelStream.
                 public:
+                    //#############################################################################
+                    //! The pool of worker threads shared by all kernel executions on this device.
+                    //! The workers wait on a condition variable because they live as long as the device and must not burn idle cores.
+                    //#############################################################################
+                    using ThreadPool = alpaka::core::detail::ConcurrentExecPool<
+                        std::size_t,
+                        std::thread,                // The concurrent execution type.
+                        std::promise,               // The promise type.
+                        void,                       // The type yielding the current concurrent execution.
+                        std::mutex,                 // The mutex type to use. Only required if TisYielding is true.
+                        std::condition_variable,    // The condition variable type to use. Only required if TisYielding is true.
+                        false>;                     // If the threads should yield.
+
                     //-----------------------------------------------------------------------------
                     //! Constructor.
                     //-----------------------------------------------------------------------------
@@ -93,7 +130,33 @@ namespace alpaka
                     //-----------------------------------------------------------------------------
                     //! Destructor.
                     //-----------------------------------------------------------------------------
-                    ALPAKA_FN_HOST ~DevCpuImpl() = default;
+                    ALPAKA_FN_HOST ~DevCpuImpl()
+                    {
+                        if(m_streamPoolMonitor.joinable())
+                        {
+                            {
+                                std::lock_guard<std::mutex> lk(m_mtxStreamPoolMonitor);
+                                m_bStreamPoolMonitorShutdown = true;
+                            }
+                            m_cvStreamPoolMonitor.notify_one();
+                            // The monitor releases the device if starting a helper has failed after it had taken the last reference.
+                            if(m_streamPoolMonitor.get_id() == std::this_thread::get_id())
+                            {
+                                m_streamPoolMonitor.detach();
+                            }
+                            else
+                            {
+                                m_streamPoolMonitor.join();
+                            }
+                        }
+
+                        // A drain of the stream thread pool can release the last stream and with it the device after main has returned.
+                        // A worker can not join itself, so the pool is leaked in this case. It is torn down with the process.
+                        if(m_upStreamThreadPool && m_upStreamThreadPool->isCurrentThreadConcurrentExec())
+                        {
+                            m_upStreamThreadPool.release();
+                        }
+                    }
 
                     //-----------------------------------------------------------------------------
                     //! \return The list of all streams on this device.
@@ -101,69 +164,555 @@ namespace alpaka
                     ALPAKA_FN_HOST auto GetAllAsyncStreamImpls() const noexcept(false)
                     -> std::vector<std::shared_ptr<stream::cpu::detail::StreamCpuAsyncImpl>>
                     {
-                        std::vector<std::shared_ptr<stream::cpu::detail::StreamCpuAsyncImpl>> vspStreams;
+                        // The entries of streams that are being destroyed have expired and are skipped.
+                        return m_registryAsyncStreams.getAll();
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The list of all parallel streams on this device.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto GetAllParallelStreamImpls() const noexcept(false)
+                    -> std::vector<std::shared_ptr<stream::cpu::detail::StreamCpuParallelImpl>>
+                    {
+                        return m_registryParallelStreams.getAll();
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! Marks the beginning of a period in which a stream of this device has pending tasks.
+                    //!
+                    //! The streams count their busy periods instead of their tasks, so this is called once when a stream goes from empty to non-empty.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto beginStreamWork()
+                    -> void
+                    {
+                        m_numStreamsBusy.fetch_add(1u, std::memory_order_seq_cst);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Marks the end of a period started with beginStreamWork.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto endStreamWork()
+                    -> void
+                    {
+                        m_numStreamsBusy.fetch_sub(1u, std::memory_order_seq_cst);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return If any stream of this device has pending tasks.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto hasBusyStreams() const
+                    -> bool
+                    {
+                        return m_numStreamsBusy.load(std::memory_order_seq_cst) != 0u;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Wakes up the threads in waitForStreamProgress.
+                    //!
+                    //! The streams call this after every completed task. It is a single load if nobody waits.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto notifyStreamProgress()
+                    -> void
+                    {
+                        // Waiters first increment their count and then check the progress, so one of both sides always sees the other.
+                        if(m_numProgressWaiters.load(std::memory_order_seq_cst) != 0u)
+                        {
+                            std::lock_guard<std::mutex> lk(m_mtxProgress);
+                            m_cvProgress.notify_all();
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Waits until the given predicate on the progress of the streams of this device is true.
+                    //! The predicate is checked again after every task completed by any stream.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TPred>
+                    ALPAKA_FN_HOST auto waitForStreamProgress(
+                        TPred const & pred)
+                    -> void
+                    {
+                        m_numProgressWaiters.fetch_add(1u, std::memory_order_seq_cst);
+                        try
+                        {
+                            std::unique_lock<std::mutex> lk(m_mtxProgress);
+                            m_cvProgress.wait(lk, pred);
+                        }
+                        catch(...)
+                        {
+                            m_numProgressWaiters.fetch_sub(1u, std::memory_order_seq_cst);
+                            throw;
+                        }
+                        m_numProgressWaiters.fetch_sub(1u, std::memory_order_seq_cst);
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! Acquires the given number of workers from the device thread pool.
+                    //!
+                    //! The pool is created on first use and grown until it contains at least as many workers as are currently acquired in total.
+                    //! This guarantees that the tasks of all concurrent acquirers can run at the same time which is required for block threads waiting on each other.
+                    //! Every call has to be matched by a call to releaseThreadPool with the same number of workers.
+                    //! Use ThreadPoolAcquisition to guarantee this in the presence of exceptions.
+                    //!
+                    //! \return The device thread pool.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto acquireThreadPool(
+                        std::size_t const & numWorkers)
+                    -> ThreadPool &
+                    {
+                        std::lock_guard<std::mutex> lk(m_mtxThreadPool);
 
-                        std::lock_guard<std::mutex> lk(m_Mutex);
+                        m_numWorkersAcquired += numWorkers;
 
-                        for(auto const & pairStream : m_mapStreams)
+                        if(!m_upThreadPool)
                         {
-                            auto spStream(pairStream.second.lock());
-                            if(spStream)
+                            m_upThreadPool.reset(new ThreadPool(m_numWorkersAcquired, 128u, core::detail::IdlePolicy::hybrid()));
+                        }
+                        else if(m_upThreadPool->getConcurrentExecutionCount() < m_numWorkersAcquired)
+                        {
+                            m_upThreadPool->growConcurrentExecutionCount(m_numWorkersAcquired);
+                        }
+
+                        return *m_upThreadPool;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The pool of worker threads running the tasks of all asynchronous streams of this device.
+                    //!
+                    //! The pool is created on first use with one worker per hardware thread and never grows.
+                    //! It is separate from the kernel execution pool because stream tasks wait for the block threads they launch.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getStreamThreadPool()
+                    -> ThreadPool &
+                    {
+                        std::call_once(
+                            m_onceFlagStreamThreadPool,
+                            [this]()
                             {
-                                vspStreams.emplace_back(std::move(spStream));
-                            }
-                            else
+                                m_upStreamThreadPool.reset(
+                                    new ThreadPool(
+                                        std::max(std::thread::hardware_concurrency(), 1u),
+                                        128u,
+                                        core::detail::IdlePolicy::hybrid()));
+                                m_streamPoolMonitor = std::thread(&DevCpuImpl::monitorStreamThreadPool, this);
+                            });
+
+                        return *m_upStreamThreadPool;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Runs the given stream task on the stream thread pool.
+                    //!
+                    //! A stream task can block its worker on the host, e.g. while waiting for a future that is set by a task of another stream.
+                    //! If tasks wait for a thread, a monitor compensates blocked workers with helper threads, see monitorStreamThreadPool.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TTask>
+                    ALPAKA_FN_HOST auto enqueueStreamTask(
+                        TTask && task)
+                    -> void
+                    {
+                        auto & threadPool(getStreamThreadPool());
+
+                        auto const numStreamTasks(m_numStreamTasks.fetch_add(1u, std::memory_order_seq_cst) + 1u);
+                        // Only wake up the monitor if the task can not be started right away.
+                        if((numStreamTasks > threadPool.getConcurrentExecutionCount() + m_numStreamHelpers.load(std::memory_order_relaxed))
+                            && !m_bStreamPoolMonitorArmed.load(std::memory_order_relaxed)
+                            && !m_bStreamPoolMonitorArmed.exchange(true, std::memory_order_seq_cst))
+                        {
+                            std::lock_guard<std::mutex> lk(m_mtxStreamPoolMonitor);
+                            m_cvStreamPoolMonitor.notify_one();
+                        }
+
+                        auto * const pDevImpl(this);
+                        try
+                        {
+                            threadPool.enqueueTaskNoFuture(
+                                [pDevImpl, task]()
+                                {
+                                    // The stream task keeps the device alive until the count has been decremented.
+                                    StreamTaskScope const streamTaskScope(*pDevImpl);
+                                    task();
+                                });
+                        }
+                        catch(...)
+                        {
+                            m_numStreamTasks.fetch_sub(1u, std::memory_order_seq_cst);
+                            throw;
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The number of threads currently running stream tasks, the workers of the stream thread pool and the helpers compensating blocked ones.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getStreamThreadCount()
+                    -> std::size_t
+                    {
+                        return getStreamThreadPool().getConcurrentExecutionCount() + m_numStreamHelpers.load(std::memory_order_acquire);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Releases the given number of workers previously acquired with acquireThreadPool.
+                    //! The workers are kept alive for later use.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto releaseThreadPool(
+                        std::size_t const & numWorkers)
+                    -> void
+                    {
+                        std::lock_guard<std::mutex> lk(m_mtxThreadPool);
+
+                        assert(m_numWorkersAcquired >= numWorkers);
+                        m_numWorkersAcquired -= numWorkers;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The pool recycling the implementation objects of the given type.
+                    //!
+                    //! Pools exist for the event and asynchronous stream implementations.
+                    //! They are created on first use.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TImpl>
+                    ALPAKA_FN_HOST auto getRecyclingPool()
+                    -> core::detail::RecyclingPool<TImpl> &
+                    {
+                        auto & recyclingPoolSlot(getRecyclingPoolSlot(static_cast<TImpl const *>(nullptr)));
+                        std::call_once(
+                            recyclingPoolSlot.m_onceFlag,
+                            [&recyclingPoolSlot]()
                             {
-                                throw std::logic_error("One of the streams registered on the device is invalid!");
-                            }
+                                recyclingPoolSlot.m_spPool = std::make_shared<core::detail::RecyclingPool<TImpl>>(64u);
+                            });
+
+                        return *recyclingPoolSlot.m_spPool;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The cache of the buffer memory of this device.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getBufCache() const
+                    -> std::shared_ptr<mem::alloc::cpu::detail::BlockCache> const &
+                    {
+                        return m_spBufCache;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Deletes the unused objects in all recycling pools.
+                    //!
+                    //! The recycled objects hold a handle to this device, so the device can only be destroyed after they have been deleted.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto clearRecyclingPools()
+                    -> void
+                    {
+                        if(m_eventCpuImplPool.m_spPool)
+                        {
+                            m_eventCpuImplPool.m_spPool->clear();
+                        }
+                        if(m_streamCpuAsyncImplPool.m_spPool)
+                        {
+                            m_streamCpuAsyncImplPool.m_spPool->clear();
                         }
-                        return vspStreams;
                     }
 
                 private:
                     //-----------------------------------------------------------------------------
                     //! Registers the given stream on this device.
-                    //! NOTE: Every stream has to be registered for correct functionality of device wait operations!
+                    //! NOTE: Every stream has to be registered for correct functionality of event waits on the device!
+                    //!
+                    //! \return The slot to unregister the stream with.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto RegisterAsyncStream(std::shared_ptr<stream::cpu::detail::StreamCpuAsyncImpl> const & spStreamImpl)
+                    -> core::detail::LockFreeRegistry<stream::cpu::detail::StreamCpuAsyncImpl>::Slot *
+                    {
+                        return m_registryAsyncStreams.add(spStreamImpl);
+                    }
                     //-----------------------------------------------------------------------------
-                    ALPAKA_FN_HOST auto RegisterAsyncStream(std::shared_ptr<stream::cpu::detail::StreamCpuAsyncImpl> spStreamImpl)
+                    //! Unregisters the stream registered in the given slot from this device.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto UnregisterAsyncStream(core::detail::LockFreeRegistry<stream::cpu::detail::StreamCpuAsyncImpl>::Slot * const pSlot)
                     -> void
                     {
-                        std::lock_guard<std::mutex> lk(m_Mutex);
+                        m_registryAsyncStreams.remove(pSlot);
+                    }
 
-                        // Register this stream on the device.
-                        // NOTE: We have to store the plain pointer next to the weak pointer.
-                        // This is necessary to find the entry on unregistering because the weak pointer will already be invalid at that point.
-                        m_mapStreams.emplace(spStreamImpl.get(), spStreamImpl);
+                    //-----------------------------------------------------------------------------
+                    //! Registers the given parallel stream on this device.
+                    //!
+                    //! \return The slot to unregister the stream with.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto RegisterParallelStream(std::shared_ptr<stream::cpu::detail::StreamCpuParallelImpl> const & spStreamImpl)
+                    -> core::detail::LockFreeRegistry<stream::cpu::detail::StreamCpuParallelImpl>::Slot *
+                    {
+                        return m_registryParallelStreams.add(spStreamImpl);
                     }
                     //-----------------------------------------------------------------------------
-                    //! Unregisters the given stream from this device.
+                    //! Unregisters the parallel stream registered in the given slot from this device.
                     //-----------------------------------------------------------------------------
-                    ALPAKA_FN_HOST auto UnregisterAsyncStream(stream::cpu::detail::StreamCpuAsyncImpl const * const pStream) noexcept(false)
+                    ALPAKA_FN_HOST auto UnregisterParallelStream(core::detail::LockFreeRegistry<stream::cpu::detail::StreamCpuParallelImpl>::Slot * const pSlot)
                     -> void
                     {
-                        std::lock_guard<std::mutex> lk(m_Mutex);
+                        m_registryParallelStreams.remove(pSlot);
+                    }
 
-                        // Unregister this stream from the device.
-                        auto const itFind(std::find_if(
-                            m_mapStreams.begin(),
-                            m_mapStreams.end(),
-                            [pStream](std::pair<stream::cpu::detail::StreamCpuAsyncImpl *, std::weak_ptr<stream::cpu::detail::StreamCpuAsyncImpl>> const & pair)
+                    //-----------------------------------------------------------------------------
+                    //! Compensates blocked workers of the stream thread pool.
+                    //!
+                    //! The monitor sleeps until an enqueue finds all threads busy.
+                    //! Then it checks once per interval if any stream task has been started.
+                    //! If none has, while tasks wait for a thread, all threads are blocked or busy with long tasks and a helper thread is added.
+                    //! The helpers run the queued tasks until the queue is empty and then exit, so the number of threads returns to the size of the pool.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto monitorStreamThreadPool()
+                    -> void
+                    {
+                        std::unique_lock<std::mutex> lk(m_mtxStreamPoolMonitor);
+                        for(;;)
+                        {
+                            m_cvStreamPoolMonitor.wait(
+                                lk,
+                                [this]()
+                                {
+                                    return m_bStreamPoolMonitorShutdown || m_bStreamPoolMonitorArmed.load(std::memory_order_seq_cst);
+                                });
+
+                            auto numStreamTasksStarted(m_numStreamTasksStarted.load(std::memory_order_relaxed));
+                            for(;;)
                             {
-                                return (pStream == pair.first);
-                            }));
-                        if(itFind != m_mapStreams.end())
+                                if(m_cvStreamPoolMonitor.wait_for(
+                                    lk,
+                                    std::chrono::milliseconds(10),
+                                    [this]()
+                                    {
+                                        return m_bStreamPoolMonitorShutdown;
+                                    }))
+                                {
+                                    return;
+                                }
+
+                                if(!hasStreamTasksWaiting())
+                                {
+                                    m_bStreamPoolMonitorArmed.store(false, std::memory_order_seq_cst);
+                                    // An enqueue may have seen the monitor still armed.
+                                    if(!hasStreamTasksWaiting())
+                                    {
+                                        break;
+                                    }
+                                    m_bStreamPoolMonitorArmed.store(true, std::memory_order_seq_cst);
+                                }
+
+                                auto const numStreamTasksStartedNow(m_numStreamTasksStarted.load(std::memory_order_relaxed));
+                                if(numStreamTasksStartedNow == numStreamTasksStarted)
+                                {
+                                    lk.unlock();
+                                    if(!addStreamHelper())
+                                    {
+                                        return;
+                                    }
+                                    lk.lock();
+                                }
+                                numStreamTasksStarted = numStreamTasksStartedNow;
+                            }
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return If stream tasks have been enqueued but not started.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto hasStreamTasksWaiting() const
+                    -> bool
+                    {
+                        auto const numStreamTasksRunning(m_numStreamTasksRunning.load(std::memory_order_seq_cst));
+                        return m_numStreamTasks.load(std::memory_order_seq_cst) > numStreamTasksRunning;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Starts a helper thread running the queued stream tasks until the queue is empty.
+                    //!
+                    //! The helper is detached and keeps the device alive while it runs, so it may be the one destroying it.
+                    //!
+                    //! \return false if the device has been destroyed on the calling thread because the helper could not be started.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto addStreamHelper()
+                    -> bool
+                    {
+                        std::unique_ptr<std::shared_ptr<DevCpuImpl>> upspThis;
+                        try
+                        {
+                            upspThis.reset(new std::shared_ptr<DevCpuImpl>(shared_from_this()));
+                        }
+                        catch(std::bad_weak_ptr const &)
                         {
-                            m_mapStreams.erase(itFind);
+                            // The device is being destroyed.
+                            return true;
                         }
-                        else
+
+                        m_numStreamHelpers.fetch_add(1u, std::memory_order_acq_rel);
+                        try
                         {
-                            throw std::logic_error("The stream to unregister from the device could not be found in the list of registered streams!");
+                            // The reference is only handed over to the helper when it has been started.
+                            std::thread(
+                                [](std::shared_ptr<DevCpuImpl> * const pspDevImpl)
+                                {
+                                    std::unique_ptr<std::shared_ptr<DevCpuImpl>> const upspDevImpl(pspDevImpl);
+                                    DevCpuImpl & devImpl(**upspDevImpl);
+                                    while(devImpl.m_upStreamThreadPool->runNextTask())
+                                    {
+                                    }
+                                    devImpl.m_numStreamHelpers.fetch_sub(1u, std::memory_order_acq_rel);
+                                },
+                                upspThis.get()).detach();
+                            upspThis.release();
                         }
+                        catch(...)
+                        {
+                            m_numStreamHelpers.fetch_sub(1u, std::memory_order_acq_rel);
+                            // Nobody else can take a new reference, so the device is destroyed here if this was the last one.
+                            if(upspThis->use_count() == 1)
+                            {
+                                upspThis.reset();
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    //#############################################################################
+                    //! Counts a stream task as running while it is in the scope, even if it throws.
+                    //#############################################################################
+                    class StreamTaskScope final
+                    {
+                    public:
+                        //-----------------------------------------------------------------------------
+                        //! Constructor.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST explicit StreamTaskScope(
+                            DevCpuImpl & devImpl) :
+                                m_devImpl(devImpl)
+                        {
+                            m_devImpl.m_numStreamTasksRunning.fetch_add(1u, std::memory_order_seq_cst);
+                            m_devImpl.m_numStreamTasksStarted.fetch_add(1u, std::memory_order_relaxed);
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! Copy constructor.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST StreamTaskScope(StreamTaskScope const &) = delete;
+                        //-----------------------------------------------------------------------------
+                        //! Copy assignment operator.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto operator=(StreamTaskScope const &) -> StreamTaskScope & = delete;
+                        //-----------------------------------------------------------------------------
+                        //! Destructor.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST ~StreamTaskScope()
+                        {
+                            m_devImpl.m_numStreamTasksRunning.fetch_sub(1u, std::memory_order_seq_cst);
+                            m_devImpl.m_numStreamTasks.fetch_sub(1u, std::memory_order_seq_cst);
+                        }
+
+                    private:
+                        DevCpuImpl & m_devImpl;
+                    };
+
+                    //#############################################################################
+                    //! A lazily created recycling pool.
+                    //#############################################################################
+                    template<
+                        typename TImpl>
+                    struct RecyclingPoolSlot
+                    {
+                        std::once_flag m_onceFlag;
+                        std::shared_ptr<core::detail::RecyclingPool<TImpl>> m_spPool;
+                    };
+                    //-----------------------------------------------------------------------------
+                    //! \return The recycling pool of the event implementations.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getRecyclingPoolSlot(event::cpu::detail::EventCpuImpl const *)
+                    -> RecyclingPoolSlot<event::cpu::detail::EventCpuImpl> &
+                    {
+                        return m_eventCpuImplPool;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The recycling pool of the asynchronous stream implementations.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getRecyclingPoolSlot(stream::cpu::detail::StreamCpuAsyncImpl const *)
+                    -> RecyclingPoolSlot<stream::cpu::detail::StreamCpuAsyncImpl> &
+                    {
+                        return m_streamCpuAsyncImplPool;
                     }
 
                 private:
-                    std::mutex mutable m_Mutex;
-                    std::map<stream::cpu::detail::StreamCpuAsyncImpl *, std::weak_ptr<stream::cpu::detail::StreamCpuAsyncImpl>> m_mapStreams;
+                    core::detail::LockFreeRegistry<stream::cpu::detail::StreamCpuAsyncImpl> m_registryAsyncStreams;
+                    core::detail::LockFreeRegistry<stream::cpu::detail::StreamCpuParallelImpl> m_registryParallelStreams;
+
+                    std::atomic<std::size_t> m_numStreamsBusy{0u};  //!< The number of streams with pending tasks.
+                    std::atomic<std::size_t> m_numProgressWaiters{0u};  //!< The number of threads in waitForStreamProgress.
+                    std::mutex m_mtxProgress;
+                    std::condition_variable m_cvProgress;
+
+                    std::mutex m_mtxThreadPool;
+                    std::unique_ptr<ThreadPool> m_upThreadPool;     //!< The lazily created worker pool.
+                    std::size_t m_numWorkersAcquired = 0u;          //!< The number of workers currently in use by all acquirers.
+
+                    std::once_flag m_onceFlagStreamThreadPool;
+                    std::unique_ptr<ThreadPool> m_upStreamThreadPool;   //!< The lazily created pool running the asynchronous streams.
+                    std::atomic<std::size_t> m_numStreamTasks{0u};      //!< The number of stream tasks scheduled or running on the stream thread pool.
+                    std::atomic<std::size_t> m_numStreamTasksRunning{0u};   //!< The number of stream tasks running on a worker or a helper.
+                    std::atomic<std::uint64_t> m_numStreamTasksStarted{0u}; //!< The number of stream tasks started since construction.
+                    std::atomic<std::size_t> m_numStreamHelpers{0u};    //!< The number of helper threads compensating blocked workers.
+                    std::mutex m_mtxStreamPoolMonitor;
+                    std::condition_variable m_cvStreamPoolMonitor;
+                    std::atomic<bool> m_bStreamPoolMonitorArmed{false}; //!< If the monitor checks for blocked workers.
+                    bool m_bStreamPoolMonitorShutdown = false;
+                    std::thread m_streamPoolMonitor;
+
+                    RecyclingPoolSlot<event::cpu::detail::EventCpuImpl> m_eventCpuImplPool;
+                    RecyclingPoolSlot<stream::cpu::detail::StreamCpuAsyncImpl> m_streamCpuAsyncImplPool;
+
+                    //! The buffers hold a reference to the cache, so it outlives the device if necessary. It is disabled until a limit is set.
+                    std::shared_ptr<mem::alloc::cpu::detail::BlockCache> m_spBufCache{std::make_shared<mem::alloc::cpu::detail::BlockCache>()};
+                };
+
+                //#############################################################################
+                //! Workers acquired from the device thread pool for the lifetime of this object.
+                //!
+                //! The workers are released on destruction, so the acquired count does not leak when the user of the pool throws.
+                //#############################################################################
+                class ThreadPoolAcquisition final
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    //! Constructor acquiring the given number of workers.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST ThreadPoolAcquisition(
+                        DevCpuImpl & devImpl,
+                        std::size_t const & numWorkers) :
+                            m_devImpl(devImpl),
+                            m_numWorkers(numWorkers),
+                            m_threadPool(devImpl.acquireThreadPool(numWorkers))
+                    {}
+                    //-----------------------------------------------------------------------------
+                    //! Copy constructor.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST ThreadPoolAcquisition(ThreadPoolAcquisition const &) = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Move constructor.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST ThreadPoolAcquisition(ThreadPoolAcquisition &&) = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Copy assignment operator.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto operator=(ThreadPoolAcquisition const &) -> ThreadPoolAcquisition & = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Move assignment operator.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto operator=(ThreadPoolAcquisition &&) -> ThreadPoolAcquisition & = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Destructor releasing the workers.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST ~ThreadPoolAcquisition()
+                    {
+                        m_devImpl.releaseThreadPool(m_numWorkers);
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! \return The device thread pool.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getThreadPool() const
+                    -> DevCpuImpl::ThreadPool &
+                    {
+                        return m_threadPool;
+                    }
+
+                private:
+                    DevCpuImpl & m_devImpl;
+                    std::size_t const m_numWorkers;
+                    DevCpuImpl::ThreadPool & m_threadPool;
                 };
             }
         }
@@ -178,8 +727,9 @@ namespace alpaka
             //-----------------------------------------------------------------------------
             //! Constructor.
             //-----------------------------------------------------------------------------
-            ALPAKA_FN_HOST DevCpu() :
-                m_spDevCpuImpl(std::make_shared<cpu::detail::DevCpuImpl>())
+            ALPAKA_FN_HOST DevCpu(
+                std::shared_ptr<cpu::detail::DevCpuImpl> const & spDevCpuImpl) :
+                m_spDevCpuImpl(spDevCpuImpl)
             {}
         public:
             //-----------------------------------------------------------------------------
@@ -228,6 +778,31 @@ namespace alpaka
         //#############################################################################
         class DevManCpu
         {
+        private:
+            //#############################################################################
+            //! Owns the device implementation shared by all handles.
+            //!
+            //! The recycled events and streams hold a handle to the device, so their pools are cleared at program exit before the owner releases the device.
+            //#############################################################################
+            struct DevCpuImplOwner
+            {
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST DevCpuImplOwner() :
+                    m_spDevCpuImpl(std::make_shared<cpu::detail::DevCpuImpl>())
+                {}
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST ~DevCpuImplOwner()
+                {
+                    m_spDevCpuImpl->clearRecyclingPools();
+                }
+
+                std::shared_ptr<cpu::detail::DevCpuImpl> const m_spDevCpuImpl;
+            };
+
         public:
             //-----------------------------------------------------------------------------
             //! Constructor.
@@ -261,7 +836,10 @@ namespace alpaka
                     throw std::runtime_error(ssErr.str());
                 }
 
-                return {};
+                // All handles share the same implementation so that the stream registry and the worker pool are device wide.
+                static DevCpuImplOwner const devCpuImplOwner;
+
+                return DevCpu(devCpuImplOwner.m_spDevCpuImpl);
             }
         };
 
@@ -277,6 +855,39 @@ namespace alpaka
 
                 return DevManCpu::getDevByIdx(0);
             }
+
+            //-----------------------------------------------------------------------------
+            //! Sets the limit of the size of the unused buffer memory the device keeps for reuse.
+            //!
+            //! Iterations that allocate and free buffers of the same sizes then reuse the memory of the previous iteration without system calls or page faults.
+            //! Memory exceeding the limit is given back to the system. A limit of 0 disables the cache, which is the default.
+            //! Only the buffers allocated while the cache is enabled are returned to it.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto setBufCacheLimit(
+                DevCpu const & dev,
+                std::size_t const & maxCachedBytes)
+            -> void
+            {
+                dev.m_spDevCpuImpl->getBufCache()->setMaxCachedBytes(maxCachedBytes);
+            }
+            //-----------------------------------------------------------------------------
+            //! Gives all unused buffer memory cached by the device back to the system.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto trimBufCache(
+                DevCpu const & dev)
+            -> void
+            {
+                dev.m_spDevCpuImpl->getBufCache()->trim();
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The statistics of the buffer memory cache of the device.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto getBufCacheStats(
+                DevCpu const & dev)
+            -> mem::alloc::CacheStats
+            {
+                return dev.m_spDevCpuImpl->getBufCache()->getStats();
+            }
         }
     }
 
@@ -476,51 +1087,4 @@ namespace alpaka
             }
         }
     }
-    namespace wait
-    {
-        namespace traits
-        {
-            //#############################################################################
-            //! The CPU device thread wait specialization.
-            //!
-            //! Blocks until the device has completed all preceding requested tasks.
-            //! Tasks that are enqueued or streams that are created after this call is made are not waited for.
-            //#############################################################################
-            template<>
-            struct CurrentThreadWaitFor<
-                dev::DevCpu>
-            {
-                //-----------------------------------------------------------------------------
-                //
-                //-----------------------------------------------------------------------------
-                ALPAKA_FN_HOST static auto currentThreadWaitFor(
-                    dev::DevCpu const & dev)
-                -> void
-                {
-                    ALPAKA_DEBUG_FULL_LOG_SCOPE;
-
-                    // Get all the streams on the device at the time of invocation.
-                    // All streams added afterwards are ignored.
-                    auto vspStreams(
-                        dev.m_spDevCpuImpl->GetAllAsyncStreamImpls());
-
-                    // Enqueue an event in every asynchronous stream on the device.
-                    // \TODO: This should be done atomically for all streams.
-                    // Furthermore there should not even be a chance to enqueue something between getting the streams and adding our wait events!
-                    std::vector<event::EventCpu> vEvents;
-                    for(auto && spStream : vspStreams)
-                    {
-                        vEvents.emplace_back(dev);
-                        stream::enqueue(spStream, vEvents.back());
-                    }
-
-                    // Now wait for all the events.
-                    for(auto && event : vEvents)
-                    {
-                        wait::wait(event);
-                    }
-                }
-            };
-        }
-    }
 }
@@ -0,0 +1,182 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/mem/alloc/AllocCpuHugePages.hpp>   // mem::alloc::cpu::detail::getPageSizeBytes
+
+#include <boost/predef.h>                           // BOOST_XXX
+
+#if BOOST_OS_LINUX
+    #include <linux/mempolicy.h>                    // MPOL_XXX
+    #include <sys/syscall.h>                        // SYS_mbind, SYS_move_pages
+    #include <unistd.h>                             // syscall
+    #include <fstream>                              // std::ifstream
+    #include <string>                               // std::string
+#endif
+
+#include <algorithm>                                // std::min
+#include <cstddef>                                  // std::size_t
+#include <cstdint>                                  // std::uintptr_t
+#include <vector>                                   // std::vector
+
+namespace alpaka
+{
+    namespace dev
+    {
+        namespace cpu
+        {
+            //#############################################################################
+            //! The ways the pages of a buffer can be placed onto the NUMA nodes.
+            //#############################################################################
+            enum class NumaPolicy
+            {
+                FirstTouch, //!< Every page is placed on the node of the thread touching it first. This is the system default.
+                Interleave, //!< The pages are spread round-robin over the nodes.
+                Bind        //!< The pages are only placed on the given nodes.
+            };
+
+            namespace detail
+            {
+                //-----------------------------------------------------------------------------
+                //! \return The mask of the online NUMA nodes with one bit per node. Systems without NUMA support have a single node.
+                //-----------------------------------------------------------------------------
+                inline auto getNumaNodeMask()
+                -> unsigned long
+                {
+                    unsigned long nodeMask(0u);
+#if BOOST_OS_LINUX
+                    // The file contains a list of ranges like 0-1,4.
+                    std::ifstream online("/sys/devices/system/node/online");
+                    std::string ranges;
+                    if(online >> ranges)
+                    {
+                        std::size_t pos(0u);
+                        while(pos < ranges.size())
+                        {
+                            std::size_t const end(std::min(ranges.find(',', pos), ranges.size()));
+                            std::string const range(ranges.substr(pos, end - pos));
+                            std::size_t const dash(range.find('-'));
+                            unsigned long const first(std::stoul(range.substr(0u, dash)));
+                            unsigned long const last((dash == std::string::npos) ? first : std::stoul(range.substr(dash + 1u)));
+                            for(unsigned long node(first); (node <= last) && (node < sizeof(unsigned long) * 8u); ++node)
+                            {
+                                nodeMask |= (1ul << node);
+                            }
+                            pos = end + 1u;
+                        }
+                    }
+#endif
+                    return (nodeMask != 0u) ? nodeMask : 1ul;
+                }
+                //-----------------------------------------------------------------------------
+                //! Sets the placement policy of the pages of the given memory range. The memory has to start at a page boundary.
+                //!
+                //! This only has an effect on pages that are touched afterwards.
+                //!
+                //! \param nodeMask The nodes to use with one bit per node. A mask of 0 selects all online nodes.
+                //! \return If the policy could be set. Systems without mbind only support first touch placement.
+                //-----------------------------------------------------------------------------
+                inline auto setNumaPolicy(
+                    void * const pMem,
+                    std::size_t const & sizeBytes,
+                    NumaPolicy const & policy,
+                    unsigned long const & nodeMask)
+                -> bool
+                {
+#if BOOST_OS_LINUX && defined(SYS_mbind)
+                    if(policy == NumaPolicy::FirstTouch)
+                    {
+                        return true;
+                    }
+                    unsigned long const mask((nodeMask != 0u) ? nodeMask : getNumaNodeMask());
+                    // The kernel only reads maxnode - 1 bits.
+                    return
+                        syscall(
+                            SYS_mbind,
+                            pMem,
+                            sizeBytes,
+                            (policy == NumaPolicy::Interleave) ? MPOL_INTERLEAVE : MPOL_BIND,
+                            &mask,
+                            sizeof(unsigned long) * 8u + 1u,
+                            0u) == 0;
+#else
+                    boost::ignore_unused(pMem);
+                    boost::ignore_unused(sizeBytes);
+                    boost::ignore_unused(nodeMask);
+                    return policy == NumaPolicy::FirstTouch;
+#endif
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The number of pages of the given memory range placed on each node, indexed by node.
+                //!  Pages that have not been touched yet are not counted. The vector is empty if the placement can not be queried.
+                //-----------------------------------------------------------------------------
+                inline auto getPageNodeCounts(
+                    void const * const pMem,
+                    std::size_t const & sizeBytes)
+                -> std::vector<std::size_t>
+                {
+                    std::vector<std::size_t> pageCounts;
+#if BOOST_OS_LINUX && defined(SYS_move_pages)
+                    std::size_t const pageSizeBytes(mem::alloc::cpu::detail::getPageSizeBytes());
+                    std::uintptr_t const begin(reinterpret_cast<std::uintptr_t>(pMem) & ~static_cast<std::uintptr_t>(pageSizeBytes - 1u));
+                    std::uintptr_t const end(reinterpret_cast<std::uintptr_t>(pMem) + sizeBytes);
+
+                    // Without target nodes move_pages only reports the node of every page.
+                    std::size_t const batchPageCount(1024u);
+                    std::vector<void *> pages;
+                    std::vector<int> status;
+                    pages.reserve(batchPageCount);
+                    for(std::uintptr_t batchBegin(begin); batchBegin < end; batchBegin += batchPageCount * pageSizeBytes)
+                    {
+                        pages.clear();
+                        for(std::uintptr_t page(batchBegin); (page < end) && (pages.size() < batchPageCount); page += pageSizeBytes)
+                        {
+                            pages.push_back(reinterpret_cast<void *>(page));
+                        }
+                        status.assign(pages.size(), 0);
+                        if(syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0)
+                        {
+                            return std::vector<std::size_t>();
+                        }
+                        for(int const node : status)
+                        {
+                            // Negative values are errors like pages that are not present.
+                            if(node >= 0)
+                            {
+                                if(static_cast<std::size_t>(node) >= pageCounts.size())
+                                {
+                                    pageCounts.resize(static_cast<std::size_t>(node) + 1u, 0u);
+                                }
+                                ++pageCounts[static_cast<std::size_t>(node)];
+                            }
+                        }
+                    }
+#else
+                    boost::ignore_unused(pMem);
+                    boost::ignore_unused(sizeBytes);
+#endif
+                    return pageCounts;
+                }
+            }
+        }
+    }
+}
@@ -28,14 +28,17 @@
 #include <alpaka/dev/Traits.hpp>            // GetDev
 
 #include <alpaka/stream/StreamCpuAsync.hpp> // stream::StreamCpuAsync
+#include <alpaka/stream/StreamCpuParallel.hpp>  // stream::StreamCpuParallel
 #include <alpaka/stream/StreamCpuSync.hpp>  // stream::StreamCpuSync
+#include <alpaka/core/UniqueId.hpp>         // core::detail::getNextUniqueId
 
-#include <boost/uuid/uuid.hpp>              // boost::uuids::uuid
-#include <boost/uuid/uuid_generators.hpp>   // boost::uuids::random_generator
-#include <boost/core/ignore_unused.hpp>     // boost::ignore_unused
-
+#include <chrono>                           // std::chrono::steady_clock
+#include <cstdint>                          // std::uint64_t
 #include <mutex>                            // std::mutex
 #include <condition_variable>               // std::condition_variable
+#include <functional>                       // std::function
+#include <vector>                           // std::vector
+#include <stdexcept>                        // std::runtime_error
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
     #include <iostream>                     // std::cout
 #endif
@@ -59,12 +62,15 @@ namespace alpaka
                     //-----------------------------------------------------------------------------
                     ALPAKA_FN_HOST EventCpuImpl(
                         dev::DevCpu const & dev) :
-                            m_uuid(boost::uuids::random_generator()()),
+                            m_id(core::detail::getNextUniqueId<EventCpuImpl>()),
                             m_dev(dev),
                             m_Mutex(),
                             m_bIsReady(true),
                             m_bIsWaitedFor(false),
-                            m_canceledEnqueueCount(0)
+                            m_canceledEnqueueCount(0),
+                            m_completionCount(0),
+                            m_tpCompleted(),
+                            m_vContinuations()
                     {}
                     //-----------------------------------------------------------------------------
                     //! Copy constructor.
@@ -95,8 +101,29 @@ namespace alpaka
 #else
                     = default;
 #endif
+                    //-----------------------------------------------------------------------------
+                    //! Resets the event to the state after construction before it is handed out again by the recycling pool of the device.
+                    //! The event is not referenced by any stream at this point, so nobody can resume from its continuations.
+                    //!
+                    //! \return If the event can be reused for the given device. The pool belongs to the device, so this is always the case.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto recycle(
+                        dev::DevCpu const &)
+                    -> bool
+                    {
+                        assert(m_vContinuations.empty());
+
+                        m_id = core::detail::getNextUniqueId<EventCpuImpl>();
+                        m_bIsReady = true;
+                        m_bIsWaitedFor = false;
+                        m_canceledEnqueueCount = 0u;
+                        m_completionCount = 0u;
+                        m_tpCompleted = std::chrono::steady_clock::time_point();
+                        return true;
+                    }
+
                 public:
-                    boost::uuids::uuid const m_uuid;                        //!< The unique ID.
+                    std::uint64_t m_id;                                     //!< The unique ID. It changes when the event is recycled.
                     dev::DevCpu const m_dev;                                //!< The device this event is bound to.
 
                     std::mutex mutable m_Mutex;                             //!< The mutex used to synchronize access to the event.
@@ -107,7 +134,37 @@ namespace alpaka
                     bool m_bIsWaitedFor;                                    //!< If a (one or multiple) streams wait for this event. The event can not be changed (deleted/re-enqueued) until completion.
 
                     std::size_t m_canceledEnqueueCount;                    //!< The number of successive re-enqueues while it was already in the queue. Reset on completion.
+
+                    std::size_t m_completionCount;                          //!< The number of completions. Identifies the enqueue a stream waits for.
+                    std::chrono::steady_clock::time_point m_tpCompleted;    //!< The time of the last completion.
+                    std::vector<std::function<void()>> m_vContinuations;   //!< The functions called once on the next completion. Used by streams waiting for the event without blocking a thread.
                 };
+
+                //-----------------------------------------------------------------------------
+                //! Signals the completion of the event and calls its continuations.
+                //!
+                //! \param lk The lock of the event mutex. It is unlocked before the waiters are notified.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto completeEvent(
+                    EventCpuImpl & eventImpl,
+                    std::unique_lock<std::mutex> & lk)
+                -> void
+                {
+                    eventImpl.m_tpCompleted = std::chrono::steady_clock::now();
+                    eventImpl.m_bIsWaitedFor = false;
+                    eventImpl.m_bIsReady = true;
+                    ++eventImpl.m_completionCount;
+                    auto const vContinuations(std::move(eventImpl.m_vContinuations));
+                    eventImpl.m_vContinuations.clear();
+                    lk.unlock();
+
+                    eventImpl.m_ConditionVariable.notify_all();
+                    // The continuations are called without the lock because they may enqueue tasks or use the event.
+                    for(auto const & continuation : vContinuations)
+                    {
+                        continuation();
+                    }
+                }
             }
         }
 
@@ -122,7 +179,7 @@ namespace alpaka
             //-----------------------------------------------------------------------------
             ALPAKA_FN_HOST EventCpu(
                 dev::DevCpu const & dev) :
-                    m_spEventCpuImpl(std::make_shared<cpu::detail::EventCpuImpl>(dev))
+                    m_spEventCpuImpl(dev.m_spDevCpuImpl->getRecyclingPool<cpu::detail::EventCpuImpl>().acquire(dev))
             {}
             //-----------------------------------------------------------------------------
             //! Copy constructor.
@@ -146,7 +203,7 @@ namespace alpaka
             ALPAKA_FN_HOST auto operator==(EventCpu const & rhs) const
             -> bool
             {
-                return (m_spEventCpuImpl->m_uuid == rhs.m_spEventCpuImpl->m_uuid);
+                return (m_spEventCpuImpl->m_id == rhs.m_spEventCpuImpl->m_id);
             }
             //-----------------------------------------------------------------------------
             //! Inequality comparison operator.
@@ -218,6 +275,43 @@ namespace alpaka
                     return event.m_spEventCpuImpl->m_bIsReady;
                 }
             };
+
+            //#############################################################################
+            //! The CPU device event elapsed time trait specialization.
+            //#############################################################################
+            template<>
+            struct EventElapsedTime<
+                event::EventCpu>
+            {
+                //-----------------------------------------------------------------------------
+                //! \return The time between the completions of the given events.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto eventElapsedTime(
+                    event::EventCpu const & start,
+                    event::EventCpu const & stop)
+                -> std::chrono::nanoseconds
+                {
+                    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        getCompletionTime(stop) - getCompletionTime(start));
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! \return The time the event has been completed.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getCompletionTime(
+                    event::EventCpu const & event)
+                -> std::chrono::steady_clock::time_point
+                {
+                    std::lock_guard<std::mutex> lk(event.m_spEventCpuImpl->m_Mutex);
+
+                    if(!event.m_spEventCpuImpl->m_bIsReady || (event.m_spEventCpuImpl->m_completionCount == 0u))
+                    {
+                        throw std::runtime_error("The elapsed time can only be queried between completed events!");
+                    }
+                    return event.m_spEventCpuImpl->m_tpCompleted;
+                }
+            };
         }
     }
     namespace stream
@@ -240,62 +334,72 @@ namespace alpaka
                     event::EventCpu & event)
                 -> void
                 {
+                    if(spStreamImpl->m_upCaptureGraph)
+                    {
+                        throw std::runtime_error("Events can not be captured into a graph!");
+                    }
+
                     // Copy the shared pointer of the event implementation.
                     // This is forwarded to the lambda that is enqueued into the stream to ensure that the event implementation is alive as long as it is enqueued.
                     auto spEventCpuImpl(event.m_spEventCpuImpl);
 
-                    // Setting the event state and enqueuing it has to be atomic.
-                    std::lock_guard<std::mutex> lk(spEventCpuImpl->m_Mutex);
-
-                    // This is a invariant: If the event is ready (not enqueued) there can not be anybody waiting for it.
-                    assert(!(spEventCpuImpl->m_bIsReady && spEventCpuImpl->m_bIsWaitedFor));
-
-                    // If it is enqueued ...
-                    if(!spEventCpuImpl->m_bIsReady)
+                    for(;;)
                     {
-                        // ... and somebody is waiting for it, it can NOT be re-enqueued.
-                        if(spEventCpuImpl->m_bIsWaitedFor)
                         {
+                            // Setting the event state and enqueuing it has to be atomic.
+                            std::lock_guard<std::mutex> lk(spEventCpuImpl->m_Mutex);
+
+                            // This is a invariant: If the event is ready (not enqueued) there can not be anybody waiting for it.
+                            assert(!(spEventCpuImpl->m_bIsReady && spEventCpuImpl->m_bIsWaitedFor));
+
+                            // If it is enqueued and somebody is waiting for it, it can NOT be re-enqueued.
+                            if((!spEventCpuImpl->m_bIsReady) && spEventCpuImpl->m_bIsWaitedFor)
+                            {
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
-                            std::cout << BOOST_CURRENT_FUNCTION << "WARNING: The event to enqueue is already enqueued AND waited on. It can NOT be re-enqueued!" << std::endl;
+                                std::cout << BOOST_CURRENT_FUNCTION << "WARNING: The event to enqueue is already enqueued AND waited on. It can NOT be re-enqueued!" << std::endl;
 #endif
-                            return;
-                        }
-                        // ... and noby is waiting for it, increment the cancel counter.
-                        else
-                        {
-                            ++spEventCpuImpl->m_canceledEnqueueCount;
-                        }
-                    }
-                    // If it is not enqueued, set its state to enqueued.
-                    else
-                    {
-                        spEventCpuImpl->m_bIsReady = false;
-                    }
+                                return;
+                            }
 
-                    // We can not unlock the mutex here, because the order of events enqueued has to be identical to the call order.
-                    // Unlocking here would allow a later enqueue call to complete before this event is enqueued.
+                            // We can not unlock the mutex here, because the order of events enqueued has to be identical to the call order.
+                            // Unlocking here would allow a later enqueue call to complete before this event is enqueued.
 
-                    // Enqueue a task that only resets the events flag if it is completed.
-                    spStreamImpl->m_workerThread.enqueueTask(
-                        [spEventCpuImpl]()
-                        {
+                            // Enqueue a task that only resets the events flag if it is completed.
+                            // It can not run before the state is updated below because it locks the same mutex.
+                            if(spStreamImpl->tryEnqueueTask(
+                                [spEventCpuImpl]()
+                                {
+                                    std::unique_lock<std::mutex> lk(spEventCpuImpl->m_Mutex);
+                                    // Nothing to do if it has been re-enqueued to a later position in the queue.
+                                    if(spEventCpuImpl->m_canceledEnqueueCount > 0)
+                                    {
+                                        --spEventCpuImpl->m_canceledEnqueueCount;
+                                        return;
+                                    }
+                                    else
+                                    {
+                                        event::cpu::detail::completeEvent(*spEventCpuImpl, lk);
+                                    }
+                                }))
                             {
-                                std::lock_guard<std::mutex> lk(spEventCpuImpl->m_Mutex);
-                                // Nothing to do if it has been re-enqueued to a later position in the queue.
-                                if(spEventCpuImpl->m_canceledEnqueueCount > 0)
+                                // If it is enqueued and nobody is waiting for it, increment the cancel counter.
+                                if(!spEventCpuImpl->m_bIsReady)
                                 {
-                                    --spEventCpuImpl->m_canceledEnqueueCount;
-                                    return;
+                                    ++spEventCpuImpl->m_canceledEnqueueCount;
                                 }
+                                // If it is not enqueued, set its state to enqueued.
                                 else
                                 {
-                                    spEventCpuImpl->m_bIsWaitedFor = false;
-                                    spEventCpuImpl->m_bIsReady = true;
+                                    spEventCpuImpl->m_bIsReady = false;
                                 }
+                                return;
                             }
-                            spEventCpuImpl->m_ConditionVariable.notify_all();
-                        });
+                        }
+
+                        // The stream queue is full.
+                        // The mutex must not be held while waiting for space because earlier enqueues of this event lock it when they are executed.
+                        spStreamImpl->waitForQueueSpace();
+                    }
                 }
             };
             //#############################################################################
@@ -318,6 +422,90 @@ namespace alpaka
                 }
             };
             //#############################################################################
+            //! The CPU parallel device stream enqueue trait specialization.
+            //#############################################################################
+            template<>
+            struct Enqueue<
+                std::shared_ptr<stream::cpu::detail::StreamCpuParallelImpl>,
+                event::EventCpu>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueue(
+                    std::shared_ptr<stream::cpu::detail::StreamCpuParallelImpl> & spStreamImpl,
+                    event::EventCpu & event)
+                -> void
+                {
+                    // Copy the shared pointer of the event implementation.
+                    // This is forwarded to the lambda that is enqueued into the stream to ensure that the event implementation is alive as long as it is enqueued.
+                    auto spEventCpuImpl(event.m_spEventCpuImpl);
+
+                    // Setting the event state and enqueuing it has to be atomic.
+                    std::lock_guard<std::mutex> lk(spEventCpuImpl->m_Mutex);
+
+                    // This is a invariant: If the event is ready (not enqueued) there can not be anybody waiting for it.
+                    assert(!(spEventCpuImpl->m_bIsReady && spEventCpuImpl->m_bIsWaitedFor));
+
+                    // If it is enqueued and somebody is waiting for it, it can NOT be re-enqueued.
+                    if((!spEventCpuImpl->m_bIsReady) && spEventCpuImpl->m_bIsWaitedFor)
+                    {
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+                        std::cout << BOOST_CURRENT_FUNCTION << "WARNING: The event to enqueue is already enqueued AND waited on. It can NOT be re-enqueued!" << std::endl;
+#endif
+                        return;
+                    }
+
+                    // The event is completed after all earlier tasks of the stream but later tasks do not have to wait for it.
+                    // It can not run before the state is updated below because it locks the same mutex.
+                    spStreamImpl->enqueueTaskAfterAll(
+                        [spEventCpuImpl]()
+                        {
+                            std::unique_lock<std::mutex> lk(spEventCpuImpl->m_Mutex);
+                            // Nothing to do if it has been re-enqueued to a later position in the queue.
+                            if(spEventCpuImpl->m_canceledEnqueueCount > 0)
+                            {
+                                --spEventCpuImpl->m_canceledEnqueueCount;
+                                return;
+                            }
+                            else
+                            {
+                                event::cpu::detail::completeEvent(*spEventCpuImpl, lk);
+                            }
+                        });
+
+                    // If it is enqueued and nobody is waiting for it, increment the cancel counter.
+                    if(!spEventCpuImpl->m_bIsReady)
+                    {
+                        ++spEventCpuImpl->m_canceledEnqueueCount;
+                    }
+                    // If it is not enqueued, set its state to enqueued.
+                    else
+                    {
+                        spEventCpuImpl->m_bIsReady = false;
+                    }
+                }
+            };
+            //#############################################################################
+            //! The CPU parallel device stream enqueue trait specialization.
+            //#############################################################################
+            template<>
+            struct Enqueue<
+                stream::StreamCpuParallel,
+                event::EventCpu>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueue(
+                    stream::StreamCpuParallel & stream,
+                    event::EventCpu & event)
+                -> void
+                {
+                    stream::enqueue(stream.m_spParallelStreamCpu, event);
+                }
+            };
+            //#############################################################################
             //! The CPU sync device stream enqueue trait specialization.
             //#############################################################################
             template<>
@@ -333,7 +521,10 @@ namespace alpaka
                     event::EventCpu & event)
                 -> void
                 {
-                    boost::ignore_unused(spStreamImpl);
+                    if(spStreamImpl->m_upCaptureGraph)
+                    {
+                        throw std::runtime_error("Events can not be captured into a graph!");
+                    }
 
                     {
                         // Copy the shared pointer of the event implementation.
@@ -341,7 +532,7 @@ namespace alpaka
                         auto spEventCpuImpl(event.m_spEventCpuImpl);
 
                         // Setting the event state and enqueuing it has to be atomic.
-                        std::lock_guard<std::mutex> lk(spEventCpuImpl->m_Mutex);
+                        std::unique_lock<std::mutex> lk(spEventCpuImpl->m_Mutex);
 
                         // This is a invariant: If the event is ready (not enqueued) there can not be anybody waiting for it.
                         assert(!(spEventCpuImpl->m_bIsReady && spEventCpuImpl->m_bIsWaitedFor));
@@ -379,11 +570,9 @@ namespace alpaka
                         }
                         else
                         {
-                            spEventCpuImpl->m_bIsWaitedFor = false;
-                            spEventCpuImpl->m_bIsReady = true;
+                            event::cpu::detail::completeEvent(*spEventCpuImpl, lk);
                         }
                     }
-                    event.m_spEventCpuImpl->m_ConditionVariable.notify_all();
                 }
             };
             //#############################################################################
@@ -477,20 +666,48 @@ namespace alpaka
                     event::EventCpu const & event)
                 -> void
                 {
+                    if(spStreamImpl->m_upCaptureGraph)
+                    {
+                        throw std::runtime_error("Events can not be captured into a graph!");
+                    }
+
                     // Copy the shared pointer of the event implementation.
                     // This is forwarded to the lambda that is enqueued into the stream to ensure that the event implementation is alive as long as it is enqueued.
                     auto spEventCpuImpl(event.m_spEventCpuImpl);
 
+                    // The stream waits for the completion of the enqueue that is pending now.
+                    // A later re-enqueue after this completion must not be waited for.
+                    std::size_t completionCountRequired(0u);
                     {
                         std::lock_guard<std::mutex> lk(spEventCpuImpl->m_Mutex);
+                        // There is nothing to wait for if the event is ready.
+                        if(spEventCpuImpl->m_bIsReady)
+                        {
+                            return;
+                        }
                         spEventCpuImpl->m_bIsWaitedFor = true;
+                        completionCountRequired = spEventCpuImpl->m_completionCount + 1u;
                     }
 
                     // Enqueue a task that waits for the given event.
-                    spStreamImpl->m_workerThread.enqueueTask(
-                        [spEventCpuImpl]()
+                    // Instead of blocking the thread draining the stream it suspends the stream and the event resumes it on completion.
+                    // The raw pointer is valid because the task is run by a drain that keeps the stream alive.
+                    auto const pStreamImpl(spStreamImpl.get());
+                    spStreamImpl->enqueueTask(
+                        [spEventCpuImpl, pStreamImpl, completionCountRequired]()
                         {
-                            wait::wait(spEventCpuImpl);
+                            std::lock_guard<std::mutex> lk(spEventCpuImpl->m_Mutex);
+                            // The event can not be re-enqueued while it is waited for, so the next completion is the required one.
+                            if(spEventCpuImpl->m_completionCount < completionCountRequired)
+                            {
+                                pStreamImpl->suspend();
+                                auto spStreamImplWaiting(pStreamImpl->shared_from_this());
+                                spEventCpuImpl->m_vContinuations.emplace_back(
+                                    [spStreamImplWaiting]()
+                                    {
+                                        spStreamImplWaiting->resume();
+                                    });
+                            }
                         });
                 }
             };
@@ -514,6 +731,62 @@ namespace alpaka
                 }
             };
             //#############################################################################
+            //! The CPU parallel device stream event wait trait specialization.
+            //#############################################################################
+            template<>
+            struct WaiterWaitFor<
+                std::shared_ptr<stream::cpu::detail::StreamCpuParallelImpl>,
+                event::EventCpu>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto waiterWaitFor(
+                    std::shared_ptr<stream::cpu::detail::StreamCpuParallelImpl> & spStreamImpl,
+                    event::EventCpu const & event)
+                -> void
+                {
+                    auto spEventCpuImpl(event.m_spEventCpuImpl);
+
+                    // The gate has to be enqueued while the event is locked so that it can not complete before the continuation is registered.
+                    std::lock_guard<std::mutex> lk(spEventCpuImpl->m_Mutex);
+                    // There is nothing to wait for if the event is ready.
+                    if(spEventCpuImpl->m_bIsReady)
+                    {
+                        return;
+                    }
+                    spEventCpuImpl->m_bIsWaitedFor = true;
+
+                    // All later tasks of the stream wait for a gate that is opened by the event.
+                    auto spGate(spStreamImpl->enqueueGate());
+                    auto spStreamImplWaiting(spStreamImpl);
+                    spEventCpuImpl->m_vContinuations.emplace_back(
+                        [spStreamImplWaiting, spGate]()
+                        {
+                            spStreamImplWaiting->openGate(spGate);
+                        });
+                }
+            };
+            //#############################################################################
+            //! The CPU parallel device stream event wait trait specialization.
+            //#############################################################################
+            template<>
+            struct WaiterWaitFor<
+                stream::StreamCpuParallel,
+                event::EventCpu>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto waiterWaitFor(
+                    stream::StreamCpuParallel & stream,
+                    event::EventCpu const & event)
+                -> void
+                {
+                    wait::wait(stream.m_spParallelStreamCpu, event);
+                }
+            };
+            //#############################################################################
             //! The CPU sync device stream event wait trait specialization.
             //#############################################################################
             template<>
@@ -529,7 +802,10 @@ namespace alpaka
                     event::EventCpu const & event)
                 -> void
                 {
-                    boost::ignore_unused(spStreamImpl);
+                    if(spStreamImpl->m_upCaptureGraph)
+                    {
+                        throw std::runtime_error("Events can not be captured into a graph!");
+                    }
 
                     // Copy the shared pointer of the event implementation.
                     // This is forwarded to the lambda that is enqueued into the stream to ensure that the event implementation is alive as long as it is enqueued.
@@ -537,7 +813,11 @@ namespace alpaka
 
                     {
                         std::lock_guard<std::mutex> lk(spEventCpuImpl->m_Mutex);
-                        spEventCpuImpl->m_bIsWaitedFor = true;
+                        // A ready event is not waited for, otherwise the flag would never be reset by a completion.
+                        if(!spEventCpuImpl->m_bIsReady)
+                        {
+                            spEventCpuImpl->m_bIsWaitedFor = true;
+                        }
                     }
 
                     // NOTE: Difference to async version: directly wait for event.
@@ -593,6 +873,77 @@ namespace alpaka
                     {
                         wait::wait(spStream, event);
                     }
+                    for(auto && spStream : dev.m_spDevCpuImpl->GetAllParallelStreamImpls())
+                    {
+                        wait::wait(spStream, event);
+                    }
+                }
+            };
+            //#############################################################################
+            //! The CPU device thread wait specialization.
+            //!
+            //! Blocks until the device has completed all preceding requested tasks.
+            //! Tasks that are enqueued or streams that are created after this call is made are not waited for.
+            //! Synchronous streams execute their tasks on the calling threads and are not waited for.
+            //#############################################################################
+            template<>
+            struct CurrentThreadWaitFor<
+                dev::DevCpu>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto currentThreadWaitFor(
+                    dev::DevCpu const & dev)
+                -> void
+                {
+                    ALPAKA_DEBUG_FULL_LOG_SCOPE;
+
+                    // Every stream counts the periods in which it has pending tasks on the device, so an idle device is a single atomic load.
+                    if(!dev.m_spDevCpuImpl->hasBusyStreams())
+                    {
+                        return;
+                    }
+
+                    // Take a ticket of every stream at the time of invocation instead of enqueuing an event into each of them.
+                    // All streams added afterwards are ignored.
+                    auto const vspAsyncStreams(dev.m_spDevCpuImpl->GetAllAsyncStreamImpls());
+                    auto const vspParallelStreams(dev.m_spDevCpuImpl->GetAllParallelStreamImpls());
+                    std::vector<std::uint64_t> vAsyncTickets;
+                    vAsyncTickets.reserve(vspAsyncStreams.size());
+                    for(auto const & spStream : vspAsyncStreams)
+                    {
+                        vAsyncTickets.emplace_back(spStream->getTicket());
+                    }
+                    std::vector<std::uint64_t> vParallelTickets;
+                    vParallelTickets.reserve(vspParallelStreams.size());
+                    for(auto const & spStream : vspParallelStreams)
+                    {
+                        vParallelTickets.emplace_back(spStream->getTicket());
+                    }
+
+                    // The streams are checked in order and the ones that have completed their ticket are not checked again.
+                    std::size_t numAsyncStreamsCompleted(0u);
+                    std::size_t numParallelStreamsCompleted(0u);
+                    dev.m_spDevCpuImpl->waitForStreamProgress(
+                        [&vspAsyncStreams, &vAsyncTickets, &vspParallelStreams, &vParallelTickets, &numAsyncStreamsCompleted, &numParallelStreamsCompleted]()
+                        {
+                            for(; numAsyncStreamsCompleted < vspAsyncStreams.size(); ++numAsyncStreamsCompleted)
+                            {
+                                if(!vspAsyncStreams[numAsyncStreamsCompleted]->isTicketCompleted(vAsyncTickets[numAsyncStreamsCompleted]))
+                                {
+                                    return false;
+                                }
+                            }
+                            for(; numParallelStreamsCompleted < vspParallelStreams.size(); ++numParallelStreamsCompleted)
+                            {
+                                if(!vspParallelStreams[numParallelStreamsCompleted]->isTicketCompleted(vParallelTickets[numParallelStreamsCompleted]))
+                                {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        });
                 }
             };
 
@@ -621,6 +972,32 @@ namespace alpaka
                         event);
                 }
             };
+
+            //#############################################################################
+            //! The CPU parallel device stream thread wait trait specialization.
+            //!
+            //! Blocks execution of the calling thread until the stream has finished processing all previously requested tasks (kernels, data copies, ...)
+            //#############################################################################
+            template<>
+            struct CurrentThreadWaitFor<
+                stream::StreamCpuParallel>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto currentThreadWaitFor(
+                    stream::StreamCpuParallel const & stream)
+                -> void
+                {
+                    event::EventCpu event(
+                        dev::getDev(stream));
+                    stream::enqueue(
+                        const_cast<stream::StreamCpuParallel &>(stream),
+                        event);
+                    wait::wait(
+                        event);
+                }
+            };
         }
     }
-}
\ No newline at end of file
+}
@@ -23,6 +23,8 @@
 
 #include <alpaka/core/Common.hpp>   // ALPAKA_FN_HOST
 
+#include <chrono>                   // std::chrono::nanoseconds
+
 namespace alpaka
 {
     //-----------------------------------------------------------------------------
@@ -50,6 +52,14 @@ namespace alpaka
                 typename TEvent,
                 typename TSfinae = void>
             struct EventTest;
+
+            //#############################################################################
+            //! The elapsed time between two events trait.
+            //#############################################################################
+            template<
+                typename TEvent,
+                typename TSfinae = void>
+            struct EventElapsedTime;
         }
 
         //#############################################################################
@@ -86,5 +96,25 @@ namespace alpaka
                 ::eventTest(
                     event);
         }
+
+        //-----------------------------------------------------------------------------
+        //! \return The time between the completions of the given events.
+        //!
+        //! Both events have to be completed. The result is negative if stop has been completed before start.
+        //-----------------------------------------------------------------------------
+        template<
+            typename TEvent>
+        ALPAKA_FN_HOST auto elapsedTime(
+            TEvent const & start,
+            TEvent const & stop)
+        -> std::chrono::nanoseconds
+        {
+            return
+                traits::EventElapsedTime<
+                    TEvent>
+                ::eventElapsedTime(
+                    start,
+                    stop);
+        }
     }
 }
@@ -36,13 +36,16 @@
 
 #include <alpaka/core/Fibers.hpp>
 #include <alpaka/core/ConcurrentExecPool.hpp>   // core::ConcurrentExecPool
+#include <alpaka/exec/Schedule.hpp>             // exec::Schedule
 #include <alpaka/core/NdLoop.hpp>               // core::NdLoop
+#include <alpaka/core/MapIdx.hpp>               // core::mapIdx
 #include <alpaka/core/ApplyTuple.hpp>           // core::Apply
 
 #include <boost/predef.h>                       // workarounds
 #include <boost/align.hpp>                      // boost::aligned_alloc
 
-#include <algorithm>                            // std::for_each
+#include <algorithm>                            // std::for_each, std::min, std::max
+#include <memory>                               // std::unique_ptr
 #include <vector>                               // std::vector
 #include <tuple>                                // std::tuple
 #include <type_traits>                          // std::decay
@@ -105,7 +108,8 @@ namespace alpaka
                 TArgs const & ... args) :
                     workdiv::WorkDivMembers<TDim, TSize>(std::forward<TWorkDiv>(workDiv)),
                     m_kernelFnObj(kernelFnObj),
-                    m_args(args...)
+                    m_args(args...),
+                    m_schedule()
             {
                 static_assert(
                     dim::Dim<typename std::decay<TWorkDiv>::type>::value == TDim::value,
@@ -132,6 +136,24 @@ namespace alpaka
             //-----------------------------------------------------------------------------
             ALPAKA_FN_HOST ~ExecCpuFibers() = default;
 
+            //-----------------------------------------------------------------------------
+            //! Sets the schedule used to distribute the blocks onto the block lanes for the launches of this executor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto setSchedule(
+                Schedule const & schedule)
+            -> void
+            {
+                m_schedule = schedule;
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The schedule used to distribute the blocks onto the block lanes.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto getSchedule() const
+            -> Schedule const &
+            {
+                return m_schedule;
+            }
+
             //-----------------------------------------------------------------------------
             //! Executes the kernel function object.
             //-----------------------------------------------------------------------------
@@ -163,45 +185,130 @@ namespace alpaka
                 std::cout << BOOST_CURRENT_FUNCTION
                     << " BlockSharedExternMemSizeBytes: " << blockSharedExternMemSizeBytes << " B" << std::endl;
 #endif
-                acc::AccCpuFibers<TDim, TSize> acc(*static_cast<workdiv::WorkDivMembers<TDim, TSize> const *>(this));
+                TSize const numBlocksInGrid(gridBlockExtents.prod());
 
-                if(blockSharedExternMemSizeBytes > 0u)
+                // All fibers of a block run cooperatively on a single core. Therefore multiple blocks are executed concurrently on different threads.
+                // Each of these block lanes has its own accelerator and therefore its own block index, shared memory and barriers.
+                auto const dev(dev::cpu::getDev());
+                auto const devProps(acc::getAccDevProps<acc::AccCpuFibers<TDim, TSize>>(dev));
+                TSize const numBlockLanes(
+                    std::max(
+                        static_cast<TSize>(1u),
+                        std::min(
+                            numBlocksInGrid,
+                            static_cast<TSize>(devProps.m_multiProcessorCount))));
+
+                std::vector<std::unique_ptr<acc::AccCpuFibers<TDim, TSize>>> accs;
+                accs.reserve(static_cast<std::size_t>(numBlockLanes));
+                for(TSize blockLane(0u); blockLane < numBlockLanes; ++blockLane)
                 {
-                    acc.m_externalSharedMem.reset(
-                        reinterpret_cast<uint8_t *>(
-                            boost::alignment::aligned_alloc(16u, blockSharedExternMemSizeBytes)));
+                    accs.emplace_back(
+                        new acc::AccCpuFibers<TDim, TSize>(*static_cast<workdiv::WorkDivMembers<TDim, TSize> const *>(this)));
+
+                    if(blockSharedExternMemSizeBytes > 0u)
+                    {
+                        accs.back()->m_externalSharedMem.reset(
+                            reinterpret_cast<uint8_t *>(
+                                boost::alignment::aligned_alloc(16u, blockSharedExternMemSizeBytes)));
+                    }
                 }
 
-                auto const numThreadsInBlock(blockThreadExtents.prod());
-                FiberPool fiberPool(numThreadsInBlock, numThreadsInBlock);
+                // The first block lane is driven by the calling thread, all others by a worker thread of the device.
+                auto const numWorkers(static_cast<std::size_t>(numBlockLanes - 1u));
+                dev::cpu::detail::ThreadPoolAcquisition const threadPoolAcquisition(*dev.m_spDevCpuImpl, numWorkers);
+                auto & threadPool(threadPoolAcquisition.getThreadPool());
 
-                auto const boundGridBlockExecHost(
+                // The blocks are shared between the block lanes according to the schedule.
+                // By default every lane starts with a contiguous range of blocks and idle lanes steal from the others.
+                detail::BlockScheduler<TSize> scheduler(
+                    m_schedule,
+                    numBlocksInGrid,
+                    numBlockLanes);
+
+                // Bind the kernel and its arguments to the block lane function.
+                auto const boundBlockLaneExecHost(
                     core::apply(
-                        [this, &acc, &blockThreadExtents, &fiberPool](TArgs const & ... args)
+                        [this, &gridBlockExtents, &scheduler, &blockThreadExtents](TArgs const & ... args)
                         {
-                            // Bind the kernel and its arguments to the grid block function.
                             return
                                 std::bind(
-                                    &ExecCpuFibers<TDim, TSize, TKernelFnObj, TArgs...>::gridBlockExecHost,
-                                    std::ref(acc),
+                                    &ExecCpuFibers<TDim, TSize, TKernelFnObj, TArgs...>::blockLaneExecHost,
                                     std::placeholders::_1,
+                                    std::placeholders::_2,
+                                    std::ref(gridBlockExtents),
+                                    std::ref(scheduler),
                                     std::ref(blockThreadExtents),
-                                    std::ref(fiberPool),
                                     std::ref(m_kernelFnObj),
                                     std::ref(args)...);
                         },
                         m_args));
 
-                // Execute the blocks serially.
-                core::ndLoopIncIdx(
-                    gridBlockExtents,
-                    boundGridBlockExecHost);
+                dev::cpu::detail::DevCpuImpl::ThreadPool::TaskGroup blockLanes;
+                try
+                {
+                    for(TSize blockLane(1u); blockLane < numBlockLanes; ++blockLane)
+                    {
+                        auto & acc(*accs[static_cast<std::size_t>(blockLane)]);
+                        threadPool.enqueueTaskNoFuture(
+                            [&boundBlockLaneExecHost, &acc, blockLane]()
+                            {
+                                boundBlockLaneExecHost(acc, blockLane);
+                            },
+                            &blockLanes);
+                    }
+                    boundBlockLaneExecHost(*accs.front(), static_cast<TSize>(0u));
+                }
+                catch(...)
+                {
+                    // The other block lanes reference the scheduler, the accelerators and the bound lane function on this stack.
+                    blockLanes.wait();
+                    throw;
+                }
+
+                // Wait for the completion of the other block lanes.
+                blockLanes.wait();
 
-                // After all blocks have been processed, the external shared memory has to be deleted.
-                acc.m_externalSharedMem.reset();
+                // After all blocks have been processed, the accelerators and with them the external shared memory are deleted.
             }
 
         private:
+            //-----------------------------------------------------------------------------
+            //! The function executed for each block lane.
+            //! It executes blocks one after another on the calling thread until the scheduler has no blocks left for it.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto blockLaneExecHost(
+                acc::AccCpuFibers<TDim, TSize> & acc,
+                TSize const & blockLane,
+                Vec<TDim, TSize> const & gridBlockExtents,
+                detail::BlockScheduler<TSize> & scheduler,
+                Vec<TDim, TSize> const & blockThreadExtents,
+                TKernelFnObj const & kernelFnObj,
+                TArgs const & ... args)
+            -> void
+            {
+                // The fibers belong to the scheduler of the thread creating them so every block lane needs its own pool.
+                // All fibers of a block therefore stay on the same core and the fiber barriers never have to wake up another thread.
+                auto const numThreadsInBlock(blockThreadExtents.prod());
+                FiberPool fiberPool(numThreadsInBlock, numThreadsInBlock);
+
+                TSize begin;
+                TSize end;
+                while(scheduler.getNextRange(blockLane, begin, end))
+                {
+                    for(TSize i(begin); i < end; ++i)
+                    {
+                        gridBlockExecHost(
+                            acc,
+                            core::mapIdx<TDim::value>(
+                                Vec<dim::DimInt<1u>, TSize>(i),
+                                gridBlockExtents),
+                            blockThreadExtents,
+                            fiberPool,
+                            kernelFnObj,
+                            args...);
+                    }
+                }
+            }
             //-----------------------------------------------------------------------------
             //! The function executed for each grid block.
             //-----------------------------------------------------------------------------
@@ -246,9 +353,6 @@ namespace alpaka
                 // Clean up.
                 futuresInBlock.clear();
 
-                acc.m_fibersToIndices.clear();
-                acc.m_fibersToBarrier.clear();
-
                 // After a block has been processed, the shared memory has to be deleted.
                 block::shared::freeMem(acc);
             }
@@ -290,37 +394,26 @@ namespace alpaka
                 TArgs const & ... args)
             -> void
             {
-                // We have to store the fiber data before the kernel is calling any of the methods of this class depending on them.
-                auto const fiberId(boost::this_fiber::get_id());
+                // The pooled fibers run one block thread after another, so the fiber local slots are set before every block thread.
+                idx::bt::IdxBtFiberLocal<TDim, TSize>::fiberLocalBlockThreadIdx() = blockThreadIdx;
+                block::sync::BlockSyncBarrierFiber<TSize>::fiberLocalBarrierIdx() = static_cast<TSize>(0u);
 
                 // Set the master thread id.
+                // A fiber checking it in a shared memory allocation first syncs with all others, so it is always up to date.
                 if(blockThreadIdx.sum() == 0)
                 {
-                    acc.m_masterFiberId = fiberId;
+                    acc.m_masterFiberId = boost::this_fiber::get_id();
                 }
 
-                // We can not use the default syncBlockThreads here because it searches inside m_fibersToBarrier for the thread id.
-                // Concurrently searching while others use emplace is unsafe!
-                typename std::map<boost::fibers::fiber::id, TSize>::iterator itFiberToBarrier;
-
-                // Save the fiber id, and index.
-                acc.m_fibersToIndices.emplace(fiberId, blockThreadIdx);
-                itFiberToBarrier = acc.m_fibersToBarrier.emplace(fiberId, 0).first;
-
-                // Sync all threads so that the maps with thread id's are complete and not changed after here.
-                acc.syncBlockThreads(itFiberToBarrier);
-
                 // Execute the kernel itself.
                 kernelFnObj(
                     const_cast<acc::AccCpuFibers<TDim, TSize> const &>(acc),
                     args...);
-
-                // We have to sync all fibers here because if a fiber would finish before all fibers have been started, the new fiber could get a recycled (then duplicate) fiber id!
-                acc.syncBlockThreads(itFiberToBarrier);
             }
 
             TKernelFnObj m_kernelFnObj;
             std::tuple<TArgs...> m_args;
+            Schedule m_schedule;
         };
     }
 
@@ -35,7 +35,7 @@
 #include <alpaka/workdiv/WorkDivMembers.hpp>    // workdiv::WorkDivMembers
 
 #include <alpaka/core/OpenMp.hpp>
-#include <alpaka/core/NdLoop.hpp>               // core::NdLoop
+#include <alpaka/core/MapIdx.hpp>               // core::mapIdx
 #include <alpaka/core/ApplyTuple.hpp>           // core::Apply
 
 #include <boost/align.hpp>                      // boost::aligned_alloc
@@ -160,63 +160,83 @@ namespace alpaka
                 TSize const numThreadsInBlock(blockThreadExtents.prod());
                 int const iNumThreadsInBlock(static_cast<int>(numThreadsInBlock));
 
-                // Force the environment to use the given number of threads.
-                int const ompIsDynamic(::omp_get_dynamic());
-                ::omp_set_dynamic(0);
+                // The number of blocks in the grid.
+                TSize const numBlocksInGrid(gridBlockExtents.prod());
 
-                // Execute the blocks serially.
-                core::ndLoopIncIdx(
-                    gridBlockExtents,
-                    [&](Vec<TDim, TSize> const & gridBlockIdx)
-                    {
-                        acc.m_gridBlockIdx = gridBlockIdx;
+                // Force the environment to use the given number of threads.
+                // Dynamic adjustment of the number of threads is disabled by default in the common OpenMP runtimes so it only has to be changed (and restored) if it has been enabled.
+                bool const ompIsDynamic(::omp_get_dynamic() != 0);
+                if(ompIsDynamic)
+                {
+                    ::omp_set_dynamic(0);
+                }
 
-                        // Execute the threads in parallel.
+                // Execute the threads in parallel.
 
-                        // Parallel execution of the threads in a block is required because when syncBlockThreads is called all of them have to be done with their work up to this line.
-                        // So we have to spawn one OS thread per thread in a block.
-                        // 'omp for' is not useful because it is meant for cases where multiple iterations are executed by one thread but in our case a 1:1 mapping is required.
-                        // Therefore we use 'omp parallel' with the specified number of threads in a block.
-                        #pragma omp parallel num_threads(iNumThreadsInBlock)
-                        {
+                // Parallel execution of the threads in a block is required because when syncBlockThreads is called all of them have to be done with their work up to this line.
+                // So we have to spawn one OS thread per thread in a block.
+                // 'omp for' is not useful because it is meant for cases where multiple iterations are executed by one thread but in our case a 1:1 mapping is required.
+                // Therefore we use 'omp parallel' with the specified number of threads in a block.
+                // The team is forked only once per launch and executes all blocks of the grid one after another.
+                #pragma omp parallel num_threads(iNumThreadsInBlock)
+                {
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
-                            // GCC 5.1 fails with:
-                            // error: redeclaration of const int& iNumThreadsInBlock
-                            // if(numThreads != iNumThreadsInBloc
-                            //                ^
-                            // note: const int& iNumThreadsInBlock previously declared here
-                            // #pragma omp parallel num_threads(iNumThread
-                            //         ^
+                    // GCC 5.1 fails with:
+                    // error: redeclaration of const int& iNumThreadsInBlock
+                    // if(numThreads != iNumThreadsInBloc
+                    //                ^
+                    // note: const int& iNumThreadsInBlock previously declared here
+                    // #pragma omp parallel num_threads(iNumThread
+                    //         ^
 #if (!BOOST_COMP_GNUC) || (BOOST_COMP_GNUC < BOOST_VERSION_NUMBER(5, 0, 0))
-                            // The first thread does some checks in the first block executed.
-                            if((::omp_get_thread_num() == 0) && (acc.m_gridBlockIdx.sum() == 0u))
-                            {
-                                int const numThreads(::omp_get_num_threads());
-                                std::cout << BOOST_CURRENT_FUNCTION << " omp_get_num_threads: " << numThreads << std::endl;
-                                if(numThreads != iNumThreadsInBlock)
-                                {
-                                    throw std::runtime_error("The OpenMP 2.0 runtime did not use the number of threads that had been required!");
-                                }
-                            }
+                    // The first thread does some checks.
+                    if(::omp_get_thread_num() == 0)
+                    {
+                        int const numThreads(::omp_get_num_threads());
+                        std::cout << BOOST_CURRENT_FUNCTION << " omp_get_num_threads: " << numThreads << std::endl;
+                        if(numThreads != iNumThreadsInBlock)
+                        {
+                            throw std::runtime_error("The OpenMP 2.0 runtime did not use the number of threads that had been required!");
+                        }
+                    }
 #endif
 #endif
-                            boundKernelFnObj(
-                                acc);
-
-                            // Wait for all threads to finish before deleting the shared memory.
-                            // This is done by default if the omp 'nowait' clause is missing
-                            //block::sync::syncBlockThreads(acc);
+                    // All threads of the team iterate over all blocks.
+                    for(TSize i(0u); i < numBlocksInGrid; ++i)
+                    {
+                        // The master thread sets the index of the block for the whole team.
+                        if(::omp_get_thread_num() == 0)
+                        {
+                            acc.m_gridBlockIdx =
+                                core::mapIdx<TDim::value>(
+                                    Vec<dim::DimInt<1u>, TSize>(i),
+                                    gridBlockExtents);
                         }
+                        // Wait until the block index is visible to all threads.
+                        #pragma omp barrier
+
+                        boundKernelFnObj(
+                            acc);
+
+                        // Wait for all threads to finish the block before deleting the shared memory and changing the block index.
+                        #pragma omp barrier
 
                         // After a block has been processed, the shared memory has to be deleted.
-                        block::shared::freeMem(acc);
-                    });
+                        if(::omp_get_thread_num() == 0)
+                        {
+                            block::shared::freeMem(acc);
+                        }
+                    }
+                }
 
                 // After all blocks have been processed, the external shared memory has to be deleted.
                 acc.m_externalSharedMem.reset();
 
                 // Reset the dynamic thread number setting.
-                ::omp_set_dynamic(ompIsDynamic);
+                if(ompIsDynamic)
+                {
+                    ::omp_set_dynamic(1);
+                }
             }
 
             TKernelFnObj m_kernelFnObj;
@@ -40,7 +40,7 @@
 
 #include <boost/align.hpp>                      // boost::aligned_alloc
 
-#include <cassert>                              // assert
+#include <algorithm>                            // std::min, std::max
 #include <stdexcept>                            // std::runtime_error
 #include <tuple>                                // std::tuple
 #include <type_traits>                          // std::decay
@@ -151,25 +151,33 @@ namespace alpaka
                 TSize const numBlocksInGrid(gridBlockExtents.prod());
                 // The number of threads in a block.
                 TSize const numThreadsInBlock(blockThreadExtents.prod());
+                int const iNumThreadsInBlock(static_cast<int>(numThreadsInBlock));
 
-                // `When an if(scalar-expression) evaluates to false, the structured block is executed on the host.`
-                #pragma omp target if(0)
+                // Each team executes the blocks of a contiguous part of the grid.
+                // There are as many teams as there are cores for all of their threads.
+                auto const dev(dev::cpu::getDev());
+                auto const devProps(acc::getAccDevProps<acc::AccCpuOmp4<TDim, TSize>>(dev));
+                TSize const numTeams(
+                    std::max(
+                        static_cast<TSize>(1u),
+                        std::min(
+                            numBlocksInGrid,
+                            static_cast<TSize>(devProps.m_multiProcessorCount / numThreadsInBlock))));
+                int const iNumTeams(static_cast<int>(numTeams));
+
+                // Force the environment to use the given number of threads.
+                // Dynamic adjustment of the number of threads is disabled by default in the common OpenMP runtimes so it only has to be changed (and restored) if it has been enabled.
+                bool const ompIsDynamic(::omp_get_dynamic() != 0);
+                if(ompIsDynamic)
                 {
-                    #pragma omp teams/* num_teams(numBlocksInGrid) thread_limit(numThreadsInBlock)*/
+                    ::omp_set_dynamic(0);
+                }
+
+                // The function executed by each team.
+                auto const teamExecHost(
+                    [this, &gridBlockExtents, &boundKernelFnObj, blockSharedExternMemSizeBytes, numBlocksInGrid, numTeams, iNumThreadsInBlock](
+                        TSize const & team)
                     {
-#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
-                        // The first team does some checks ...
-                        if((::omp_get_team_num() == 0))
-                        {
-                            int const iNumTeams(::omp_get_num_teams());
-                            // NOTE: No std::cout in omp target!
-                            printf("%s omp_get_num_teams: %d\n", BOOST_CURRENT_FUNCTION, iNumTeams);
-                            if(iNumTeams <= 0)    // NOTE: No throw inside target region
-                            {
-                                throw std::runtime_error("The CPU OpenMP4 runtime did not use a valid number of teams!");
-                            }
-                        }
-#endif
                         acc::AccCpuOmp4<TDim, TSize> acc(*static_cast<workdiv::WorkDivMembers<TDim, TSize> const *>(this));
 
                         if(blockSharedExternMemSizeBytes > 0u)
@@ -179,59 +187,91 @@ namespace alpaka
                                     boost::alignment::aligned_alloc(16u, blockSharedExternMemSizeBytes)));
                         }
 
-                        #pragma omp distribute
-                        for(TSize b = 0u; b<numBlocksInGrid; ++b)
-                        {
-                            Vec<dim::DimInt<1u>, TSize> const gridBlockIdx(b);
-                            // When this is not repeated here:
-                            // error: gridBlockExtents referenced in target region does not have a mappable type
-                            auto const gridBlockExtents2(
-                                workdiv::getWorkDiv<Grid, Blocks>(*static_cast<workdiv::WorkDivMembers<TDim, TSize> const *>(this)));
-                            acc.m_gridBlockIdx = core::mapIdx<TDim::value>(
-                                gridBlockIdx,
-                                gridBlockExtents2);
-
-                            // Execute the threads in parallel.
-
-                            // Force the environment to use the given number of threads.
-                            int const ompIsDynamic(::omp_get_dynamic());
-                            ::omp_set_dynamic(0);
+                        // The same static distribution as 'omp distribute' without a chunk size.
+                        TSize const blocksBegin((numBlocksInGrid * team) / numTeams);
+                        TSize const blocksEnd((numBlocksInGrid * (team + 1u)) / numTeams);
 
-                            // Parallel execution of the threads in a block is required because when syncBlockThreads is called all of them have to be done with their work up to this line.
-                            // So we have to spawn one OS thread per thread in a block.
-                            // 'omp for' is not useful because it is meant for cases where multiple iterations are executed by one thread but in our case a 1:1 mapping is required.
-                            // Therefore we use 'omp parallel' with the specified number of threads in a block.
-                            #pragma omp parallel num_threads(numThreadsInBlock)
-                            {
+                        // Parallel execution of the threads in a block is required because when syncBlockThreads is called all of them have to be done with their work up to this line.
+                        // So we have to spawn one OS thread per thread in a block.
+                        // 'omp for' is not useful because it is meant for cases where multiple iterations are executed by one thread but in our case a 1:1 mapping is required.
+                        // Therefore we use 'omp parallel' with the specified number of threads in a block.
+                        // The threads of a team are forked only once per launch and execute all blocks of the team one after another.
+                        #pragma omp parallel num_threads(iNumThreadsInBlock)
+                        {
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
-                                // The first thread does some checks in the first block executed.
-                                if((::omp_get_thread_num() == 0) && (b == 0))
+                            // The first thread of the first team does some checks.
+                            if((team == 0u) && (::omp_get_thread_num() == 0))
+                            {
+                                int const numThreads(::omp_get_num_threads());
+                                std::cout << BOOST_CURRENT_FUNCTION << " omp_get_num_threads: " << numThreads << std::endl;
+                                if(numThreads != iNumThreadsInBlock)
                                 {
-                                    int const numThreads(::omp_get_num_threads());
-                                    // NOTE: No std::cout in omp target!
-                                    printf("%s omp_get_num_threads: %d\n", BOOST_CURRENT_FUNCTION, numThreads);
-                                    if(numThreads != static_cast<int>(numThreadsInBlock))
-                                    {
-                                        throw std::runtime_error("The CPU OpenMP4 runtime did not use the number of threads that had been required!");
-                                    }
+                                    throw std::runtime_error("The CPU OpenMP4 runtime did not use the number of threads that had been required!");
                                 }
+                            }
 #endif
+                            for(TSize b(blocksBegin); b < blocksEnd; ++b)
+                            {
+                                // The master thread sets the index of the block for the whole team.
+                                if(::omp_get_thread_num() == 0)
+                                {
+                                    acc.m_gridBlockIdx =
+                                        core::mapIdx<TDim::value>(
+                                            Vec<dim::DimInt<1u>, TSize>(b),
+                                            gridBlockExtents);
+                                }
+                                // Wait until the block index is visible to all threads.
+                                #pragma omp barrier
+
                                 boundKernelFnObj(
                                     acc);
 
-                                // Wait for all threads to finish before deleting the shared memory.
-                                block::sync::syncBlockThreads(acc);
-                            }
-
-                            // Reset the dynamic thread number setting.
-                            ::omp_set_dynamic(ompIsDynamic);
+                                // Wait for all threads to finish the block before deleting the shared memory and changing the block index.
+                                #pragma omp barrier
 
-                            // After a block has been processed, the shared memory has to be deleted.
-                            block::shared::freeMem(acc);
+                                // After a block has been processed, the shared memory has to be deleted.
+                                if(::omp_get_thread_num() == 0)
+                                {
+                                    block::shared::freeMem(acc);
+                                }
+                            }
                         }
+
                         // After all blocks have been processed, the external shared memory has to be deleted.
                         acc.m_externalSharedMem.reset();
-                    }
+                    });
+
+#if _OPENMP >= 201811
+                // OpenMP 5.0 allows teams on the host.
+                // The team count and the thread limit are taken from the work division.
+                #pragma omp teams num_teams(iNumTeams) thread_limit(iNumThreadsInBlock)
+                {
+                    teamExecHost(static_cast<TSize>(::omp_get_team_num()));
+                }
+#else
+                // Before OpenMP 5.0 teams are only allowed within a target region and the host fallback of the common runtimes executes them one after another.
+                // The teams are therefore emulated by an outer parallel region with one thread per team, each forking its own nested team of block threads.
+                int const ompMaxActiveLevels(::omp_get_max_active_levels());
+                if(ompMaxActiveLevels < 2)
+                {
+                    ::omp_set_max_active_levels(2);
+                }
+
+                #pragma omp parallel num_threads(iNumTeams)
+                {
+                    teamExecHost(static_cast<TSize>(::omp_get_thread_num()));
+                }
+
+                if(ompMaxActiveLevels < 2)
+                {
+                    ::omp_set_max_active_levels(ompMaxActiveLevels);
+                }
+#endif
+
+                // Reset the dynamic thread number setting.
+                if(ompIsDynamic)
+                {
+                    ::omp_set_dynamic(1);
                 }
             }
 
@@ -0,0 +1,309 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Specialized traits.
+#include <alpaka/acc/Traits.hpp>                // acc::traits::AccType
+#include <alpaka/dev/Traits.hpp>                // dev::traits::DevType
+#include <alpaka/dim/Traits.hpp>                // dim::traits::DimType
+#include <alpaka/exec/Traits.hpp>               // exec::traits::ExecType
+#include <alpaka/size/Traits.hpp>               // size::traits::SizeType
+
+// Implementation details.
+#include <alpaka/acc/AccCpuSimd.hpp>            // acc:AccCpuSimd
+#include <alpaka/dev/DevCpu.hpp>                // dev::DevCpu
+#include <alpaka/kernel/Traits.hpp>             // kernel::getBlockSharedExternMemSizeBytes
+#include <alpaka/workdiv/WorkDivMembers.hpp>    // workdiv::WorkDivMembers
+
+#include <alpaka/core/NdLoop.hpp>               // core::NdLoop
+#include <alpaka/core/MapIdx.hpp>               // core::mapIdx
+#include <alpaka/core/Vectorize.hpp>            // core::vectorization::GetVectorizationSizeElems
+#include <alpaka/core/ApplyTuple.hpp>           // core::Apply
+
+#include <boost/core/ignore_unused.hpp>         // boost::ignore_unused
+#include <boost/align.hpp>                      // boost::aligned_alloc
+
+#include <cassert>                              // assert
+#include <tuple>                                // std::tuple
+#include <type_traits>                          // std::decay
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+    #include <iostream>                         // std::cout
+#endif
+
+namespace alpaka
+{
+    namespace exec
+    {
+        //#############################################################################
+        //! The CPU SIMD lane executor implementation.
+        //#############################################################################
+        template<
+            typename TDim,
+            typename TSize,
+            typename TKernelFnObj,
+            typename... TArgs>
+        class ExecCpuSimd final :
+            public workdiv::WorkDivMembers<TDim, TSize>
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            //! Constructor.
+            //-----------------------------------------------------------------------------
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_HOST ExecCpuSimd(
+                TWorkDiv && workDiv,
+                TKernelFnObj const & kernelFnObj,
+                TArgs const & ... args) :
+                    workdiv::WorkDivMembers<TDim, TSize>(std::forward<TWorkDiv>(workDiv)),
+                    m_kernelFnObj(kernelFnObj),
+                    m_args(args...)
+            {
+                static_assert(
+                    dim::Dim<typename std::decay<TWorkDiv>::type>::value == TDim::value,
+                    "The work division and the executor have to be of the same dimensionality!");
+            }
+            //-----------------------------------------------------------------------------
+            //! Copy constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST ExecCpuSimd(ExecCpuSimd const &) = default;
+            //-----------------------------------------------------------------------------
+            //! Move constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST ExecCpuSimd(ExecCpuSimd &&) = default;
+            //-----------------------------------------------------------------------------
+            //! Copy assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(ExecCpuSimd const &) -> ExecCpuSimd & = default;
+            //-----------------------------------------------------------------------------
+            //! Move assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(ExecCpuSimd &&) -> ExecCpuSimd & = default;
+            //-----------------------------------------------------------------------------
+            //! Destructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST ~ExecCpuSimd() = default;
+
+            //-----------------------------------------------------------------------------
+            //! Executes the kernel function object.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator()() const
+            -> void
+            {
+                ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                auto const gridBlockExtents(
+                    workdiv::getWorkDiv<Grid, Blocks>(*this));
+                auto const blockThreadExtents(
+                    workdiv::getWorkDiv<Block, Threads>(*this));
+
+                // Get the size of the block shared extern memory.
+                auto const blockSharedExternMemSizeBytes(
+                    core::apply(
+                        [&](TArgs const & ... args)
+                        {
+                            return
+                                kernel::getBlockSharedExternMemSizeBytes<
+                                    TKernelFnObj,
+                                    acc::AccCpuSimd<TDim, TSize>>(
+                                        blockThreadExtents,
+                                        args...);
+                        },
+                        m_args));
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+                std::cout << BOOST_CURRENT_FUNCTION
+                    << " BlockSharedExternMemSizeBytes: " << blockSharedExternMemSizeBytes << " B" << std::endl;
+#endif
+                // Bind all arguments except the accelerator.
+                // TODO: With C++14 we could create a perfectly argument forwarding function object within the constructor.
+                auto const boundKernelFnObj(
+                    core::apply(
+                        [this](TArgs const & ... args)
+                        {
+                            return
+                                std::bind(
+                                    std::ref(m_kernelFnObj),
+                                    std::placeholders::_1,
+                                    std::ref(args)...);
+                        },
+                        m_args));
+
+                acc::AccCpuSimd<TDim, TSize> acc(*static_cast<workdiv::WorkDivMembers<TDim, TSize> const *>(this));
+
+                if(blockSharedExternMemSizeBytes > 0u)
+                {
+                    acc.m_externalSharedMem.reset(
+                        reinterpret_cast<uint8_t *>(
+                            boost::alignment::aligned_alloc(16u, blockSharedExternMemSizeBytes)));
+                }
+
+                // The threads of a block are the lanes of the inner loop.
+                TSize const numThreadsInBlock(blockThreadExtents.prod());
+                assert(numThreadsInBlock <= static_cast<TSize>(core::vectorization::GetVectorizationSizeElems<float>::value));
+
+                // Execute the blocks serially.
+                core::ndLoopIncIdx(
+                    gridBlockExtents,
+                    [&](Vec<TDim, TSize> const & gridBlockIdx)
+                    {
+                        acc.m_gridBlockIdx = gridBlockIdx;
+
+                        // Execute the threads of the block as lanes.
+                        // After inlining of the kernel the compiler is able to vectorize this loop.
+                        for(TSize lane(0u); lane < numThreadsInBlock; ++lane)
+                        {
+                            acc.m_blockThreadIdx =
+                                core::mapIdx<TDim::value>(
+                                    Vec<dim::DimInt<1u>, TSize>(lane),
+                                    blockThreadExtents);
+                            // The first lane allocates the block shared memory, the following lanes get the same memory.
+                            acc.beginLane();
+
+                            boundKernelFnObj(
+                                acc);
+                        }
+
+                        // After a block has been processed, the shared memory has to be deleted.
+                        block::shared::freeMem(acc);
+                    });
+
+                // After all blocks have been processed, the external shared memory has to be deleted.
+                acc.m_externalSharedMem.reset();
+            }
+
+            TKernelFnObj m_kernelFnObj;
+            std::tuple<TArgs...> m_args;
+        };
+    }
+
+    namespace acc
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU SIMD lane executor accelerator type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct AccType<
+                exec::ExecCpuSimd<TDim, TSize, TKernelFnObj, TArgs...>>
+            {
+                using type = acc::AccCpuSimd<TDim, TSize>;
+            };
+        }
+    }
+    namespace dev
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU SIMD lane executor device type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct DevType<
+                exec::ExecCpuSimd<TDim, TSize, TKernelFnObj, TArgs...>>
+            {
+                using type = dev::DevCpu;
+            };
+            //#############################################################################
+            //! The CPU SIMD lane executor device manager type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct DevManType<
+                exec::ExecCpuSimd<TDim, TSize, TKernelFnObj, TArgs...>>
+            {
+                using type = dev::DevManCpu;
+            };
+        }
+    }
+    namespace dim
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU SIMD lane executor dimension getter trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct DimType<
+                exec::ExecCpuSimd<TDim, TSize, TKernelFnObj, TArgs...>>
+            {
+                using type = TDim;
+            };
+        }
+    }
+    namespace exec
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU SIMD lane executor executor type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct ExecType<
+                exec::ExecCpuSimd<TDim, TSize, TKernelFnObj, TArgs...>,
+                TKernelFnObj,
+                TArgs...>
+            {
+                using type = exec::ExecCpuSimd<TDim, TSize, TKernelFnObj, TArgs...>;
+            };
+        }
+    }
+    namespace size
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU SIMD lane executor size type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct SizeType<
+                exec::ExecCpuSimd<TDim, TSize, TKernelFnObj, TArgs...>>
+            {
+                using type = TSize;
+            };
+        }
+    }
+}
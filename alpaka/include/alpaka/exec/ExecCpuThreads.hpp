@@ -34,14 +34,16 @@
 #include <alpaka/kernel/Traits.hpp>             // kernel::getBlockSharedExternMemSizeBytes
 #include <alpaka/workdiv/WorkDivMembers.hpp>    // workdiv::WorkDivMembers
 
-#include <alpaka/core/ConcurrentExecPool.hpp>   // core::ConcurrentExecPool
 #include <alpaka/core/NdLoop.hpp>               // core::NdLoop
+#include <alpaka/core/MapIdx.hpp>               // core::mapIdx
 #include <alpaka/core/ApplyTuple.hpp>           // core::Apply
 
 #include <boost/predef.h>                       // workarounds
 #include <boost/align.hpp>                      // boost::aligned_alloc
 
-#include <algorithm>                            // std::for_each
+#include <algorithm>                            // std::min, std::max
+#include <atomic>                               // std::atomic
+#include <memory>                               // std::unique_ptr
 #include <thread>                               // std::thread
 #include <vector>                               // std::vector
 #include <tuple>                                // std::tuple
@@ -67,29 +69,10 @@ namespace alpaka
         {
         private:
             //#############################################################################
-            //! The type given to the ConcurrentExecPool for yielding the current thread.
+            //! The worker pool owned by the CPU device.
+            //! It is shared by all launches so the block threads do not have to be created and joined again for every kernel.
             //#############################################################################
-            struct ThreadPoolYield
-            {
-                //-----------------------------------------------------------------------------
-                //! Yields the current thread.
-                //-----------------------------------------------------------------------------
-                ALPAKA_FN_HOST static auto yield()
-                -> void
-                {
-                    std::this_thread::yield();
-                }
-            };
-            //#############################################################################
-            // When using the thread pool the threads are yielding because this is faster.
-            // Using condition variables and going to sleep is very costly for real threads.
-            // Especially when the time to wait is really short (syncBlockThreads) yielding is much faster.
-            //#############################################################################
-            using ThreadPool = alpaka::core::detail::ConcurrentExecPool<
-                TSize,
-                std::thread,        // The concurrent execution type.
-                std::promise,       // The promise type.
-                ThreadPoolYield>;   // The type yielding the current concurrent execution.
+            using ThreadPool = dev::cpu::detail::DevCpuImpl::ThreadPool;
 
         public:
             //-----------------------------------------------------------------------------
@@ -161,28 +144,55 @@ namespace alpaka
                 std::cout << BOOST_CURRENT_FUNCTION
                     << " BlockSharedExternMemSizeBytes: " << blockSharedExternMemSizeBytes << " B" << std::endl;
 #endif
-                acc::AccCpuThreads<TDim, TSize> acc(*static_cast<workdiv::WorkDivMembers<TDim, TSize> const *>(this));
-
-                if(blockSharedExternMemSizeBytes > 0u)
+                auto const numThreadsInBlock(blockThreadExtents.prod());
+                TSize const numBlocksInGrid(gridBlockExtents.prod());
+
+                // Small blocks can not occupy the whole device. Therefore multiple blocks are executed concurrently.
+                // Each of these block lanes has its own accelerator and therefore its own block index, shared memory and barriers.
+                auto const dev(dev::cpu::getDev());
+                auto const devProps(acc::getAccDevProps<acc::AccCpuThreads<TDim, TSize>>(dev));
+                TSize const numBlockLanes(
+                    std::max(
+                        static_cast<TSize>(1u),
+                        std::min(
+                            numBlocksInGrid,
+                            static_cast<TSize>(devProps.m_multiProcessorCount / numThreadsInBlock))));
+
+                std::vector<std::unique_ptr<acc::AccCpuThreads<TDim, TSize>>> accs;
+                accs.reserve(static_cast<std::size_t>(numBlockLanes));
+                for(TSize blockLane(0u); blockLane < numBlockLanes; ++blockLane)
                 {
-                    acc.m_externalSharedMem.reset(
-                        reinterpret_cast<uint8_t *>(
-                            boost::alignment::aligned_alloc(16u, blockSharedExternMemSizeBytes)));
+                    accs.emplace_back(
+                        new acc::AccCpuThreads<TDim, TSize>(*static_cast<workdiv::WorkDivMembers<TDim, TSize> const *>(this)));
+
+                    if(blockSharedExternMemSizeBytes > 0u)
+                    {
+                        accs.back()->m_externalSharedMem.reset(
+                            reinterpret_cast<uint8_t *>(
+                                boost::alignment::aligned_alloc(16u, blockSharedExternMemSizeBytes)));
+                    }
                 }
 
-                auto const numThreadsInBlock(blockThreadExtents.prod());
-                ThreadPool threadPool(numThreadsInBlock, numThreadsInBlock);
+                // All threads of all concurrently executed blocks have to run at the same time because they can wait for each other.
+                // The first block lane is driven by the calling thread, all others by a worker of their own.
+                auto const numWorkers(static_cast<std::size_t>(numBlockLanes * numThreadsInBlock + numBlockLanes - 1u));
+                dev::cpu::detail::ThreadPoolAcquisition const threadPoolAcquisition(*dev.m_spDevCpuImpl, numWorkers);
+                auto & threadPool(threadPoolAcquisition.getThreadPool());
+
+                // The blocks are distributed dynamically onto the block lanes.
+                std::atomic<TSize> nextGridBlockIdx(static_cast<TSize>(0u));
 
-                // Bind the kernel and its arguments to the grid block function.
-                auto const boundGridBlockExecHost(
+                // Bind the kernel and its arguments to the block lane function.
+                auto const boundBlockLaneExecHost(
                     core::apply(
-                        [this, &acc, &blockThreadExtents, &threadPool](TArgs const & ... args)
+                        [this, &gridBlockExtents, &nextGridBlockIdx, &blockThreadExtents, &threadPool](TArgs const & ... args)
                         {
                             return
                                 std::bind(
-                                    &ExecCpuThreads<TDim, TSize, TKernelFnObj, TArgs...>::gridBlockExecHost,
-                                    std::ref(acc),
+                                    &ExecCpuThreads<TDim, TSize, TKernelFnObj, TArgs...>::blockLaneExecHost,
                                     std::placeholders::_1,
+                                    std::ref(gridBlockExtents),
+                                    std::ref(nextGridBlockIdx),
                                     std::ref(blockThreadExtents),
                                     std::ref(threadPool),
                                     std::ref(m_kernelFnObj),
@@ -190,16 +200,69 @@ namespace alpaka
                         },
                         m_args));
 
-                // Execute the blocks serially.
-                core::ndLoopIncIdx(
-                    gridBlockExtents,
-                    boundGridBlockExecHost);
+                typename ThreadPool::TaskGroup blockLanes;
+                try
+                {
+                    for(TSize blockLane(1u); blockLane < numBlockLanes; ++blockLane)
+                    {
+                        auto & acc(*accs[static_cast<std::size_t>(blockLane)]);
+                        threadPool.enqueueTaskNoFuture(
+                            [&boundBlockLaneExecHost, &acc]()
+                            {
+                                boundBlockLaneExecHost(acc);
+                            },
+                            &blockLanes);
+                    }
+                    boundBlockLaneExecHost(*accs.front());
+                }
+                catch(...)
+                {
+                    // The other block lanes reference the local variables, so they have to be finished before unwinding.
+                    blockLanes.wait();
+                    throw;
+                }
+
+                // Wait for the completion of the other block lanes.
+                blockLanes.wait();
 
-                // After all blocks have been processed, the external shared memory has to be deleted.
-                acc.m_externalSharedMem.reset();
+                // After all blocks have been processed, the accelerators and with them the external shared memory are deleted.
             }
 
         private:
+            //-----------------------------------------------------------------------------
+            //! The function executed for each block lane.
+            //! It executes blocks one after another until all blocks of the grid have been taken.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto blockLaneExecHost(
+                acc::AccCpuThreads<TDim, TSize> & acc,
+                Vec<TDim, TSize> const & gridBlockExtents,
+                std::atomic<TSize> & nextGridBlockIdx,
+                Vec<TDim, TSize> const & blockThreadExtents,
+                ThreadPool & threadPool,
+                TKernelFnObj const & kernelFnObj,
+                TArgs const & ... args)
+            -> void
+            {
+                TSize const numBlocksInGrid(gridBlockExtents.prod());
+
+                // The threads of the current block.
+                // The group is reused for all blocks of this lane.
+                typename ThreadPool::TaskGroup threadsInBlock;
+
+                for(TSize i(nextGridBlockIdx++); i < numBlocksInGrid; i = nextGridBlockIdx++)
+                {
+                    gridBlockExecHost(
+                        acc,
+                        core::mapIdx<TDim::value>(
+                            Vec<dim::DimInt<1u>, TSize>(i),
+                            gridBlockExtents),
+                        blockThreadExtents,
+                        threadPool,
+                        threadsInBlock,
+                        kernelFnObj,
+                        args...);
+                }
+            }
             //-----------------------------------------------------------------------------
             //! The function executed for each grid block.
             //-----------------------------------------------------------------------------
@@ -208,13 +271,11 @@ namespace alpaka
                 Vec<TDim, TSize> const & gridBlockIdx,
                 Vec<TDim, TSize> const & blockThreadExtents,
                 ThreadPool & threadPool,
+                typename ThreadPool::TaskGroup & threadsInBlock,
                 TKernelFnObj const & kernelFnObj,
                 TArgs const & ... args)
             -> void
             {
-                    // The futures of the threads in the current block.
-                std::vector<std::future<void>> futuresInBlock;
-
                 // Set the index of the current block
                 acc.m_gridBlockIdx = gridBlockIdx;
 
@@ -222,7 +283,7 @@ namespace alpaka
                 auto boundBlockThreadExecHost(std::bind(
                     &ExecCpuThreads<TDim, TSize, TKernelFnObj, TArgs...>::blockThreadExecHost,
                     std::ref(acc),
-                    std::ref(futuresInBlock),
+                    std::ref(threadsInBlock),
                     std::placeholders::_1,
                     std::ref(threadPool),
                     std::ref(kernelFnObj),
@@ -233,19 +294,7 @@ namespace alpaka
                     boundBlockThreadExecHost);
 
                 // Wait for the completion of the block thread kernels.
-                std::for_each(
-                    futuresInBlock.begin(),
-                    futuresInBlock.end(),
-                    [](std::future<void> & t)
-                    {
-                        t.wait();
-                    }
-                );
-                // Clean up.
-                futuresInBlock.clear();
-
-                acc.m_threadsToIndices.clear();
-                acc.m_mThreadsToBarrier.clear();
+                threadsInBlock.wait();
 
                 // After a block has been processed, the shared memory has to be deleted.
                 block::shared::freeMem(acc);
@@ -255,7 +304,7 @@ namespace alpaka
             //-----------------------------------------------------------------------------
             ALPAKA_FN_HOST static auto blockThreadExecHost(
                 acc::AccCpuThreads<TDim, TSize> & acc,
-                std::vector<std::future<void>> & futuresInBlock,
+                typename ThreadPool::TaskGroup & threadsInBlock,
                 Vec<TDim, TSize> const & blockThreadIdx,
                 ThreadPool & threadPool,
                 TKernelFnObj const & kernelFnObj,
@@ -274,9 +323,9 @@ namespace alpaka
                             args...);
                     });
                 // Add the bound function to the block thread pool.
-                futuresInBlock.emplace_back(
-                    threadPool.enqueueTask(
-                        boundBlockThreadExecAcc));
+                threadPool.enqueueTaskNoFuture(
+                    boundBlockThreadExecAcc,
+                    &threadsInBlock);
             }
             //-----------------------------------------------------------------------------
             //! The thread entry point on the accelerator.
@@ -288,39 +337,13 @@ namespace alpaka
                 TArgs const & ... args)
             -> void
             {
-                // We have to store the thread data before the kernel is calling any of the methods of this class depending on them.
-                auto const threadId(std::this_thread::get_id());
-
-                // Set the master thread id.
-                if(blockThreadIdx.sum() == 0)
-                {
-                    acc.m_idMasterThread = threadId;
-                }
-
-                // We can not use the default syncBlockThreads here because it searches inside m_mThreadsToBarrier for the thread id.
-                // Concurrently searching while others use emplace is unsafe!
-                typename std::map<std::thread::id, TSize>::iterator itThreadToBarrier;
-
-                {
-                    // The insertion of elements has to be done one thread at a time.
-                    std::lock_guard<std::mutex> lock(acc.m_mtxMapInsert);
-
-                    // Save the thread id, and index.
-                    acc.m_threadsToIndices.emplace(threadId, blockThreadIdx);
-                    itThreadToBarrier = acc.m_mThreadsToBarrier.emplace(threadId, 0).first;
-                }
-
-                // Sync all threads so that the maps with thread id's are complete and not changed after here.
-                acc.syncBlockThreads(itThreadToBarrier);
+                // The index is thread local so it has to be set up on this thread before the kernel can use it.
+                idx::bt::IdxBtThreadLocal<TDim, TSize>::threadLocalBlockThreadIdx() = blockThreadIdx;
 
                 // Execute the kernel itself.
                 kernelFnObj(
                     const_cast<acc::AccCpuThreads<TDim, TSize> const &>(acc),
                     args...);
-
-                // We have to sync all threads here because if a thread would finish before all threads have been started,
-                // a new thread could get the recycled (then duplicate) thread id!
-                acc.syncBlockThreads(itThreadToBarrier);
             }
 
             TKernelFnObj m_kernelFnObj;
@@ -0,0 +1,384 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Specialized traits.
+#include <alpaka/acc/Traits.hpp>                // acc::traits::AccType
+#include <alpaka/dev/Traits.hpp>                // dev::traits::DevType
+#include <alpaka/dim/Traits.hpp>                // dim::traits::DimType
+#include <alpaka/exec/Traits.hpp>               // exec::traits::ExecType
+#include <alpaka/size/Traits.hpp>               // size::traits::SizeType
+
+// Implementation details.
+#include <alpaka/acc/AccCpuThreadsBlocks.hpp>      // acc::AccCpuThreadsBlocks
+#include <alpaka/dev/DevCpu.hpp>                // dev::DevCpu
+#include <alpaka/kernel/Traits.hpp>             // kernel::getBlockSharedExternMemSizeBytes
+#include <alpaka/workdiv/WorkDivMembers.hpp>    // workdiv::WorkDivMembers
+
+#include <alpaka/exec/Schedule.hpp>             // exec::Schedule
+#include <alpaka/core/MapIdx.hpp>               // core::mapIdx
+#include <alpaka/core/ApplyTuple.hpp>           // core::Apply
+
+#include <boost/align.hpp>                      // boost::aligned_alloc
+
+#include <algorithm>                            // std::min, std::max
+#include <cassert>                              // assert
+#include <memory>                               // std::unique_ptr
+#include <vector>                               // std::vector
+#include <tuple>                                // std::tuple
+#include <type_traits>                          // std::decay
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+    #include <iostream>                         // std::cout
+#endif
+
+namespace alpaka
+{
+    namespace exec
+    {
+        //#############################################################################
+        //! The CPU threads block accelerator executor.
+        //#############################################################################
+        template<
+            typename TDim,
+            typename TSize,
+            typename TKernelFnObj,
+            typename... TArgs>
+        class ExecCpuThreadsBlocks final :
+            public workdiv::WorkDivMembers<TDim, TSize>
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            //! Constructor.
+            //-----------------------------------------------------------------------------
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_HOST ExecCpuThreadsBlocks(
+                TWorkDiv && workDiv,
+                TKernelFnObj const & kernelFnObj,
+                TArgs const & ... args) :
+                    workdiv::WorkDivMembers<TDim, TSize>(std::forward<TWorkDiv>(workDiv)),
+                    m_kernelFnObj(kernelFnObj),
+                    m_args(args...),
+                    m_schedule()
+            {
+
+                static_assert(
+                    dim::Dim<typename std::decay<TWorkDiv>::type>::value == TDim::value,
+                    "The work division and the executor have to be of the same dimensionality!");
+            }
+            //-----------------------------------------------------------------------------
+            //! Copy constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST ExecCpuThreadsBlocks(ExecCpuThreadsBlocks const &) = default;
+            //-----------------------------------------------------------------------------
+            //! Move constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST ExecCpuThreadsBlocks(ExecCpuThreadsBlocks &&) = default;
+            //-----------------------------------------------------------------------------
+            //! Copy assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(ExecCpuThreadsBlocks const &) -> ExecCpuThreadsBlocks & = default;
+            //-----------------------------------------------------------------------------
+            //! Move assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(ExecCpuThreadsBlocks &&) -> ExecCpuThreadsBlocks & = default;
+            //-----------------------------------------------------------------------------
+            //! Destructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST ~ExecCpuThreadsBlocks() = default;
+
+            //-----------------------------------------------------------------------------
+            //! Sets the schedule used to distribute the blocks onto the worker threads for the launches of this executor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto setSchedule(
+                Schedule const & schedule)
+            -> void
+            {
+                m_schedule = schedule;
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The schedule used to distribute the blocks onto the worker threads.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto getSchedule() const
+            -> Schedule const &
+            {
+                return m_schedule;
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Executes the kernel function object.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator()() const
+            -> void
+            {
+                ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                auto const gridBlockExtents(
+                    workdiv::getWorkDiv<Grid, Blocks>(*this));
+                auto const blockThreadExtents(
+                    workdiv::getWorkDiv<Block, Threads>(*this));
+
+                // Get the size of the block shared extern memory.
+                auto const blockSharedExternMemSizeBytes(
+                    core::apply(
+                        [&](TArgs const & ... args)
+                        {
+                            return
+                                kernel::getBlockSharedExternMemSizeBytes<
+                                    TKernelFnObj,
+                                    acc::AccCpuThreadsBlocks<TDim, TSize>>(
+                                        blockThreadExtents,
+                                        args...);
+                        },
+                        m_args));
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+                std::cout << BOOST_CURRENT_FUNCTION
+                    << " BlockSharedExternMemSizeBytes: " << blockSharedExternMemSizeBytes << " B" << std::endl;
+#endif
+                // Bind all arguments except the accelerator.
+                // TODO: With C++14 we could create a perfectly argument forwarding function object within the constructor.
+                auto const boundKernelFnObj(
+                    core::apply(
+                        [this](TArgs const & ... args)
+                        {
+                            return
+                                std::bind(
+                                    std::ref(m_kernelFnObj),
+                                    std::placeholders::_1,
+                                    std::ref(args)...);
+                        },
+                        m_args));
+
+                // The number of blocks in the grid.
+                TSize const numBlocksInGrid(gridBlockExtents.prod());
+                // There is only ever one thread in a block in the threads block accelerator.
+                assert(blockThreadExtents.prod() == 1u);
+
+                auto const dev(dev::cpu::getDev());
+                auto const devProps(acc::getAccDevProps<acc::AccCpuThreadsBlocks<TDim, TSize>>(dev));
+                TSize const numWorkers(
+                    std::max(
+                        static_cast<TSize>(1u),
+                        std::min(
+                            numBlocksInGrid,
+                            static_cast<TSize>(devProps.m_multiProcessorCount))));
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+                std::cout << BOOST_CURRENT_FUNCTION << " numWorkers: " << numWorkers << std::endl;
+#endif
+                // Every worker has its own accelerator.
+                std::vector<std::unique_ptr<acc::AccCpuThreadsBlocks<TDim, TSize>>> accs;
+                accs.reserve(static_cast<std::size_t>(numWorkers));
+                for(TSize worker(0u); worker < numWorkers; ++worker)
+                {
+                    accs.emplace_back(
+                        new acc::AccCpuThreadsBlocks<TDim, TSize>(*static_cast<workdiv::WorkDivMembers<TDim, TSize> const *>(this)));
+
+                    if(blockSharedExternMemSizeBytes > 0u)
+                    {
+                        accs.back()->m_externalSharedMem.reset(
+                            reinterpret_cast<uint8_t *>(
+                                boost::alignment::aligned_alloc(16u, blockSharedExternMemSizeBytes)));
+                    }
+                }
+
+                detail::BlockScheduler<TSize> scheduler(
+                    m_schedule,
+                    numBlocksInGrid,
+                    numWorkers);
+
+                auto const workerFn(
+                    [&gridBlockExtents, &boundKernelFnObj, &scheduler](
+                        acc::AccCpuThreadsBlocks<TDim, TSize> & acc,
+                        TSize const & worker)
+                    {
+                        TSize begin;
+                        TSize end;
+                        while(scheduler.getNextRange(worker, begin, end))
+                        {
+                            for(TSize i(begin); i < end; ++i)
+                            {
+                                acc.m_gridBlockIdx =
+                                    core::mapIdx<TDim::value>(
+                                        Vec<dim::DimInt<1u>, TSize>(i),
+                                        gridBlockExtents);
+
+                                boundKernelFnObj(
+                                    acc);
+
+                                // After a block has been processed, the shared memory has to be deleted.
+                                block::shared::freeMem(acc);
+                            }
+                        }
+                    });
+
+                // The first worker is the calling thread, all others are taken from the device thread pool.
+                auto const numPoolWorkers(static_cast<std::size_t>(numWorkers - 1u));
+                dev::cpu::detail::ThreadPoolAcquisition const threadPoolAcquisition(*dev.m_spDevCpuImpl, numPoolWorkers);
+                auto & threadPool(threadPoolAcquisition.getThreadPool());
+
+                dev::cpu::detail::DevCpuImpl::ThreadPool::TaskGroup workers;
+                try
+                {
+                    for(TSize worker(1u); worker < numWorkers; ++worker)
+                    {
+                        auto & acc(*accs[static_cast<std::size_t>(worker)]);
+                        threadPool.enqueueTaskNoFuture(
+                            [&workerFn, &acc, worker]()
+                            {
+                                workerFn(acc, worker);
+                            },
+                            &workers);
+                    }
+                    workerFn(*accs.front(), static_cast<TSize>(0u));
+                }
+                catch(...)
+                {
+                    // The other workers reference the scheduler, the accelerators and the worker function on this stack.
+                    workers.wait();
+                    throw;
+                }
+
+                // Wait for the completion of the other workers.
+                workers.wait();
+
+                // After all blocks have been processed, the accelerators and with them the external shared memory are deleted.
+            }
+
+            TKernelFnObj m_kernelFnObj;
+            std::tuple<TArgs...> m_args;
+            Schedule m_schedule;
+        };
+    }
+
+    namespace acc
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads block executor accelerator type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct AccType<
+                exec::ExecCpuThreadsBlocks<TDim, TSize, TKernelFnObj, TArgs...>>
+            {
+                using type = acc::AccCpuThreadsBlocks<TDim, TSize>;
+            };
+        }
+    }
+    namespace dev
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads block executor device type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct DevType<
+                exec::ExecCpuThreadsBlocks<TDim, TSize, TKernelFnObj, TArgs...>>
+            {
+                using type = dev::DevCpu;
+            };
+            //#############################################################################
+            //! The CPU threads block executor device manager type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct DevManType<
+                exec::ExecCpuThreadsBlocks<TDim, TSize, TKernelFnObj, TArgs...>>
+            {
+                using type = dev::DevManCpu;
+            };
+        }
+    }
+    namespace dim
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads block executor dimension getter trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct DimType<
+                exec::ExecCpuThreadsBlocks<TDim, TSize, TKernelFnObj, TArgs...>>
+            {
+                using type = TDim;
+            };
+        }
+    }
+    namespace exec
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads block executor executor type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct ExecType<
+                exec::ExecCpuThreadsBlocks<TDim, TSize, TKernelFnObj, TArgs...>,
+                TKernelFnObj,
+                TArgs...>
+            {
+                using type = exec::ExecCpuThreadsBlocks<TDim, TSize, TKernelFnObj, TArgs...>;
+            };
+        }
+    }
+    namespace size
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU threads block executor size type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize,
+                typename TKernelFnObj,
+                typename... TArgs>
+            struct SizeType<
+                exec::ExecCpuThreadsBlocks<TDim, TSize, TKernelFnObj, TArgs...>>
+            {
+                using type = TSize;
+            };
+        }
+    }
+}
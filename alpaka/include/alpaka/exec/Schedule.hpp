@@ -0,0 +1,341 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>               // ALPAKA_FN_HOST
+
+#include <algorithm>                            // std::min, std::max
+#include <atomic>                               // std::atomic
+#include <cassert>                              // assert
+#include <cstdint>                              // std::uint8_t
+#include <memory>                               // std::unique_ptr
+#include <mutex>                                // std::mutex, std::lock_guard
+#include <vector>                               // std::vector
+
+namespace alpaka
+{
+    namespace exec
+    {
+        //#############################################################################
+        //! The ways the blocks of a grid can be distributed onto the workers of a block parallel executor.
+        //#############################################################################
+        enum class ScheduleKind
+        {
+            Static,     //!< Contiguous equally sized ranges or round-robin chunks if a chunk size is given. No balancing at all.
+            Dynamic,    //!< Chunks are taken one after another from a shared counter.
+            Guided,     //!< Like Dynamic but the chunk size decreases proportionally to the remaining blocks.
+            Stealing,   //!< Contiguous ranges per worker. Idle workers steal half of the remaining range of another worker.
+        };
+
+        //#############################################################################
+        //! The schedule used to distribute the blocks of a grid onto the workers of a block parallel executor.
+        //#############################################################################
+        struct Schedule
+        {
+            //-----------------------------------------------------------------------------
+            //! Constructor.
+            //! \param kind The schedule kind.
+            //! \param chunkSize The number of blocks taken at once. For Guided this is the minimum chunk size.
+            //!     A chunk size of zero lets the executor choose (one range per worker for Static, one block otherwise).
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST Schedule(
+                ScheduleKind const & kind = ScheduleKind::Stealing,
+                std::size_t const & chunkSize = 0u) :
+                    m_kind(kind),
+                    m_chunkSize(chunkSize)
+            {}
+
+            ScheduleKind m_kind;
+            std::size_t m_chunkSize;
+        };
+
+        namespace detail
+        {
+            //#############################################################################
+            //! Hands out the linearized block indices of a grid to a fixed number of workers according to a schedule.
+            //!
+            //! Each worker repeatedly calls getNextRange with its own worker index until it returns false.
+            //! Every block index is handed out exactly once.
+            //#############################################################################
+            template<
+                typename TSize>
+            class BlockScheduler final
+            {
+            private:
+                //#############################################################################
+                //! The range of block indices currently owned by a worker.
+                //! Padded so that neighbouring workers do not share a cache line.
+                //#############################################################################
+                struct WorkerRange
+                {
+                    std::mutex m_mtx;
+                    TSize m_begin;
+                    TSize m_end;
+                    std::uint8_t m_padding[64u];
+                };
+
+            public:
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST BlockScheduler(
+                    Schedule const & schedule,
+                    TSize const & numBlocks,
+                    TSize const & numWorkers) :
+                        m_kind(schedule.m_kind),
+                        m_chunkSize(static_cast<TSize>(schedule.m_chunkSize)),
+                        m_numBlocks(numBlocks),
+                        m_numWorkers(std::max(numWorkers, static_cast<TSize>(1u))),
+                        m_nextBlock(static_cast<TSize>(0u))
+                {
+                    if(m_kind == ScheduleKind::Stealing)
+                    {
+                        // The initial partitioning is the same as for Static so that neighbouring blocks stay on the same worker.
+                        m_vupWorkerRanges.reserve(static_cast<std::size_t>(m_numWorkers));
+                        for(TSize worker(0u); worker < m_numWorkers; ++worker)
+                        {
+                            m_vupWorkerRanges.emplace_back(new WorkerRange());
+                            m_vupWorkerRanges.back()->m_begin = getStaticRangeBegin(worker);
+                            m_vupWorkerRanges.back()->m_end = getStaticRangeBegin(worker + 1u);
+                        }
+                    }
+                    else if(m_kind == ScheduleKind::Static)
+                    {
+                        m_vStaticNextChunks.resize(static_cast<std::size_t>(m_numWorkers), static_cast<TSize>(0u));
+                    }
+
+                    if((m_kind != ScheduleKind::Static) && (m_chunkSize == 0u))
+                    {
+                        m_chunkSize = static_cast<TSize>(1u);
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Copy constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST BlockScheduler(BlockScheduler const &) = delete;
+                //-----------------------------------------------------------------------------
+                //! Move constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST BlockScheduler(BlockScheduler &&) = delete;
+                //-----------------------------------------------------------------------------
+                //! Copy assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(BlockScheduler const &) -> BlockScheduler & = delete;
+                //-----------------------------------------------------------------------------
+                //! Move assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator=(BlockScheduler &&) -> BlockScheduler & = delete;
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST ~BlockScheduler() = default;
+
+                //-----------------------------------------------------------------------------
+                //! Gets the next range of block indices [begin, end) the given worker has to execute.
+                //! \return If there was a range left.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto getNextRange(
+                    TSize const & worker,
+                    TSize & begin,
+                    TSize & end)
+                -> bool
+                {
+                    assert(worker < m_numWorkers);
+
+                    switch(m_kind)
+                    {
+                    case ScheduleKind::Static:
+                        return getNextRangeStatic(worker, begin, end);
+                    case ScheduleKind::Dynamic:
+                        return getNextRangeDynamic(begin, end);
+                    case ScheduleKind::Guided:
+                        return getNextRangeGuided(begin, end);
+                    case ScheduleKind::Stealing:
+                    default:
+                        return getNextRangeStealing(worker, begin, end);
+                    }
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! \return The first block of the contiguous range of the given worker when the blocks are split into equally sized ranges.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto getStaticRangeBegin(
+                    TSize const & worker) const
+                -> TSize
+                {
+                    TSize const blocksPerWorker(m_numBlocks / m_numWorkers);
+                    TSize const remainder(m_numBlocks % m_numWorkers);
+                    // The first remainder workers get one block more.
+                    return worker * blocksPerWorker + std::min(worker, remainder);
+                }
+                //-----------------------------------------------------------------------------
+                //!
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto getNextRangeStatic(
+                    TSize const & worker,
+                    TSize & begin,
+                    TSize & end)
+                -> bool
+                {
+                    // Only the worker itself accesses its own entry.
+                    TSize & nextChunk(m_vStaticNextChunks[static_cast<std::size_t>(worker)]);
+
+                    if(m_chunkSize == 0u)
+                    {
+                        // One contiguous range per worker.
+                        if(nextChunk > 0u)
+                        {
+                            return false;
+                        }
+                        ++nextChunk;
+                        begin = getStaticRangeBegin(worker);
+                        end = getStaticRangeBegin(worker + 1u);
+                    }
+                    else
+                    {
+                        // Round-robin chunks.
+                        begin = (nextChunk * m_numWorkers + worker) * m_chunkSize;
+                        if(begin >= m_numBlocks)
+                        {
+                            return false;
+                        }
+                        ++nextChunk;
+                        end = std::min(begin + m_chunkSize, m_numBlocks);
+                    }
+                    return begin < end;
+                }
+                //-----------------------------------------------------------------------------
+                //!
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto getNextRangeDynamic(
+                    TSize & begin,
+                    TSize & end)
+                -> bool
+                {
+                    // Check before incrementing so that the counter can not overflow.
+                    if(m_nextBlock.load(std::memory_order_relaxed) >= m_numBlocks)
+                    {
+                        return false;
+                    }
+                    begin = m_nextBlock.fetch_add(m_chunkSize, std::memory_order_relaxed);
+                    if(begin >= m_numBlocks)
+                    {
+                        return false;
+                    }
+                    end = std::min(begin + m_chunkSize, m_numBlocks);
+                    return true;
+                }
+                //-----------------------------------------------------------------------------
+                //!
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto getNextRangeGuided(
+                    TSize & begin,
+                    TSize & end)
+                -> bool
+                {
+                    begin = m_nextBlock.load(std::memory_order_relaxed);
+                    do
+                    {
+                        if(begin >= m_numBlocks)
+                        {
+                            return false;
+                        }
+                        // The same heuristic as most OpenMP runtimes: the remaining blocks divided by twice the number of workers.
+                        TSize const remaining(m_numBlocks - begin);
+                        TSize const chunkSize(std::min(remaining, std::max(m_chunkSize, remaining / (2u * m_numWorkers))));
+                        end = begin + chunkSize;
+                    }
+                    while(!m_nextBlock.compare_exchange_weak(begin, end, std::memory_order_relaxed));
+
+                    return true;
+                }
+                //-----------------------------------------------------------------------------
+                //!
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto getNextRangeStealing(
+                    TSize const & worker,
+                    TSize & begin,
+                    TSize & end)
+                -> bool
+                {
+                    // Take a chunk from the front of the own range.
+                    {
+                        WorkerRange & own(*m_vupWorkerRanges[static_cast<std::size_t>(worker)]);
+                        std::lock_guard<std::mutex> lock(own.m_mtx);
+                        if(own.m_begin < own.m_end)
+                        {
+                            begin = own.m_begin;
+                            end = std::min(begin + m_chunkSize, own.m_end);
+                            own.m_begin = end;
+                            return true;
+                        }
+                    }
+
+                    // Steal the back half of the remaining range of the next worker that has blocks left.
+                    // Victims are visited starting at the neighbour to spread the thieves.
+                    for(TSize i(1u); i < m_numWorkers; ++i)
+                    {
+                        TSize const victim((worker + i) % m_numWorkers);
+                        TSize stolenBegin;
+                        TSize stolenEnd;
+                        {
+                            WorkerRange & other(*m_vupWorkerRanges[static_cast<std::size_t>(victim)]);
+                            std::lock_guard<std::mutex> lock(other.m_mtx);
+                            if(other.m_begin >= other.m_end)
+                            {
+                                continue;
+                            }
+                            stolenEnd = other.m_end;
+                            stolenBegin = other.m_begin + (other.m_end - other.m_begin) / 2u;
+                            other.m_end = stolenBegin;
+                        }
+
+                        // Execute the first chunk directly and make the rest available to other thieves.
+                        begin = stolenBegin;
+                        end = std::min(begin + m_chunkSize, stolenEnd);
+                        {
+                            WorkerRange & own(*m_vupWorkerRanges[static_cast<std::size_t>(worker)]);
+                            std::lock_guard<std::mutex> lock(own.m_mtx);
+                            own.m_begin = end;
+                            own.m_end = stolenEnd;
+                        }
+                        return true;
+                    }
+
+                    // Ranges only ever shrink or move between workers so there is nothing left for this worker.
+                    return false;
+                }
+
+            private:
+                ScheduleKind const m_kind;
+                TSize m_chunkSize;
+                TSize const m_numBlocks;
+                TSize const m_numWorkers;
+
+                std::atomic<TSize> m_nextBlock;                             //!< The next block for Dynamic and Guided.
+                std::vector<TSize> m_vStaticNextChunks;                     //!< The next chunk of each worker for Static.
+                std::vector<std::unique_ptr<WorkerRange>> m_vupWorkerRanges;//!< The remaining range of each worker for Stealing.
+            };
+        }
+    }
+}
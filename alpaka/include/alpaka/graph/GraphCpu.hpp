@@ -0,0 +1,124 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>   // ALPAKA_FN_HOST
+
+#include <functional>               // std::function
+#include <memory>                   // std::shared_ptr
+#include <vector>                   // std::vector
+
+namespace alpaka
+{
+    namespace graph
+    {
+        namespace cpu
+        {
+            namespace detail
+            {
+                //#############################################################################
+                //! The CPU graph implementation.
+                //#############################################################################
+                class GraphCpuImpl final
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    //! Appends a copy of the given task.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TTask>
+                    ALPAKA_FN_HOST auto addTask(
+                        TTask const & task)
+                    -> void
+                    {
+                        m_vTasks.emplace_back(task);
+                    }
+
+                public:
+                    std::vector<std::function<void()>> m_vTasks;    //!< The recorded tasks in enqueue order.
+                };
+            }
+        }
+
+        //#############################################################################
+        //! The CPU graph.
+        //!
+        //! It holds copies of the tasks captured from a CPU stream.
+        //! Executors already carry their work division and kernel arguments, so replaying the graph only invokes the tasks one after another.
+        //! Copies of a graph share the recorded tasks, so enqueuing a graph does not copy them.
+        //! The buffers and views used by the recorded tasks have to be kept alive as long as the graph is used.
+        //#############################################################################
+        class GraphCpu final
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            //! Constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST GraphCpu() :
+                m_spGraphCpuImpl(std::make_shared<cpu::detail::GraphCpuImpl>())
+            {}
+            //-----------------------------------------------------------------------------
+            //! Copy constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST GraphCpu(GraphCpu const &) = default;
+            //-----------------------------------------------------------------------------
+            //! Move constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST GraphCpu(GraphCpu &&) = default;
+            //-----------------------------------------------------------------------------
+            //! Copy assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(GraphCpu const &) -> GraphCpu & = default;
+            //-----------------------------------------------------------------------------
+            //! Move assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(GraphCpu &&) -> GraphCpu & = default;
+            //-----------------------------------------------------------------------------
+            //! Destructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST ~GraphCpu() = default;
+
+            //-----------------------------------------------------------------------------
+            //! Executes all recorded tasks in the order they have been enqueued.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator()() const
+            -> void
+            {
+                for(auto const & task : m_spGraphCpuImpl->m_vTasks)
+                {
+                    task();
+                }
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The number of recorded tasks.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto getTaskCount() const
+            -> std::size_t
+            {
+                return m_spGraphCpuImpl->m_vTasks.size();
+            }
+
+        public:
+            std::shared_ptr<cpu::detail::GraphCpuImpl> m_spGraphCpuImpl;
+        };
+    }
+}
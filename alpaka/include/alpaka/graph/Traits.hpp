@@ -0,0 +1,108 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>   // ALPAKA_FN_HOST
+
+namespace alpaka
+{
+    //-----------------------------------------------------------------------------
+    //! The graph specifics.
+    //!
+    //! A graph is a sequence of tasks recorded from a stream that can be enqueued again as a whole.
+    //-----------------------------------------------------------------------------
+    namespace graph
+    {
+        //-----------------------------------------------------------------------------
+        //! The graph traits.
+        //-----------------------------------------------------------------------------
+        namespace traits
+        {
+            //#############################################################################
+            //! The graph type trait.
+            //#############################################################################
+            template<
+                typename TStream,
+                typename TSfinae = void>
+            struct GraphType;
+
+            //#############################################################################
+            //! The begin capture trait.
+            //#############################################################################
+            template<
+                typename TStream,
+                typename TSfinae = void>
+            struct BeginCapture;
+
+            //#############################################################################
+            //! The end capture trait.
+            //#############################################################################
+            template<
+                typename TStream,
+                typename TSfinae = void>
+            struct EndCapture;
+        }
+
+        //#############################################################################
+        //! The graph type trait alias template to remove the ::type.
+        //#############################################################################
+        template<
+            typename TStream>
+        using Graph = typename traits::GraphType<TStream>::type;
+
+        //-----------------------------------------------------------------------------
+        //! Starts recording the tasks enqueued into the given stream.
+        //!
+        //! Until endCapture is called, the tasks enqueued into the stream are not executed but appended to a new graph.
+        //-----------------------------------------------------------------------------
+        template<
+            typename TStream>
+        ALPAKA_FN_HOST auto beginCapture(
+            TStream & stream)
+        -> void
+        {
+            traits::BeginCapture<
+                TStream>
+            ::beginCapture(
+                stream);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Stops recording the tasks enqueued into the given stream.
+        //!
+        //! \return The graph containing all tasks enqueued since beginCapture.
+        //!  It can be enqueued into any stream of the same type as often as required, each time with a single enqueue.
+        //-----------------------------------------------------------------------------
+        template<
+            typename TStream>
+        ALPAKA_FN_HOST auto endCapture(
+            TStream & stream)
+        -> Graph<TStream>
+        {
+            return
+                traits::EndCapture<
+                    TStream>
+                ::endCapture(
+                    stream);
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/idx/Traits.hpp>            // idx::getIdx
+
+#include <alpaka/core/Fibers.hpp>           // boost::fibers::fiber_specific_ptr
+
+#include <boost/core/ignore_unused.hpp>     // boost::ignore_unused
+
+namespace alpaka
+{
+    namespace idx
+    {
+        namespace bt
+        {
+            //#############################################################################
+            //! The fibers accelerator index provider.
+            //!
+            //! Every fiber stores its own index in fiber local storage.
+            //! This is valid because a fiber executes at most one block thread at a time.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            class IdxBtFiberLocal
+            {
+            public:
+                using IdxBtBase = IdxBtFiberLocal;
+
+                //-----------------------------------------------------------------------------
+                //! Default constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA IdxBtFiberLocal() = default;
+                //-----------------------------------------------------------------------------
+                //! Copy constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA IdxBtFiberLocal(IdxBtFiberLocal const &) = delete;
+                //-----------------------------------------------------------------------------
+                //! Move constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA IdxBtFiberLocal(IdxBtFiberLocal &&) = delete;
+                //-----------------------------------------------------------------------------
+                //! Copy assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(IdxBtFiberLocal const &) -> IdxBtFiberLocal & = delete;
+                //-----------------------------------------------------------------------------
+                //! Move assignment operator.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(IdxBtFiberLocal &&) -> IdxBtFiberLocal & = delete;
+                //-----------------------------------------------------------------------------
+                //! Destructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~IdxBtFiberLocal() = default;
+
+                //-----------------------------------------------------------------------------
+                //! \return The index of the block thread executed by the calling fiber.
+                //! It has to be set by the executor before the kernel is invoked on this fiber.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA static auto fiberLocalBlockThreadIdx()
+                -> Vec<TDim, TSize> &
+                {
+                    // The slot is allocated on the first use by a fiber and deleted when the fiber ends.
+                    static boost::fibers::fiber_specific_ptr<Vec<TDim, TSize>> spBlockThreadIdx;
+                    auto * pBlockThreadIdx(spBlockThreadIdx.get());
+                    if(!pBlockThreadIdx)
+                    {
+                        pBlockThreadIdx = new Vec<TDim, TSize>(Vec<TDim, TSize>::zeros());
+                        spBlockThreadIdx.reset(pBlockThreadIdx);
+                    }
+                    return *pBlockThreadIdx;
+                }
+            };
+        }
+    }
+
+    namespace dim
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU fibers accelerator index dimension get trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct DimType<
+                idx::bt::IdxBtFiberLocal<TDim, TSize>>
+            {
+                using type = TDim;
+            };
+        }
+    }
+    namespace idx
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU fibers accelerator block thread index get trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct GetIdx<
+                idx::bt::IdxBtFiberLocal<TDim, TSize>,
+                origin::Block,
+                unit::Threads>
+            {
+                //-----------------------------------------------------------------------------
+                //! \return The index of the current thread in the block.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TWorkDiv>
+                ALPAKA_FN_ACC_NO_CUDA static auto getIdx(
+                    idx::bt::IdxBtFiberLocal<TDim, TSize> const & idx,
+                    TWorkDiv const & workDiv)
+                -> Vec<TDim, TSize>
+                {
+                    boost::ignore_unused(idx, workDiv);
+                    return idx::bt::IdxBtFiberLocal<TDim, TSize>::fiberLocalBlockThreadIdx();
+                }
+            };
+        }
+    }
+    namespace size
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU fibers accelerator block thread index size type trait specialization.
+            //#############################################################################
+            template<
+                typename TDim,
+                typename TSize>
+            struct SizeType<
+                idx::bt::IdxBtFiberLocal<TDim, TSize>>
+            {
+                using type = TSize;
+            };
+        }
+    }
+}
@@ -23,12 +23,10 @@
 
 #include <alpaka/idx/Traits.hpp>            // idx::getIdx
 
-#include <alpaka/core/Fibers.hpp>
+#include <alpaka/dim/Traits.hpp>            // dim::Dim
 
 #include <boost/core/ignore_unused.hpp>     // boost::ignore_unused
 
-#include <map>                              // std::map
-
 namespace alpaka
 {
     namespace idx
@@ -36,48 +34,46 @@ namespace alpaka
         namespace bt
         {
             //#############################################################################
-            //! The fibers accelerator index provider.
+            //! A IdxBtRef block thread index.
             //#############################################################################
             template<
                 typename TDim,
                 typename TSize>
-            class IdxBtRefFiberIdMap
+            class IdxBtRef
             {
             public:
-                using IdxBtBase = IdxBtRefFiberIdMap;
-
-                using FiberIdToIdxMap = std::map<boost::fibers::fiber::id, Vec<TDim, TSize>>;
+                using IdxBtBase = IdxBtRef;
 
                 //-----------------------------------------------------------------------------
-                //! Constructor.
+                //! Default constructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA IdxBtRefFiberIdMap(
-                    FiberIdToIdxMap const & mFibersToIndices) :
-                    m_fibersToIndices(mFibersToIndices)
+                ALPAKA_FN_ACC_NO_CUDA IdxBtRef(
+                    Vec<TDim, TSize> const & blockThreadIdx) :
+                        m_blockThreadIdx(blockThreadIdx)
                 {}
                 //-----------------------------------------------------------------------------
                 //! Copy constructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA IdxBtRefFiberIdMap(IdxBtRefFiberIdMap const &) = delete;
+                ALPAKA_FN_ACC_NO_CUDA IdxBtRef(IdxBtRef const &) = delete;
                 //-----------------------------------------------------------------------------
                 //! Move constructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA IdxBtRefFiberIdMap(IdxBtRefFiberIdMap &&) = delete;
+                ALPAKA_FN_ACC_NO_CUDA IdxBtRef(IdxBtRef &&) = delete;
                 //-----------------------------------------------------------------------------
                 //! Copy assignment operator.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA auto operator=(IdxBtRefFiberIdMap const &) -> IdxBtRefFiberIdMap & = delete;
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(IdxBtRef const &) -> IdxBtRef & = delete;
                 //-----------------------------------------------------------------------------
                 //! Move assignment operator.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA auto operator=(IdxBtRefFiberIdMap &&) -> IdxBtRefFiberIdMap & = delete;
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(IdxBtRef &&) -> IdxBtRef & = delete;
                 //-----------------------------------------------------------------------------
                 //! Destructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~IdxBtRefFiberIdMap() = default;
+                ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~IdxBtRef() = default;
 
             public:
-                FiberIdToIdxMap const & m_fibersToIndices; //!< The mapping of fiber id's to fiber indices.
+                alignas(16u) Vec<TDim, TSize> const & m_blockThreadIdx;
             };
         }
     }
@@ -87,13 +83,13 @@ namespace alpaka
         namespace traits
         {
             //#############################################################################
-            //! The CPU fibers accelerator index dimension get trait specialization.
+            //! The IdxBtRef block thread index dimension get trait specialization.
             //#############################################################################
             template<
                 typename TDim,
                 typename TSize>
             struct DimType<
-                idx::bt::IdxBtRefFiberIdMap<TDim, TSize>>
+                idx::bt::IdxBtRef<TDim, TSize>>
             {
                 using type = TDim;
             };
@@ -104,13 +100,13 @@ namespace alpaka
         namespace traits
         {
             //#############################################################################
-            //! The CPU fibers accelerator block thread index get trait specialization.
+            //! The IdxBtRef block thread index block thread index get trait specialization.
             //#############################################################################
             template<
                 typename TDim,
                 typename TSize>
             struct GetIdx<
-                idx::bt::IdxBtRefFiberIdMap<TDim, TSize>,
+                idx::bt::IdxBtRef<TDim, TSize>,
                 origin::Block,
                 unit::Threads>
             {
@@ -120,15 +116,12 @@ namespace alpaka
                 template<
                     typename TWorkDiv>
                 ALPAKA_FN_ACC_NO_CUDA static auto getIdx(
-                    idx::bt::IdxBtRefFiberIdMap<TDim, TSize> const & idx,
+                    idx::bt::IdxBtRef<TDim, TSize> const & idx,
                     TWorkDiv const & workDiv)
                 -> Vec<TDim, TSize>
                 {
                     boost::ignore_unused(workDiv);
-                    auto const fiberId(boost::this_fiber::get_id());
-                    auto const fiberEntry(idx.m_fibersToIndices.find(fiberId));
-                    assert(fiberEntry != idx.m_fibersToIndices.end());
-                    return fiberEntry->second;
+                    return idx.m_blockThreadIdx;
                 }
             };
         }
@@ -138,13 +131,13 @@ namespace alpaka
         namespace traits
         {
             //#############################################################################
-            //! The CPU fibers accelerator block thread index size type trait specialization.
+            //! The IdxBtRef block thread index size type trait specialization.
             //#############################################################################
             template<
                 typename TDim,
                 typename TSize>
             struct SizeType<
-                idx::bt::IdxBtRefFiberIdMap<TDim, TSize>>
+                idx::bt::IdxBtRef<TDim, TSize>>
             {
                 using type = TSize;
             };
@@ -25,9 +25,6 @@
 
 #include <boost/core/ignore_unused.hpp>     // boost::ignore_unused
 
-#include <thread>                           // std::thread
-#include <map>                              // std::map
-
 namespace alpaka
 {
     namespace idx
@@ -36,47 +33,53 @@ namespace alpaka
         {
             //#############################################################################
             //! The threads accelerator index provider.
+            //!
+            //! Every thread stores its own index in thread local storage.
+            //! This is valid because a thread executes at most one block thread at a time.
             //#############################################################################
             template<
                 typename TDim,
                 typename TSize>
-            class IdxBtRefThreadIdMap
+            class IdxBtThreadLocal
             {
             public:
-                using IdxBtBase = IdxBtRefThreadIdMap;
-
-                using ThreadIdToIdxMap = std::map<std::thread::id, Vec<TDim, TSize>>;
+                using IdxBtBase = IdxBtThreadLocal;
 
                 //-----------------------------------------------------------------------------
-                //! Constructor.
+                //! Default constructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA IdxBtRefThreadIdMap(
-                    ThreadIdToIdxMap const & mThreadsToIndices) :
-                    m_threadsToIndices(mThreadsToIndices)
-                {}
+                ALPAKA_FN_ACC_NO_CUDA IdxBtThreadLocal() = default;
                 //-----------------------------------------------------------------------------
                 //! Copy constructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA IdxBtRefThreadIdMap(IdxBtRefThreadIdMap const &) = delete;
+                ALPAKA_FN_ACC_NO_CUDA IdxBtThreadLocal(IdxBtThreadLocal const &) = delete;
                 //-----------------------------------------------------------------------------
                 //! Move constructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA IdxBtRefThreadIdMap(IdxBtRefThreadIdMap &&) = delete;
+                ALPAKA_FN_ACC_NO_CUDA IdxBtThreadLocal(IdxBtThreadLocal &&) = delete;
                 //-----------------------------------------------------------------------------
                 //! Copy assignment operator.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA auto operator=(IdxBtRefThreadIdMap const &) -> IdxBtRefThreadIdMap & = delete;
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(IdxBtThreadLocal const &) -> IdxBtThreadLocal & = delete;
                 //-----------------------------------------------------------------------------
                 //! Move assignment operator.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA auto operator=(IdxBtRefThreadIdMap &&) -> IdxBtRefThreadIdMap & = delete;
+                ALPAKA_FN_ACC_NO_CUDA auto operator=(IdxBtThreadLocal &&) -> IdxBtThreadLocal & = delete;
                 //-----------------------------------------------------------------------------
                 //! Destructor.
                 //-----------------------------------------------------------------------------
-                ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~IdxBtRefThreadIdMap() = default;
+                ALPAKA_FN_ACC_NO_CUDA /*virtual*/ ~IdxBtThreadLocal() = default;
 
-            public:
-                ThreadIdToIdxMap const & m_threadsToIndices;   //!< The mapping of thread id's to thread indices.
+                //-----------------------------------------------------------------------------
+                //! \return The index of the block thread executed by the calling thread.
+                //! It has to be set by the executor before the kernel is invoked on this thread.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_ACC_NO_CUDA static auto threadLocalBlockThreadIdx()
+                -> Vec<TDim, TSize> &
+                {
+                    static thread_local Vec<TDim, TSize> blockThreadIdx(Vec<TDim, TSize>::zeros());
+                    return blockThreadIdx;
+                }
             };
         }
     }
@@ -92,7 +95,7 @@ namespace alpaka
                 typename TDim,
                 typename TSize>
             struct DimType<
-                idx::bt::IdxBtRefThreadIdMap<TDim, TSize>>
+                idx::bt::IdxBtThreadLocal<TDim, TSize>>
             {
                 using type = TDim;
             };
@@ -109,7 +112,7 @@ namespace alpaka
                 typename TDim,
                 typename TSize>
             struct GetIdx<
-                idx::bt::IdxBtRefThreadIdMap<TDim, TSize>,
+                idx::bt::IdxBtThreadLocal<TDim, TSize>,
                 origin::Block,
                 unit::Threads>
             {
@@ -119,15 +122,12 @@ namespace alpaka
                 template<
                     typename TWorkDiv>
                 ALPAKA_FN_ACC_NO_CUDA static auto getIdx(
-                    idx::bt::IdxBtRefThreadIdMap<TDim, TSize> const & idx,
+                    idx::bt::IdxBtThreadLocal<TDim, TSize> const & idx,
                     TWorkDiv const & workDiv)
                 -> Vec<TDim, TSize>
                 {
-                    boost::ignore_unused(workDiv);
-                    auto const threadId(std::this_thread::get_id());
-                    auto const threadEntry(idx.m_threadsToIndices.find(threadId));
-                    assert(threadEntry != idx.m_threadsToIndices.end());
-                    return threadEntry->second;
+                    boost::ignore_unused(idx, workDiv);
+                    return idx::bt::IdxBtThreadLocal<TDim, TSize>::threadLocalBlockThreadIdx();
                 }
             };
         }
@@ -143,7 +143,7 @@ namespace alpaka
                 typename TDim,
                 typename TSize>
             struct SizeType<
-                idx::bt::IdxBtRefThreadIdMap<TDim, TSize>>
+                idx::bt::IdxBtThreadLocal<TDim, TSize>>
             {
                 using type = TSize;
             };
@@ -0,0 +1,359 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/mem/alloc/AllocCpuBoostAligned.hpp>    // mem::alloc::AllocCpuBoostAligned
+
+#include <alpaka/core/Common.hpp>                       // ALPAKA_FN_HOST
+
+#include <atomic>                                       // std::atomic
+#include <cassert>                                      // assert
+#include <cstddef>                                      // std::size_t
+#include <memory>                                       // std::shared_ptr
+#include <mutex>                                        // std::mutex
+#include <type_traits>                                  // std::integral_constant
+#include <unordered_map>                                // std::unordered_map
+#include <vector>                                       // std::vector
+
+namespace alpaka
+{
+    namespace mem
+    {
+        //-----------------------------------------------------------------------------
+        //! The allocator specifics.
+        //-----------------------------------------------------------------------------
+        namespace alloc
+        {
+            //#############################################################################
+            //! The statistics of a block cache.
+            //#############################################################################
+            struct CacheStats
+            {
+                std::size_t m_hitCount;         //!< The number of allocations served from the cache.
+                std::size_t m_missCount;        //!< The number of allocations that had to allocate new memory.
+                std::size_t m_releaseCount;     //!< The number of blocks given back to the system because of the limit or a trim.
+                std::size_t m_inUseBytes;       //!< The size of the blocks currently in use.
+                std::size_t m_cachedBytes;      //!< The size of the unused blocks currently held by the cache.
+                std::size_t m_maxCachedBytes;   //!< The limit of the size of the unused blocks held by the cache.
+            };
+
+            namespace cpu
+            {
+                namespace detail
+                {
+                    //#############################################################################
+                    //! A thread safe cache of memory blocks sorted into size classes.
+                    //!
+                    //! Freed blocks are kept for reuse by later allocations of the same size class as long as the size of all unused blocks stays below the limit.
+                    //! Reused blocks are already mapped, so they neither need a system call nor take page faults.
+                    //! The size classes divide every power of two into four steps, so at most a fifth of a block is wasted.
+                    //! All blocks are cache line aligned.
+                    //#############################################################################
+                    class BlockCache final
+                    {
+                    private:
+                        using AllocBlock = mem::alloc::AllocCpuBoostAligned<std::integral_constant<std::size_t, 64u>>;
+
+                    public:
+                        //-----------------------------------------------------------------------------
+                        //! Constructor.
+                        //!
+                        //! \param maxCachedBytes The limit of the size of the unused blocks. A limit of 0 disables the cache.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST BlockCache(
+                            std::size_t const & maxCachedBytes = 0u) :
+                                m_maxCachedBytes(maxCachedBytes),
+                                m_hitCount(0u),
+                                m_missCount(0u),
+                                m_releaseCount(0u),
+                                m_inUseBytes(0u),
+                                m_cachedBytes(0u)
+                        {}
+                        //-----------------------------------------------------------------------------
+                        //! Copy constructor.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST BlockCache(BlockCache const &) = delete;
+                        //-----------------------------------------------------------------------------
+                        //! Move constructor.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST BlockCache(BlockCache &&) = delete;
+                        //-----------------------------------------------------------------------------
+                        //! Copy assignment operator.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto operator=(BlockCache const &) -> BlockCache & = delete;
+                        //-----------------------------------------------------------------------------
+                        //! Move assignment operator.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto operator=(BlockCache &&) -> BlockCache & = delete;
+                        //-----------------------------------------------------------------------------
+                        //! Destructor.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST ~BlockCache()
+                        {
+                            trim();
+                        }
+
+                        //-----------------------------------------------------------------------------
+                        //! \return If the cache keeps freed blocks.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto isEnabled() const
+                        -> bool
+                        {
+                            return m_maxCachedBytes.load(std::memory_order_relaxed) != 0u;
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! Sets the limit of the size of the unused blocks and releases the blocks above it.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto setMaxCachedBytes(
+                            std::size_t const & maxCachedBytes)
+                        -> void
+                        {
+                            std::lock_guard<std::mutex> lk(m_mtx);
+
+                            m_maxCachedBytes.store(maxCachedBytes, std::memory_order_relaxed);
+                            releaseAbove(maxCachedBytes);
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! Releases all unused blocks.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto trim()
+                        -> void
+                        {
+                            std::lock_guard<std::mutex> lk(m_mtx);
+
+                            releaseAbove(0u);
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! \return The statistics of the cache.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto getStats() const
+                        -> CacheStats
+                        {
+                            std::lock_guard<std::mutex> lk(m_mtx);
+
+                            return
+                                CacheStats{
+                                    m_hitCount,
+                                    m_missCount,
+                                    m_releaseCount,
+                                    m_inUseBytes,
+                                    m_cachedBytes,
+                                    m_maxCachedBytes.load(std::memory_order_relaxed)};
+                        }
+
+                        //-----------------------------------------------------------------------------
+                        //! \return A block of at least the given size.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto alloc(
+                            std::size_t const & sizeBytes)
+                        -> void *
+                        {
+                            std::size_t const classBytes(getSizeClassBytes(sizeBytes));
+
+                            std::unique_lock<std::mutex> lk(m_mtx);
+
+                            void * pBlock(nullptr);
+                            auto const itFreeBlocks(m_freeBlocks.find(classBytes));
+                            if((itFreeBlocks != m_freeBlocks.end()) && (!itFreeBlocks->second.empty()))
+                            {
+                                pBlock = itFreeBlocks->second.back();
+                                itFreeBlocks->second.pop_back();
+                                m_cachedBytes -= classBytes;
+                                ++m_hitCount;
+                            }
+                            else
+                            {
+                                ++m_missCount;
+                                // The system allocation does not need the lock.
+                                lk.unlock();
+                                pBlock = mem::alloc::alloc<char>(AllocBlock(), classBytes);
+                                if(pBlock == nullptr)
+                                {
+                                    return nullptr;
+                                }
+                                lk.lock();
+                            }
+
+                            m_inUseBlocks.emplace(pBlock, classBytes);
+                            m_inUseBytes += classBytes;
+                            return pBlock;
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! Returns the block allocated with alloc to the cache.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto free(
+                            void * const pBlock)
+                        -> void
+                        {
+                            if(pBlock == nullptr)
+                            {
+                                return;
+                            }
+
+                            std::unique_lock<std::mutex> lk(m_mtx);
+
+                            auto const itInUseBlock(m_inUseBlocks.find(pBlock));
+                            assert(itInUseBlock != m_inUseBlocks.end());
+                            std::size_t const classBytes(itInUseBlock->second);
+                            m_inUseBlocks.erase(itInUseBlock);
+                            m_inUseBytes -= classBytes;
+
+                            if(m_cachedBytes + classBytes <= m_maxCachedBytes.load(std::memory_order_relaxed))
+                            {
+                                m_freeBlocks[classBytes].push_back(pBlock);
+                                m_cachedBytes += classBytes;
+                            }
+                            else
+                            {
+                                ++m_releaseCount;
+                                lk.unlock();
+                                mem::alloc::free(AllocBlock(), static_cast<char const *>(pBlock));
+                            }
+                        }
+
+                    private:
+                        //-----------------------------------------------------------------------------
+                        //! \return The size of the size class of the given size.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST static auto getSizeClassBytes(
+                            std::size_t const & sizeBytes)
+                        -> std::size_t
+                        {
+                            if(sizeBytes <= 64u)
+                            {
+                                return 64u;
+                            }
+                            // Round up to a quarter of the largest power of two not larger than the size.
+                            std::size_t powerOfTwo(64u);
+                            while(powerOfTwo <= (sizeBytes >> 1u))
+                            {
+                                powerOfTwo <<= 1u;
+                            }
+                            std::size_t const stepBytes(powerOfTwo >> 2u);
+                            return ((sizeBytes + stepBytes - 1u) / stepBytes) * stepBytes;
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! Releases unused blocks until their size is not larger than the given size.
+                        //! The mutex has to be locked.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto releaseAbove(
+                            std::size_t const & maxCachedBytes)
+                        -> void
+                        {
+                            for(auto & freeBlocks : m_freeBlocks)
+                            {
+                                while((m_cachedBytes > maxCachedBytes) && (!freeBlocks.second.empty()))
+                                {
+                                    mem::alloc::free(AllocBlock(), static_cast<char const *>(freeBlocks.second.back()));
+                                    freeBlocks.second.pop_back();
+                                    m_cachedBytes -= freeBlocks.first;
+                                    ++m_releaseCount;
+                                }
+                            }
+                        }
+
+                    private:
+                        std::mutex mutable m_mtx;
+                        std::atomic<std::size_t> m_maxCachedBytes;
+                        std::unordered_map<std::size_t, std::vector<void *>> m_freeBlocks;  //!< The unused blocks by size class.
+                        std::unordered_map<void *, std::size_t> m_inUseBlocks;              //!< The size class of the blocks in use.
+                        std::size_t m_hitCount;
+                        std::size_t m_missCount;
+                        std::size_t m_releaseCount;
+                        std::size_t m_inUseBytes;
+                        std::size_t m_cachedBytes;
+                    };
+                }
+            }
+
+            //#############################################################################
+            //! The CPU caching allocator.
+            //!
+            //! It allocates from a shared block cache. The cache lives as long as the last allocator referencing it.
+            //#############################################################################
+            class AllocCpuCaching
+            {
+            public:
+                using AllocBase = AllocCpuCaching;
+
+            public:
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST AllocCpuCaching(
+                    std::shared_ptr<cpu::detail::BlockCache> const & spCache) :
+                        m_spCache(spCache)
+                {}
+
+            public:
+                std::shared_ptr<cpu::detail::BlockCache> m_spCache;
+            };
+
+            namespace traits
+            {
+                //#############################################################################
+                //! The CPU caching allocator memory allocation trait specialization.
+                //#############################################################################
+                template<
+                    typename T>
+                struct Alloc<
+                    T,
+                    AllocCpuCaching>
+                {
+                    //-----------------------------------------------------------------------------
+                    //
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST static auto alloc(
+                        AllocCpuCaching const & alloc,
+                        std::size_t const & sizeElems)
+                    -> T *
+                    {
+                        return reinterpret_cast<T *>(alloc.m_spCache->alloc(sizeElems * sizeof(T)));
+                    }
+                };
+
+                //#############################################################################
+                //! The CPU caching allocator memory free trait specialization.
+                //#############################################################################
+                template<
+                    typename T>
+                struct Free<
+                    T,
+                    AllocCpuCaching>
+                {
+                    //-----------------------------------------------------------------------------
+                    //
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST static auto free(
+                        AllocCpuCaching const & alloc,
+                        T const * const ptr)
+                    -> void
+                    {
+                        alloc.m_spCache->free(
+                            const_cast<void *>(
+                                reinterpret_cast<void const *>(ptr)));
+                    }
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,291 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/mem/alloc/Traits.hpp>  // mem::alloc::Alloc, mem::alloc::Free
+
+#include <alpaka/core/Common.hpp>       // ALPAKA_FN_HOST
+
+#include <boost/predef.h>               // BOOST_OS_XXX
+
+#if BOOST_OS_UNIX
+    #include <sys/mman.h>               // mmap, madvise, munmap
+    #include <unistd.h>                 // sysconf
+#else
+    #include <boost/align.hpp>          // boost::aligned_alloc
+#endif
+
+#if BOOST_OS_LINUX
+    #include <fstream>                  // std::ifstream
+    #include <string>                   // std::string
+#endif
+
+#include <cstddef>                      // std::size_t
+#include <cstdint>                      // std::uintptr_t
+#include <stdexcept>                    // std::invalid_argument
+
+namespace alpaka
+{
+    namespace mem
+    {
+        //-----------------------------------------------------------------------------
+        //! The allocator specifics.
+        //-----------------------------------------------------------------------------
+        namespace alloc
+        {
+            //#############################################################################
+            //! The kind of huge pages to back an allocation with.
+            //#############################################################################
+            enum class HugePages
+            {
+                None,           //!< Uses normal pages. The memory is still mapped separately, so its page placement can be controlled.
+                Transparent,    //!< Asks the kernel to back the memory with transparent huge pages (madvise(MADV_HUGEPAGE)).
+                Explicit        //!< Uses the reserved huge pages (MAP_HUGETLB) and falls back to transparent huge pages if there are not enough of them.
+            };
+
+            namespace cpu
+            {
+                namespace detail
+                {
+                    //-----------------------------------------------------------------------------
+                    //! \return The size of a memory page in bytes.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getPageSizeBytes()
+                    -> std::size_t
+                    {
+#if BOOST_OS_UNIX
+                        static std::size_t const pageSizeBytes(static_cast<std::size_t>(sysconf(_SC_PAGESIZE)));
+                        return pageSizeBytes;
+#else
+                        return static_cast<std::size_t>(4096u);
+#endif
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The size of a huge page in bytes.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getHugePageSizeBytes()
+                    -> std::size_t
+                    {
+#if BOOST_OS_LINUX
+                        static std::size_t const hugePageSizeBytes(
+                            []()
+                            {
+                                std::size_t sizeKiB(2048u);
+                                std::ifstream meminfo("/proc/meminfo");
+                                for(std::string key; meminfo >> key;)
+                                {
+                                    if(key == "Hugepagesize:")
+                                    {
+                                        meminfo >> sizeKiB;
+                                        break;
+                                    }
+                                }
+                                return sizeKiB * static_cast<std::size_t>(1024u);
+                            }());
+                        return hugePageSizeBytes;
+#else
+                        return static_cast<std::size_t>(2u * 1024u * 1024u);
+#endif
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return The value rounded up to a multiple of the power of two alignment.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto alignUp(
+                        std::uintptr_t const & value,
+                        std::size_t const & alignment)
+                    -> std::uintptr_t
+                    {
+                        return (value + static_cast<std::uintptr_t>(alignment - 1u)) & ~static_cast<std::uintptr_t>(alignment - 1u);
+                    }
+                    //#############################################################################
+                    //! The bookkeeping stored directly in front of the memory returned by AllocCpuHugePages.
+                    //#############################################################################
+                    struct MappingHeader
+                    {
+                        void * m_pBase;
+                        std::size_t m_mappedBytes;
+                    };
+                }
+            }
+
+            //#############################################################################
+            //! The CPU huge page allocator.
+            //!
+            //! Large buffers touch fewer pages and take fewer TLB misses when they are backed by huge pages.
+            //! The memory is mapped with mmap. Explicit huge pages fall back to transparent huge pages and those to normal pages
+            //! if the system does not provide them, so the allocation only fails if there is no memory at all.
+            //! Allocations of at least one huge page start at a huge page boundary.
+            //! On systems without mmap this uses the boost aligned allocator.
+            //#############################################################################
+            class AllocCpuHugePages
+            {
+            public:
+                using AllocBase = AllocCpuHugePages;
+
+            public:
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //!
+                //! \param alignmentBytes The minimum alignment of the allocated memory. It has to be a power of two not larger than the page size.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST AllocCpuHugePages(
+                    HugePages const & hugePages = HugePages::Transparent,
+                    std::size_t const & alignmentBytes = cpu::detail::getPageSizeBytes()) :
+                        m_hugePages(hugePages),
+                        m_alignmentBytes(alignmentBytes)
+                {
+                    if((alignmentBytes == 0u) || ((alignmentBytes & (alignmentBytes - 1u)) != 0u) || (alignmentBytes > cpu::detail::getPageSizeBytes()))
+                    {
+                        throw std::invalid_argument("The alignment of an AllocCpuHugePages has to be a power of two not larger than the page size!");
+                    }
+                }
+
+            public:
+                HugePages m_hugePages;
+                std::size_t m_alignmentBytes;
+            };
+
+            namespace traits
+            {
+                //#############################################################################
+                //! The CPU huge page allocator memory allocation trait specialization.
+                //#############################################################################
+                template<
+                    typename T>
+                struct Alloc<
+                    T,
+                    AllocCpuHugePages>
+                {
+                    //-----------------------------------------------------------------------------
+                    //
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST static auto alloc(
+                        AllocCpuHugePages const & alloc,
+                        std::size_t const & sizeElems)
+                    -> T *
+                    {
+                        std::size_t const sizeBytes(sizeElems * sizeof(T));
+#if BOOST_OS_UNIX
+                        using cpu::detail::MappingHeader;
+                        std::size_t const hugePageSizeBytes(cpu::detail::getHugePageSizeBytes());
+                        std::size_t const alignmentBytes(
+                            (alloc.m_alignmentBytes < alignof(MappingHeader)) ? alignof(MappingHeader) : alloc.m_alignmentBytes);
+
+    #if defined(MAP_HUGETLB)
+                        if(alloc.m_hugePages == HugePages::Explicit)
+                        {
+                            // The mapping starts at a huge page boundary, so the header only shifts the memory by one alignment.
+                            std::size_t const offsetBytes(static_cast<std::size_t>(cpu::detail::alignUp(sizeof(MappingHeader), alignmentBytes)));
+                            std::size_t const mappedBytes(static_cast<std::size_t>(cpu::detail::alignUp(offsetBytes + sizeBytes, hugePageSizeBytes)));
+                            void * const pBase(mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0));
+                            if(pBase != MAP_FAILED)
+                            {
+                                return place(pBase, mappedBytes, reinterpret_cast<std::uintptr_t>(pBase) + offsetBytes);
+                            }
+                            // There are not enough reserved huge pages.
+                        }
+    #endif
+                        // Start big allocations at a huge page boundary so that all of their huge pages can be used.
+                        // The mapping is over-allocated by one alignment to make room for the header and the alignment.
+                        std::size_t const dataAlignmentBytes(
+                            ((alloc.m_hugePages != HugePages::None) && (sizeBytes >= hugePageSizeBytes)) ? hugePageSizeBytes : alignmentBytes);
+                        std::size_t const mappedBytes(sizeof(MappingHeader) + dataAlignmentBytes + sizeBytes);
+                        void * const pBase(mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+                        if(pBase == MAP_FAILED)
+                        {
+                            return nullptr;
+                        }
+    #if defined(MADV_HUGEPAGE)
+                        // This is only a hint. If transparent huge pages are disabled the memory is backed by normal pages.
+                        if(alloc.m_hugePages != HugePages::None)
+                        {
+                            madvise(pBase, mappedBytes, MADV_HUGEPAGE);
+                        }
+    #endif
+                        return
+                            place(
+                                pBase,
+                                mappedBytes,
+                                cpu::detail::alignUp(reinterpret_cast<std::uintptr_t>(pBase) + sizeof(MappingHeader), dataAlignmentBytes));
+#else
+                        return
+                            reinterpret_cast<T *>(
+                                boost::alignment::aligned_alloc(alloc.m_alignmentBytes, sizeBytes));
+#endif
+                    }
+
+#if BOOST_OS_UNIX
+                private:
+                    //-----------------------------------------------------------------------------
+                    //! Writes the header in front of the memory.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST static auto place(
+                        void * const pBase,
+                        std::size_t const & mappedBytes,
+                        std::uintptr_t const & address)
+                    -> T *
+                    {
+                        auto * const pHeader(reinterpret_cast<cpu::detail::MappingHeader *>(address - sizeof(cpu::detail::MappingHeader)));
+                        pHeader->m_pBase = pBase;
+                        pHeader->m_mappedBytes = mappedBytes;
+                        return reinterpret_cast<T *>(address);
+                    }
+#endif
+                };
+
+                //#############################################################################
+                //! The CPU huge page allocator memory free trait specialization.
+                //#############################################################################
+                template<
+                    typename T>
+                struct Free<
+                    T,
+                    AllocCpuHugePages>
+                {
+                    //-----------------------------------------------------------------------------
+                    //
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST static auto free(
+                        AllocCpuHugePages const & alloc,
+                        T const * const ptr)
+                    -> void
+                    {
+                        boost::ignore_unused(alloc);
+#if BOOST_OS_UNIX
+                        if(ptr != nullptr)
+                        {
+                            auto const * const pHeader(
+                                reinterpret_cast<cpu::detail::MappingHeader const *>(
+                                    reinterpret_cast<std::uintptr_t>(ptr) - sizeof(cpu::detail::MappingHeader)));
+                            munmap(pHeader->m_pBase, pHeader->m_mappedBytes);
+                        }
+#else
+                        boost::alignment::aligned_free(
+                            const_cast<void *>(
+                                reinterpret_cast<void const *>(ptr)));
+#endif
+                    }
+                };
+            }
+        }
+    }
+}
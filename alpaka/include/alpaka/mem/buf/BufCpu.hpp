@@ -22,9 +22,12 @@
 #pragma once
 
 #include <alpaka/dev/Traits.hpp>            // dev::traits::DevType
+#include <alpaka/dev/DevCpu.hpp>            // dev::cpu::detail::ThreadPoolAcquisition
 #include <alpaka/mem/buf/Traits.hpp>        // mem::buf::Alloc, ...
 
 #include <alpaka/vec/Vec.hpp>               // Vec
+#include <alpaka/dev/cpu/Numa.hpp>          // dev::cpu::NumaPolicy
+#include <alpaka/exec/Schedule.hpp>         // exec::Schedule
 
 // \TODO: Remove CUDA inclusion for BufCpu by replacing pinning with non CUDA code!
 #if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) && defined(__CUDACC__)
@@ -32,9 +35,18 @@
 #endif
 
 #include <alpaka/mem/alloc/AllocCpuBoostAligned.hpp>
+#include <alpaka/mem/alloc/AllocCpuCaching.hpp>
+#include <alpaka/mem/alloc/AllocCpuHugePages.hpp>
 
+#include <algorithm>                        // std::min, std::max
 #include <cassert>                          // assert
+#include <cstddef>                          // std::size_t
+#include <cstdint>                          // std::uint8_t, std::uintptr_t
 #include <memory>                           // std::shared_ptr
+#include <thread>                           // std::thread::hardware_concurrency
+#include <type_traits>                      // std::enable_if
+#include <vector>                           // std::vector
+#include <stdexcept>                        // std::invalid_argument
 
 namespace alpaka
 {
@@ -48,19 +60,70 @@ namespace alpaka
         {
             namespace cpu
             {
+                //! The size of a cache line in bytes. This is the alignment of all heap allocated CPU buffers and their maximum row alignment.
+                static constexpr std::size_t cacheLineBytes = 64u;
+
                 namespace detail
                 {
+                    //-----------------------------------------------------------------------------
+                    //! \return The allocator of the buffer memory cache of the device or an allocator without cache if caching is disabled.
+                    //!
+                    //! This is a template because the device is an incomplete type here.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TDev>
+                    ALPAKA_FN_HOST auto getAllocCaching(
+                        TDev const & dev)
+                    -> mem::alloc::AllocCpuCaching
+                    {
+                        auto const & spBufCache(dev.m_spDevCpuImpl->getBufCache());
+                        return mem::alloc::AllocCpuCaching(spBufCache->isEnabled() ? spBufCache : nullptr);
+                    }
+
                     //#############################################################################
                     //! The CPU memory buffer.
+                    //!
+                    //! The rows of multi-dimensional buffers can be padded so that every row starts at the given alignment.
+                    //! The memory is either allocated cache line aligned on the heap, taken from the buffer cache of the device or mapped with a huge page allocator.
                     //#############################################################################
                     template<
                         typename TElem,
                         typename TDim,
                         typename TSize>
                     class BufCpuImpl :
-                        public mem::alloc::AllocCpuBoostAligned<std::integral_constant<std::size_t, 16u>>
+                        public mem::alloc::AllocCpuBoostAligned<std::integral_constant<std::size_t, cacheLineBytes>>
                     {
                     public:
+                        //-----------------------------------------------------------------------------
+                        //! Constructor
+                        //!
+                        //! \param rowAlignmentBytes The alignment of the rows in bytes. It has to be a power of two not larger than cacheLineBytes.
+                        //!  The default of 1 keeps the rows dense.
+                        //-----------------------------------------------------------------------------
+                        template<
+                            typename TExtents>
+                        ALPAKA_FN_HOST BufCpuImpl(
+                            dev::DevCpu const & dev,
+                            TExtents const & extents,
+                            std::size_t const & rowAlignmentBytes = 1u) :
+                                BufCpuImpl(dev, extents, rowAlignmentBytes, false, mem::alloc::AllocCpuHugePages())
+                        {}
+                        //-----------------------------------------------------------------------------
+                        //! Constructor
+                        //!
+                        //! \param rowAlignmentBytes The alignment of the rows in bytes. It has to be a power of two not larger than the alignment of the allocator.
+                        //! \param allocHugePages The allocator mapping the memory.
+                        //-----------------------------------------------------------------------------
+                        template<
+                            typename TExtents>
+                        ALPAKA_FN_HOST BufCpuImpl(
+                            dev::DevCpu const & dev,
+                            TExtents const & extents,
+                            std::size_t const & rowAlignmentBytes,
+                            mem::alloc::AllocCpuHugePages const & allocHugePages) :
+                                BufCpuImpl(dev, extents, rowAlignmentBytes, true, allocHugePages)
+                        {}
+                    private:
                         //-----------------------------------------------------------------------------
                         //! Constructor
                         //-----------------------------------------------------------------------------
@@ -68,12 +131,18 @@ namespace alpaka
                             typename TExtents>
                         ALPAKA_FN_HOST BufCpuImpl(
                             dev::DevCpu const & dev,
-                            TExtents const & extents) :
-                                mem::alloc::AllocCpuBoostAligned<std::integral_constant<std::size_t, 16u>>(),
+                            TExtents const & extents,
+                            std::size_t const & rowAlignmentBytes,
+                            bool const & bHugePages,
+                            mem::alloc::AllocCpuHugePages const & allocHugePages) :
+                                mem::alloc::AllocCpuBoostAligned<std::integral_constant<std::size_t, cacheLineBytes>>(),
                                 m_dev(dev),
                                 m_extentsElements(extent::getExtentsVecEnd<TDim>(extents)),
-                                m_pMem(mem::alloc::alloc<TElem>(*this, computeElementCount(extents))),
-                                m_pitchBytes(static_cast<TSize>(extent::getWidth(extents) * sizeof(TElem)))
+                                m_bHugePages(bHugePages),
+                                m_allocHugePages(allocHugePages),
+                                m_allocCaching(bHugePages ? mem::alloc::AllocCpuCaching(nullptr) : getAllocCaching(dev)),
+                                m_pitchBytes(computePitchBytes(extents, rowAlignmentBytes, getBaseAlignmentBytes())),
+                                m_pMem(allocMem(computeElementCount(extents, m_pitchBytes)))
 #if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) && defined(__CUDACC__)
                                 ,m_bPinned(false)
 #endif
@@ -92,9 +161,12 @@ namespace alpaka
                                 << " e: " << m_extentsElements
                                 << " ptr: " << static_cast<void *>(m_pMem)
                                 << " pitch: " << m_pitchBytes
+                                << " hugePages: " << m_bHugePages
+                                << " cached: " << static_cast<bool>(m_allocCaching.m_spCache)
                                 << std::endl;
 #endif
                         }
+                    public:
                         //-----------------------------------------------------------------------------
                         //! Copy constructor.
                         //-----------------------------------------------------------------------------
@@ -123,30 +195,131 @@ namespace alpaka
                             mem::buf::unpin(*this);
 #endif
                             // NOTE: m_pMem is allowed to be a nullptr here.
-                            mem::alloc::free(*this, m_pMem);
+                            if(m_bHugePages)
+                            {
+                                mem::alloc::free(m_allocHugePages, m_pMem);
+                            }
+                            else if(m_allocCaching.m_spCache)
+                            {
+                                mem::alloc::free(m_allocCaching, m_pMem);
+                            }
+                            else
+                            {
+                                mem::alloc::free(*this, m_pMem);
+                            }
+                        }
+
+                        //-----------------------------------------------------------------------------
+                        //! \return The number of bytes allocated for the buffer including the padding of the rows.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto getAllocatedBytes() const
+                        -> std::size_t
+                        {
+                            return static_cast<std::size_t>(m_pitchBytes) * static_cast<std::size_t>(getRowCount(m_extentsElements));
+                        }
+
+                        //-----------------------------------------------------------------------------
+                        //! \return The alignment of the start of the memory in bytes.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto getBaseAlignmentBytes() const
+                        -> std::size_t
+                        {
+                            return m_bHugePages ? m_allocHugePages.m_alignmentBytes : cacheLineBytes;
                         }
 
                     private:
+                        //-----------------------------------------------------------------------------
+                        //! \return The number of rows of the buffer. One dimensional buffers consist of a single row.
+                        //-----------------------------------------------------------------------------
+                        template<
+                            typename TExtents>
+                        ALPAKA_FN_HOST static auto getRowCount(
+                            TExtents const & extents)
+                        -> TSize
+                        {
+                            auto const width(static_cast<TSize>(extent::getWidth(extents)));
+                            return (width > 0u) ? static_cast<TSize>(extent::getProductOfExtents(extents) / width) : static_cast<TSize>(0u);
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! \return The distance between two rows in bytes.
+                        //!
+                        //! The row size is rounded up to a multiple of the alignment and of the element size, so the pitch is always a whole number of elements.
+                        //! One dimensional buffers are never padded.
+                        //-----------------------------------------------------------------------------
+                        template<
+                            typename TExtents>
+                        ALPAKA_FN_HOST static auto computePitchBytes(
+                            TExtents const & extents,
+                            std::size_t const & rowAlignmentBytes,
+                            std::size_t const & baseAlignmentBytes)
+                        -> TSize
+                        {
+                            if((rowAlignmentBytes == 0u) || ((rowAlignmentBytes & (rowAlignmentBytes - 1u)) != 0u) || (rowAlignmentBytes > baseAlignmentBytes))
+                            {
+                                throw std::invalid_argument("The row alignment of a BufCpu has to be a power of two not larger than the alignment of its memory!");
+                            }
+
+                            std::size_t const widthBytes(static_cast<std::size_t>(extent::getWidth(extents)) * sizeof(TElem));
+                            if(TDim::value == 1u)
+                            {
+                                return static_cast<TSize>(widthBytes);
+                            }
+
+                            // The least common multiple of the alignment and the element size.
+                            std::size_t gcd(rowAlignmentBytes);
+                            for(std::size_t rem(sizeof(TElem) % gcd); rem != 0u;)
+                            {
+                                std::size_t const next(gcd % rem);
+                                gcd = rem;
+                                rem = next;
+                            }
+                            std::size_t const granularityBytes(rowAlignmentBytes / gcd * sizeof(TElem));
+
+                            return static_cast<TSize>(((widthBytes + granularityBytes - 1u) / granularityBytes) * granularityBytes);
+                        }
                         //-----------------------------------------------------------------------------
                         //! \return The number of elements to allocate.
                         //-----------------------------------------------------------------------------
                         template<
                             typename TExtents>
                         ALPAKA_FN_HOST static auto computeElementCount(
-                            TExtents const & extents)
+                            TExtents const & extents,
+                            TSize const & pitchBytes)
                         -> TSize
                         {
-                            auto const extentsElementCount(extent::getProductOfExtents(extents));
-                            assert(extentsElementCount>0);
+                            assert(extent::getProductOfExtents(extents)>0);
 
-                            return extentsElementCount;
+                            return static_cast<TSize>(pitchBytes / sizeof(TElem)) * getRowCount(extents);
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! \return The pointer to the allocated memory.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto allocMem(
+                            TSize const & sizeElems)
+                        -> TElem *
+                        {
+                            if(m_bHugePages)
+                            {
+                                return mem::alloc::alloc<TElem>(m_allocHugePages, static_cast<std::size_t>(sizeElems));
+                            }
+                            else if(m_allocCaching.m_spCache)
+                            {
+                                return mem::alloc::alloc<TElem>(m_allocCaching, static_cast<std::size_t>(sizeElems));
+                            }
+                            else
+                            {
+                                return mem::alloc::alloc<TElem>(*this, static_cast<std::size_t>(sizeElems));
+                            }
                         }
 
                     public:
                         dev::DevCpu const m_dev;
                         Vec<TDim, TSize> const m_extentsElements;
-                        TElem * const m_pMem;
+                        bool const m_bHugePages;
+                        mem::alloc::AllocCpuHugePages const m_allocHugePages;
+                        mem::alloc::AllocCpuCaching const m_allocCaching;   //!< Only references a cache if the memory is taken from it.
                         TSize const m_pitchBytes;
+                        TElem * const m_pMem;
 #if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) && defined(__CUDACC__)
                         bool m_bPinned;
 #endif
@@ -165,13 +338,35 @@ namespace alpaka
             public:
                 //-----------------------------------------------------------------------------
                 //! Constructor
+                //!
+                //! \param rowAlignmentBytes The alignment of the rows of multi-dimensional buffers in bytes.
+                //!  It has to be a power of two not larger than cpu::cacheLineBytes. The default of 1 keeps the rows dense.
+                //!  Aligned rows avoid cache lines split between rows and unaligned vector loads in row-wise kernels.
+                //!  All copies, sets and views honour the resulting pitch.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtents>
+                ALPAKA_FN_HOST BufCpu(
+                    dev::DevCpu const & dev,
+                    TExtents const & extents,
+                    std::size_t const & rowAlignmentBytes = 1u) :
+                        m_spBufCpuImpl(std::make_shared<cpu::detail::BufCpuImpl<TElem, TDim, TSize>>(dev, extents, rowAlignmentBytes))
+                {}
+                //-----------------------------------------------------------------------------
+                //! Constructor
+                //!
+                //! \param rowAlignmentBytes The alignment of the rows of multi-dimensional buffers in bytes.
+                //!  It has to be a power of two not larger than the alignment of the allocator.
+                //! \param allocHugePages The allocator mapping the memory. Its alignment can be up to the page size.
                 //-----------------------------------------------------------------------------
                 template<
                     typename TExtents>
                 ALPAKA_FN_HOST BufCpu(
                     dev::DevCpu const & dev,
-                    TExtents const & extents) :
-                        m_spBufCpuImpl(std::make_shared<cpu::detail::BufCpuImpl<TElem, TDim, TSize>>(dev, extents))
+                    TExtents const & extents,
+                    std::size_t const & rowAlignmentBytes,
+                    mem::alloc::AllocCpuHugePages const & allocHugePages) :
+                        m_spBufCpuImpl(std::make_shared<cpu::detail::BufCpuImpl<TElem, TDim, TSize>>(dev, extents, rowAlignmentBytes, allocHugePages))
                 {}
                 //-----------------------------------------------------------------------------
                 //! Copy constructor.
@@ -193,6 +388,229 @@ namespace alpaka
             public:
                 std::shared_ptr<cpu::detail::BufCpuImpl<TElem, TDim, TSize>> m_spBufCpuImpl;
             };
+
+            namespace cpu
+            {
+                //-----------------------------------------------------------------------------
+                //! Allocates a buffer whose rows are padded to the given alignment.
+                //!
+                //! \tparam TElem The element type of the buffer.
+                //! \tparam TSize The size type of the buffer.
+                //! \param rowAlignmentBytes The alignment of the rows in bytes. A power of two not larger than cacheLineBytes.
+                //!  Use the SIMD register width to only avoid unaligned vector loads.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TElem,
+                    typename TSize,
+                    typename TExtents>
+                ALPAKA_FN_HOST auto allocPitched(
+                    dev::DevCpu const & dev,
+                    TExtents const & extents,
+                    std::size_t const & rowAlignmentBytes = cacheLineBytes)
+                -> BufCpu<TElem, dim::Dim<TExtents>, TSize>
+                {
+                    ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                    return
+                        BufCpu<TElem, dim::Dim<TExtents>, TSize>(
+                            dev,
+                            extents,
+                            rowAlignmentBytes);
+                }
+                //-----------------------------------------------------------------------------
+                //! Allocates a buffer backed by huge pages.
+                //!
+                //! This is worth it for buffers of many megabytes that would otherwise take a page fault per page and many TLB misses.
+                //! If the requested kind of huge pages is not available the buffer falls back to normal pages.
+                //!
+                //! \tparam TElem The element type of the buffer.
+                //! \tparam TSize The size type of the buffer.
+                //! \param alignmentBytes The alignment of the memory in bytes. A power of two not larger than the page size.
+                //! \param rowAlignmentBytes The alignment of the rows in bytes. A power of two not larger than alignmentBytes.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TElem,
+                    typename TSize,
+                    typename TExtents>
+                ALPAKA_FN_HOST auto allocHugePages(
+                    dev::DevCpu const & dev,
+                    TExtents const & extents,
+                    mem::alloc::HugePages const & hugePages = mem::alloc::HugePages::Transparent,
+                    std::size_t const & alignmentBytes = mem::alloc::cpu::detail::getPageSizeBytes(),
+                    std::size_t const & rowAlignmentBytes = 1u)
+                -> BufCpu<TElem, dim::Dim<TExtents>, TSize>
+                {
+                    ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                    return
+                        BufCpu<TElem, dim::Dim<TExtents>, TSize>(
+                            dev,
+                            extents,
+                            rowAlignmentBytes,
+                            mem::alloc::AllocCpuHugePages(hugePages, alignmentBytes));
+                }
+
+                namespace detail
+                {
+                    //-----------------------------------------------------------------------------
+                    //! Touches the memory page by page with the workers of the device thread pool.
+                    //!
+                    //! The memory is split into units that are distributed onto the workers like grid blocks by the block parallel executors.
+                    //! This is a template because the device is an incomplete type here.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TDev>
+                    ALPAKA_FN_HOST auto firstTouchParallel(
+                        TDev const & dev,
+                        std::uint8_t * const pMem,
+                        std::size_t const & unitCount,
+                        std::size_t const & unitBytes,
+                        exec::Schedule const & schedule,
+                        std::size_t const & numWorkersMax)
+                    -> void
+                    {
+                        std::size_t const numWorkers(std::max(std::min(unitCount, numWorkersMax), static_cast<std::size_t>(1u)));
+                        exec::detail::BlockScheduler<std::size_t> scheduler(schedule, unitCount, numWorkers);
+                        std::uintptr_t const pageSizeBytes(static_cast<std::uintptr_t>(mem::alloc::cpu::detail::getPageSizeBytes()));
+
+                        auto const workerFn(
+                            [&scheduler, pMem, unitBytes, pageSizeBytes](
+                                std::size_t const & worker)
+                            {
+                                std::size_t begin;
+                                std::size_t end;
+                                while(scheduler.getNextRange(worker, begin, end))
+                                {
+                                    // One write per page places it.
+                                    std::uintptr_t const addressEnd(reinterpret_cast<std::uintptr_t>(pMem + end * unitBytes));
+                                    for(std::uintptr_t address(reinterpret_cast<std::uintptr_t>(pMem + begin * unitBytes));
+                                        address < addressEnd;
+                                        address = (address & ~(pageSizeBytes - 1u)) + pageSizeBytes)
+                                    {
+                                        *reinterpret_cast<std::uint8_t *>(address) = 0u;
+                                    }
+                                }
+                            });
+
+                        // The first worker is the calling thread, all others are taken from the device thread pool.
+                        std::size_t const numPoolWorkers(numWorkers - 1u);
+                        dev::cpu::detail::ThreadPoolAcquisition const threadPoolAcquisition(*dev.m_spDevCpuImpl, numPoolWorkers);
+                        auto & threadPool(threadPoolAcquisition.getThreadPool());
+
+                        dev::cpu::detail::DevCpuImpl::ThreadPool::TaskGroup workers;
+                        try
+                        {
+                            for(std::size_t worker(1u); worker < numWorkers; ++worker)
+                            {
+                                threadPool.enqueueTaskNoFuture(
+                                    [&workerFn, worker]()
+                                    {
+                                        workerFn(worker);
+                                    },
+                                    &workers);
+                            }
+                            workerFn(static_cast<std::size_t>(0u));
+                        }
+                        catch(...)
+                        {
+                            // The other workers reference the scheduler and the touch function on this stack.
+                            workers.wait();
+                            throw;
+                        }
+
+                        workers.wait();
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return The number of pages of the buffer placed on each NUMA node, indexed by node.
+                //!  Pages that have not been touched yet are not counted. The vector is empty if the placement can not be queried.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TElem,
+                    typename TDim,
+                    typename TSize>
+                ALPAKA_FN_HOST auto getPageNodeCounts(
+                    BufCpu<TElem, TDim, TSize> const & buf)
+                -> std::vector<std::size_t>
+                {
+                    return
+                        dev::cpu::detail::getPageNodeCounts(
+                            buf.m_spBufCpuImpl->m_pMem,
+                            buf.m_spBufCpuImpl->getAllocatedBytes());
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Allocates a buffer whose pages are placed onto the NUMA nodes before it is returned.
+                //!
+                //! Memory is placed on the node of the thread touching it first, so a buffer initialized by a single thread ends up on a single node
+                //! and the workers on all other nodes access it remotely. This buffer is touched by the workers of the device thread pool instead.
+                //! The rows, or the elements of one dimensional buffers, are distributed onto the workers with the given schedule like
+                //! grid blocks by the block parallel executors. With the same schedule and one block per row or element each worker then finds its part of the
+                //! buffer local. Alternatively the pages can be interleaved over or bound to the given nodes where mbind is available.
+                //! The memory is mapped separately with normal pages so that the placement is not shared with other allocations.
+                //!
+                //! \tparam TElem The element type of the buffer.
+                //! \tparam TSize The size type of the buffer.
+                //! \param nodeMask The nodes used by Interleave and Bind with one bit per node. A mask of 0 selects all online nodes.
+                //! \param schedule The schedule of the first touch. Only the Static schedule yields a deterministic placement.
+                //! \param numWorkers The number of workers touching the buffer. This defaults to the number of workers the executors use.
+                //! \param rowAlignmentBytes The alignment of the rows in bytes. A power of two not larger than the page size.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TElem,
+                    typename TSize,
+                    typename TExtents>
+                ALPAKA_FN_HOST auto allocNuma(
+                    dev::DevCpu const & dev,
+                    TExtents const & extents,
+                    dev::cpu::NumaPolicy const & policy = dev::cpu::NumaPolicy::FirstTouch,
+                    unsigned long const & nodeMask = 0u,
+                    exec::Schedule const & schedule = exec::Schedule(exec::ScheduleKind::Static),
+                    std::size_t const & numWorkers = std::max(std::thread::hardware_concurrency(), 1u),
+                    std::size_t const & rowAlignmentBytes = 1u)
+                -> BufCpu<TElem, dim::Dim<TExtents>, TSize>
+                {
+                    ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                    BufCpu<TElem, dim::Dim<TExtents>, TSize> buf(
+                        dev,
+                        extents,
+                        rowAlignmentBytes,
+                        mem::alloc::AllocCpuHugePages(mem::alloc::HugePages::None));
+
+                    auto & bufImpl(*buf.m_spBufCpuImpl);
+                    std::size_t const sizeBytes(bufImpl.getAllocatedBytes());
+
+                    // The policy has to be set before the pages are touched.
+                    bool const bPolicySet(dev::cpu::detail::setNumaPolicy(bufImpl.m_pMem, sizeBytes, policy, nodeMask));
+
+                    std::size_t const unitBytes((dim::Dim<TExtents>::value == 1u) ? sizeof(TElem) : static_cast<std::size_t>(bufImpl.m_pitchBytes));
+                    detail::firstTouchParallel(
+                        dev,
+                        reinterpret_cast<std::uint8_t *>(bufImpl.m_pMem),
+                        (unitBytes > 0u) ? (sizeBytes / unitBytes) : static_cast<std::size_t>(0u),
+                        unitBytes,
+                        schedule,
+                        numWorkers);
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+                    std::cout << BOOST_CURRENT_FUNCTION
+                        << " policy: " << static_cast<int>(policy)
+                        << (bPolicySet ? "" : " (not supported, first touch is used)")
+                        << " pages per node:";
+                    for(std::size_t const pageCount : getPageNodeCounts(buf))
+                    {
+                        std::cout << " " << pageCount;
+                    }
+                    std::cout << std::endl;
+#else
+                    boost::ignore_unused(bPolicySet);
+#endif
+
+                    return buf;
+                }
+            }
         }
     }
 
@@ -411,14 +829,18 @@ namespace alpaka
                 };
                 //#############################################################################
                 //! The BufCpu pitch get trait specialization.
+                //!
+                //! The pitches of the higher dimensions are multiples of the possibly padded row pitch.
                 //#############################################################################
                 template<
+                    typename TIdx,
                     typename TElem,
                     typename TDim,
                     typename TSize>
                 struct GetPitchBytes<
-                    dim::DimInt<TDim::value - 1u>,
-                    mem::buf::BufCpu<TElem, TDim, TSize>>
+                    TIdx,
+                    mem::buf::BufCpu<TElem, TDim, TSize>,
+                    typename std::enable_if<(TIdx::value < TDim::value)>::type>
                 {
                     //-----------------------------------------------------------------------------
                     //!
@@ -427,7 +849,12 @@ namespace alpaka
                         mem::buf::BufCpu<TElem, TDim, TSize> const & pitch)
                     -> TSize
                     {
-                        return pitch.m_spBufCpuImpl->m_pitchBytes;
+                        auto pitchBytes(pitch.m_spBufCpuImpl->m_pitchBytes);
+                        for(auto i(TIdx::value); i + 1u < TDim::value; ++i)
+                        {
+                            pitchBytes *= pitch.m_spBufCpuImpl->m_extentsElements[i];
+                        }
+                        return pitchBytes;
                     }
                 };
             }
@@ -554,7 +981,7 @@ namespace alpaka
                             ALPAKA_CUDA_RT_CHECK_IGNORE(
                                 cudaHostRegister(
                                     const_cast<void *>(reinterpret_cast<void const *>(mem::view::getPtrNative(buf))),
-                                    extent::getProductOfExtents(buf) * sizeof(elem::Elem<buf::BufCpu<TElem, TDim, TSize>>),
+                                    buf.m_spBufCpuImpl->getAllocatedBytes(),
                                     cudaHostRegisterDefault),
                                 cudaErrorHostMemoryAlreadyRegistered);
 
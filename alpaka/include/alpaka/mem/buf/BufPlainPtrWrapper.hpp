@@ -25,6 +25,8 @@
 
 #include <alpaka/vec/Vec.hpp>           // Vec<N>
 
+#include <type_traits>          // std::enable_if
+
 namespace alpaka
 {
     namespace mem
@@ -291,22 +293,31 @@ namespace alpaka
 
                 //#############################################################################
                 //! The BufPlainPtrWrapper memory pitch get trait specialization.
+                //!
+                //! The slice pitches are multiples of the row pitch so that padded rows are honoured in every dimension.
                 //#############################################################################
                 template<
+                    typename TIdx,
                     typename TDev,
                     typename TElem,
                     typename TDim,
                     typename TSize>
                 struct GetPitchBytes<
-                    dim::DimInt<TDim::value - 1u>,
-                    mem::buf::BufPlainPtrWrapper<TDev, TElem, TDim, TSize>>
+                    TIdx,
+                    mem::buf::BufPlainPtrWrapper<TDev, TElem, TDim, TSize>,
+                    typename std::enable_if<(TIdx::value < TDim::value)>::type>
                 {
                     ALPAKA_NO_HOST_ACC_WARNING
                     ALPAKA_FN_HOST_ACC static auto getPitchBytes(
                         mem::buf::BufPlainPtrWrapper<TDev, TElem, TDim, TSize> const & buf)
                     -> TSize
                     {
-                        return buf.m_pitchBytes;
+                        TSize pitchBytes(buf.m_pitchBytes);
+                        for(auto i(TIdx::value); i + 1u < TDim::value; ++i)
+                        {
+                            pitchBytes *= buf.m_extentsElements[i];
+                        }
+                        return pitchBytes;
                     }
                 };
             }
@@ -25,10 +25,24 @@
 #include <alpaka/extent/Traits.hpp>         // extent::getXXX
 #include <alpaka/mem/view/Traits.hpp>       // mem::view::Copy, ...
 #include <alpaka/stream/StreamCpuAsync.hpp> // stream::StreamCpuAsync
+#include <alpaka/stream/StreamCpuParallel.hpp>  // stream::traits::GetMemAccesses
 #include <alpaka/stream/StreamCpuSync.hpp>  // stream::StreamCpuSync
+#include <alpaka/exec/Schedule.hpp>         // exec::detail::BlockScheduler
 
+#include <boost/predef.h>                   // BOOST_ARCH_X86
+#include <boost/core/ignore_unused.hpp>     // boost::ignore_unused
+
+#if BOOST_ARCH_X86 && defined(__SSE2__)
+    #include <emmintrin.h>                  // _mm_stream_si128, _mm_sfence
+#endif
+
+#include <algorithm>                        // std::min, std::max
 #include <cassert>                          // assert
+#include <chrono>                           // std::chrono::high_resolution_clock
+#include <cstddef>                          // std::size_t
+#include <cstdint>                          // std::uint8_t, std::uintptr_t
 #include <cstring>                          // std::memcpy
+#include <thread>                           // std::thread::hardware_concurrency
 
 namespace alpaka
 {
@@ -46,14 +60,81 @@ namespace alpaka
         {
             namespace cpu
             {
+                //! Copies are only split across workers if every worker gets at least this many bytes. Smaller parts do not amortize the hand-over.
+                static constexpr std::size_t copyBytesPerWorkerMin = 1u << 20u;
+                //! The default size from which on copies use non-temporal stores. It is above the size of the last level cache of most CPUs.
+                static constexpr std::size_t copyNonTemporalThresholdBytes = 1u << 25u;
+
                 namespace detail
                 {
+                    //-----------------------------------------------------------------------------
+                    //! \return The default number of workers of a copy. This is the number of workers the executors use.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getCopyWorkerCountDefault()
+                    -> std::size_t
+                    {
+                        static std::size_t const workerCount(std::max(std::thread::hardware_concurrency(), 1u));
+                        return workerCount;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Copies the bytes.
+                    //!
+                    //! Non-temporal stores write around the caches, so a big copy neither evicts the working set nor reads the destination before overwriting it.
+                    //! They have to be followed by fenceNonTemporalStores before another thread may read the destination.
+                    //! They are only used for whole cache lines of pieces of at least a page because partially written lines are slow.
+                    //! Without SSE2 this always uses std::memcpy.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto copyBytes(
+                        std::uint8_t * pDst,
+                        std::uint8_t const * pSrc,
+                        std::size_t sizeBytes,
+                        bool const & bNonTemporal)
+                    -> void
+                    {
+#if BOOST_ARCH_X86 && defined(__SSE2__)
+                        if(bNonTemporal && (sizeBytes >= 4096u))
+                        {
+                            // Copy up to the next cache line boundary of the destination conventionally.
+                            std::size_t const headBytes((64u - (reinterpret_cast<std::uintptr_t>(pDst) & 63u)) & 63u);
+                            std::memcpy(pDst, pSrc, headBytes);
+                            pDst += headBytes;
+                            pSrc += headBytes;
+                            sizeBytes -= headBytes;
+
+                            for(; sizeBytes >= 64u; sizeBytes -= 64u, pDst += 64u, pSrc += 64u)
+                            {
+                                __m128i const v0(_mm_loadu_si128(reinterpret_cast<__m128i const *>(pSrc)));
+                                __m128i const v1(_mm_loadu_si128(reinterpret_cast<__m128i const *>(pSrc + 16u)));
+                                __m128i const v2(_mm_loadu_si128(reinterpret_cast<__m128i const *>(pSrc + 32u)));
+                                __m128i const v3(_mm_loadu_si128(reinterpret_cast<__m128i const *>(pSrc + 48u)));
+                                _mm_stream_si128(reinterpret_cast<__m128i *>(pDst), v0);
+                                _mm_stream_si128(reinterpret_cast<__m128i *>(pDst + 16u), v1);
+                                _mm_stream_si128(reinterpret_cast<__m128i *>(pDst + 32u), v2);
+                                _mm_stream_si128(reinterpret_cast<__m128i *>(pDst + 48u), v3);
+                            }
+                        }
+#else
+                        boost::ignore_unused(bNonTemporal);
+#endif
+                        std::memcpy(pDst, pSrc, sizeBytes);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Orders the non-temporal stores of the calling thread before all following stores.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto fenceNonTemporalStores()
+                    -> void
+                    {
+#if BOOST_ARCH_X86 && defined(__SSE2__)
+                        _mm_sfence();
+#endif
+                    }
+
                     //#############################################################################
                     //! The CPU device memory copy task.
                     //!
                     //! Copies from CPU memory into CPU memory.
-                    //!
-                    //! TODO: Specialize for different dimensionalities to optimize.
+                    //! Big copies are split by bytes, slices or rows across the device thread pool because a single core can not saturate the memory bandwidth.
+                    //! Copies of at least the non-temporal threshold use streaming stores.
                     //#############################################################################
                     template<
                         typename TBufDst,
@@ -103,7 +184,10 @@ namespace alpaka
                                 m_srcPitchBytes(static_cast<Size>(mem::view::getPitchBytes<dim::Dim<TBufSrc>::value - 1u>(bufSrc))),
 
                                 m_dstMemNative(reinterpret_cast<std::uint8_t *>(mem::view::getPtrNative(bufDst))),
-                                m_srcMemNative(reinterpret_cast<std::uint8_t const *>(mem::view::getPtrNative(bufSrc)))
+                                m_srcMemNative(reinterpret_cast<std::uint8_t const *>(mem::view::getPtrNative(bufSrc))),
+
+                                m_maxWorkerCount(0u),
+                                m_nonTemporalThresholdBytes(copyNonTemporalThresholdBytes)
                         {
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
                             assert(m_extentWidth <= m_dstWidth);
@@ -117,6 +201,27 @@ namespace alpaka
 #endif
                         }
 
+                        //-----------------------------------------------------------------------------
+                        //! Sets the maximum number of threads copying at the same time. A count of 1 copies on the executing thread only.
+                        //! A count of 0 selects the number of workers the executors use, which is the default.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto setMaxWorkerCount(
+                            std::size_t const & maxWorkerCount)
+                        -> void
+                        {
+                            m_maxWorkerCount = maxWorkerCount;
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! Sets the size of the copied bytes from which on non-temporal stores are used.
+                        //! The default is copyNonTemporalThresholdBytes. Copies whose destination is read again soon should not bypass the caches.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto setNonTemporalThresholdBytes(
+                            std::size_t const & nonTemporalThresholdBytes)
+                        -> void
+                        {
+                            m_nonTemporalThresholdBytes = nonTemporalThresholdBytes;
+                        }
+
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
                         //-----------------------------------------------------------------------------
                         //!
@@ -154,8 +259,9 @@ namespace alpaka
                         {
                             ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
 
-                            auto const dstSliceSizeBytes(m_dstPitchBytes * m_dstHeight);
-                            auto const srcSliceSizeBytes(m_srcPitchBytes * m_srcHeight);
+                            // The slices of views into higher dimensional buffers are as far apart as the slices of the buffers.
+                            auto const dstSliceSizeBytes(m_dstPitchBytes * m_dstBufHeight);
+                            auto const srcSliceSizeBytes(m_srcPitchBytes * m_srcBufHeight);
 
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
                             printDebug();
@@ -188,38 +294,145 @@ namespace alpaka
                                 && (dstSliceSizeBytes == srcSliceSizeBytes)
                                 && copySliceAtOnce);
 
+                            std::size_t const copiedBytes(static_cast<std::size_t>(m_extentWidthBytes * m_extentHeight * m_extentDepth));
+                            bool const bNonTemporal(copiedBytes >= m_nonTemporalThresholdBytes);
+                            std::size_t const numWorkers(
+                                (copiedBytes < 2u * copyBytesPerWorkerMin)
+                                ? static_cast<std::size_t>(1u)
+                                : std::min(
+                                    (m_maxWorkerCount == 0u) ? getCopyWorkerCountDefault() : m_maxWorkerCount,
+                                    copiedBytes / copyBytesPerWorkerMin));
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+                            auto const tpStart(std::chrono::high_resolution_clock::now());
+#endif
                             if(copyAllAtOnce)
                             {
-                                std::memcpy(
-                                    reinterpret_cast<void *>(m_dstMemNative),
-                                    reinterpret_cast<void const *>(m_srcMemNative),
-                                    dstSliceSizeBytes*m_extentDepth);
+                                // Split the memory into equally sized byte ranges.
+                                copyRanges(
+                                    static_cast<std::size_t>(dstSliceSizeBytes * m_extentDepth),
+                                    numWorkers,
+                                    bNonTemporal,
+                                    [this, bNonTemporal](std::size_t const & begin, std::size_t const & end)
+                                    {
+                                        copyBytes(m_dstMemNative + begin, m_srcMemNative + begin, end - begin, bNonTemporal);
+                                    });
                             }
                             else
                             {
-                                for(auto z(decltype(m_extentDepth)(0)); z < m_extentDepth; ++z)
+                                // Split the rows of all slices into equally sized ranges.
+                                copyRanges(
+                                    static_cast<std::size_t>(m_extentHeight * m_extentDepth),
+                                    numWorkers,
+                                    bNonTemporal,
+                                    [this, bNonTemporal, copySliceAtOnce, dstSliceSizeBytes, srcSliceSizeBytes](std::size_t const & begin, std::size_t const & end)
+                                    {
+                                        for(std::size_t row(begin); row < end;)
+                                        {
+                                            auto const z(static_cast<Size>(row / static_cast<std::size_t>(m_extentHeight)));
+                                            auto const y(static_cast<Size>(row % static_cast<std::size_t>(m_extentHeight)));
+                                            // The rows of a slice with equal pitches are contiguous and can be copied at once.
+                                            auto const rowCount(
+                                                copySliceAtOnce
+                                                ? std::min(static_cast<std::size_t>(m_extentHeight - y), end - row)
+                                                : static_cast<std::size_t>(1u));
+                                            copyBytes(
+                                                m_dstMemNative + y*m_dstPitchBytes + z*dstSliceSizeBytes,
+                                                m_srcMemNative + y*m_srcPitchBytes + z*srcSliceSizeBytes,
+                                                copySliceAtOnce ? (rowCount * m_dstPitchBytes) : m_extentWidthBytes,
+                                                bNonTemporal);
+                                            row += rowCount;
+                                        }
+                                    });
+                            }
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+                            double const seconds(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - tpStart).count());
+                            std::cout << BOOST_CURRENT_FUNCTION
+                                << " bytes: " << copiedBytes
+                                << " workers: " << numWorkers
+                                << " nonTemporal: " << bNonTemporal
+                                << " GB/s: " << ((seconds > 0.0) ? (static_cast<double>(copiedBytes) / seconds * 1.0e-9) : 0.0)
+                                << std::endl;
+#endif
+                        }
+
+                    private:
+                        //-----------------------------------------------------------------------------
+                        //! Calls the copy function for equally sized contiguous ranges of [0, count), one per worker.
+                        //!
+                        //! The first worker is the executing thread, all others are taken from the device thread pool.
+                        //-----------------------------------------------------------------------------
+                        template<
+                            typename TFnObj>
+                        ALPAKA_FN_HOST static auto copyRanges(
+                            std::size_t const & count,
+                            std::size_t const & numWorkersMax,
+                            bool const & bNonTemporal,
+                            TFnObj const & copyRange)
+                        -> void
+                        {
+                            std::size_t const numWorkers(std::max(std::min(numWorkersMax, count), static_cast<std::size_t>(1u)));
+                            if(numWorkers == 1u)
+                            {
+                                copyRange(static_cast<std::size_t>(0u), count);
+                                if(bNonTemporal)
+                                {
+                                    fenceNonTemporalStores();
+                                }
+                                return;
+                            }
+
+                            exec::detail::BlockScheduler<std::size_t> scheduler(
+                                exec::Schedule(exec::ScheduleKind::Static),
+                                count,
+                                numWorkers);
+                            auto const workerFn(
+                                [&scheduler, &copyRange, bNonTemporal](
+                                    std::size_t const & worker)
                                 {
-                                    if(copySliceAtOnce)
+                                    std::size_t begin;
+                                    std::size_t end;
+                                    while(scheduler.getNextRange(worker, begin, end))
                                     {
-                                        std::memcpy(
-                                            reinterpret_cast<void *>(m_dstMemNative + z*dstSliceSizeBytes),
-                                            reinterpret_cast<void const *>(m_srcMemNative + z*srcSliceSizeBytes),
-                                            m_dstPitchBytes*m_extentHeight);
+                                        copyRange(begin, end);
                                     }
-                                    else
+                                    // The streaming stores have to be visible before the worker reports its completion.
+                                    if(bNonTemporal)
                                     {
-                                        for(auto y((decltype(m_extentHeight)(0))); y < m_extentHeight; ++y)
-                                        {
-                                            std::memcpy(
-                                                reinterpret_cast<void *>(m_dstMemNative + y*m_dstPitchBytes + z*dstSliceSizeBytes),
-                                                reinterpret_cast<void const *>(m_srcMemNative + y*m_srcPitchBytes + z*srcSliceSizeBytes),
-                                                m_extentWidthBytes);
-                                        }
+                                        fenceNonTemporalStores();
                                     }
+                                });
+
+                            auto const dev(dev::cpu::getDev());
+                            std::size_t const numPoolWorkers(numWorkers - 1u);
+                            dev::cpu::detail::ThreadPoolAcquisition const threadPoolAcquisition(*dev.m_spDevCpuImpl, numPoolWorkers);
+                            auto & threadPool(threadPoolAcquisition.getThreadPool());
+
+                            dev::cpu::detail::DevCpuImpl::ThreadPool::TaskGroup workers;
+                            try
+                            {
+                                for(std::size_t worker(1u); worker < numWorkers; ++worker)
+                                {
+                                    threadPool.enqueueTaskNoFuture(
+                                        [&workerFn, worker]()
+                                        {
+                                            workerFn(worker);
+                                        },
+                                        &workers);
                                 }
+                                workerFn(static_cast<std::size_t>(0u));
+                            }
+                            catch(...)
+                            {
+                                // The other workers reference the scheduler and the copy function on this stack.
+                                workers.wait();
+                                throw;
                             }
+
+                            // Wait for the completion of the other workers.
+                            workers.wait();
                         }
 
+                    public:
                         Size m_extentWidth;
                         Size m_extentWidthBytes;
                         Size m_dstWidth;
@@ -243,6 +456,9 @@ namespace alpaka
 
                         std::uint8_t * m_dstMemNative;
                         std::uint8_t const * m_srcMemNative;
+
+                        std::size_t m_maxWorkerCount;               //!< 0 selects the default.
+                        std::size_t m_nonTemporalThresholdBytes;
                     };
                 }
             }
@@ -290,4 +506,37 @@ namespace alpaka
             }
         }
     }
+    namespace stream
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU device memory copy task memory accesses trait specialization.
+            //!
+            //! Only the copied slices are tracked, so copies between disjoint parts of the same buffers can overlap in a parallel stream.
+            //#############################################################################
+            template<
+                typename TBufDst,
+                typename TBufSrc,
+                typename TExtents>
+            struct GetMemAccesses<
+                mem::view::cpu::detail::TaskCopy<TBufDst, TBufSrc, TExtents>>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getMemAccesses(
+                    mem::view::cpu::detail::TaskCopy<TBufDst, TBufSrc, TExtents> const & task,
+                    std::vector<cpu::MemAccess> & vMemAccesses)
+                -> bool
+                {
+                    auto const dstSizeBytes(static_cast<std::size_t>(task.m_dstPitchBytes * task.m_dstBufHeight * task.m_extentDepth));
+                    auto const srcSizeBytes(static_cast<std::size_t>(task.m_srcPitchBytes * task.m_srcBufHeight * task.m_extentDepth));
+                    vMemAccesses.emplace_back(cpu::MemAccess{task.m_dstMemNative, task.m_dstMemNative + dstSizeBytes, true});
+                    vMemAccesses.emplace_back(cpu::MemAccess{task.m_srcMemNative, task.m_srcMemNative + srcSizeBytes, false});
+                    return true;
+                }
+            };
+        }
+    }
 }
@@ -25,6 +25,7 @@
 #include <alpaka/extent/Traits.hpp>         // mem::view::getXXX
 #include <alpaka/mem/view/Traits.hpp>       // mem::view::Set, ...
 #include <alpaka/stream/StreamCpuAsync.hpp> // stream::StreamCpuAsync
+#include <alpaka/stream/StreamCpuParallel.hpp>  // stream::traits::GetMemAccesses
 #include <alpaka/stream/StreamCpuSync.hpp>  // stream::StreamCpuSync
 
 #include <cassert>                          // assert
@@ -97,13 +98,14 @@ namespace alpaka
                             auto const dstPitchBytes(mem::view::getPitchBytes<dim::Dim<TBuf>::value - 1u>(m_buf));
                             assert(extentWidthBytes <= dstPitchBytes);
 
-                            auto const dstNativePtr(reinterpret_cast<std::uint8_t *>(mem::view::getPtrNative(m_buf)));
-                            auto const dstSliceSizeBytes(dstPitchBytes * dstHeight);
-
                             auto const & dstBuf(mem::view::getBuf(m_buf));
                             auto const dstBufWidth(extent::getWidth(dstBuf));
                             auto const dstBufHeight(extent::getHeight(dstBuf));
 
+                            // The slices of views into higher dimensional buffers are as far apart as the slices of the buffer.
+                            auto const dstNativePtr(reinterpret_cast<std::uint8_t *>(mem::view::getPtrNative(m_buf)));
+                            auto const dstSliceSizeBytes(dstPitchBytes * dstBufHeight);
+
                             int iByte(static_cast<int>(m_byte));
 
         #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
@@ -213,4 +215,31 @@ namespace alpaka
             }
         }
     }
+    namespace stream
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU device memory set task memory accesses trait specialization.
+            //#############################################################################
+            template<
+                typename TBuf,
+                typename TExtents>
+            struct GetMemAccesses<
+                mem::view::cpu::detail::TaskSet<TBuf, TExtents>>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getMemAccesses(
+                    mem::view::cpu::detail::TaskSet<TBuf, TExtents> const & task,
+                    std::vector<cpu::MemAccess> & vMemAccesses)
+                -> bool
+                {
+                    vMemAccesses.emplace_back(cpu::memWrite(task.m_buf));
+                    return true;
+                }
+            };
+        }
+    }
 }
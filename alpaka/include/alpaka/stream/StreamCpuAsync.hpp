@@ -25,17 +25,23 @@
 
 #include <alpaka/dev/Traits.hpp>                // dev::GetDev, dev::DevType
 #include <alpaka/event/Traits.hpp>              // event::EventType
+#include <alpaka/graph/GraphCpu.hpp>            // graph::GraphCpu
+#include <alpaka/graph/Traits.hpp>              // graph::traits::GraphType, ...
 #include <alpaka/stream/Traits.hpp>             // stream::traits::Enqueue, ...
 #include <alpaka/wait/Traits.hpp>               // CurrentThreadWaitFor, WaiterWaitFor
 
 #include <alpaka/core/ConcurrentExecPool.hpp>   // core::ConcurrentExecPool
+#include <alpaka/core/RingQueue.hpp>            // core::detail::RingQueue
 
-#include <boost/uuid/uuid.hpp>                  // boost::uuids::uuid
-#include <boost/uuid/uuid_generators.hpp>       // boost::uuids::random_generator
+#include <alpaka/core/UniqueId.hpp>             // core::detail::getNextUniqueId
 
+#include <cstdint>                              // std::uint64_t
 #include <type_traits>                          // std::is_base
-#include <thread>                               // std::thread
+#include <thread>                               // std::thread, std::this_thread::yield
+#include <atomic>                               // std::atomic
 #include <mutex>                                // std::mutex
+#include <memory>                               // std::unique_ptr, std::enable_shared_from_this
+#include <stdexcept>                            // std::runtime_error
 
 namespace alpaka
 {
@@ -55,31 +61,97 @@ namespace alpaka
             {
                 //#############################################################################
                 //! The CPU device stream implementation.
+                //!
+                //! The stream does not own a thread.
+                //! Its tasks are queued in order and drained by the stream thread pool of the device whenever there is work.
+                //! At most one drain of a stream is scheduled or running at any time which keeps the tasks in order.
+                //! A task waiting for an event does not block the draining thread. It suspends the stream and the event resumes it on completion.
                 //#############################################################################
-                class StreamCpuAsyncImpl final
+                class StreamCpuAsyncImpl final :
+                    public std::enable_shared_from_this<StreamCpuAsyncImpl>
                 {
                 private:
                     //#############################################################################
-                    //
+                    //! The task queue. It has no concurrent executors, its tasks are run by drain.
                     //#############################################################################
-                    using ThreadPool = alpaka::core::detail::ConcurrentExecPool<
+                    using TaskQueue = alpaka::core::detail::ConcurrentExecPool<
                         std::size_t,
                         std::thread,                // The concurrent execution type.
                         std::promise,               // The promise type.
                         void,                       // The type yielding the current concurrent execution.
                         std::mutex,                 // The mutex type to use. Only required if TisYielding is true.
                         std::condition_variable,    // The condition variable type to use. Only required if TisYielding is true.
-                        false>;                     // If the threads should yield.
+                        false,                      // If the threads should yield.
+                        core::detail::RingQueue>;   // The fixed capacity task queue.
+
+                    //#############################################################################
+                    //! The state of a suspension by a task waiting for an event.
+                    //#############################################################################
+                    enum class SuspendState
+                    {
+                        None,       //!< The stream is not suspended.
+                        Suspending, //!< The current task has registered a resume but the drain has not stopped yet.
+                        Suspended,  //!< The drain has stopped and waits for the resume.
+                        Resumed,    //!< The resume happened before the drain could stop.
+                    };
+
+                    //! The number of tasks a drain runs before it lets the other streams sharing the stream thread pool run.
+                    static constexpr std::size_t drainTaskCountMax = 64u;
+
+                    //#############################################################################
+                    //! Counts an enqueue as in flight for the lifetime of this object, even if it throws.
+                    //#############################################################################
+                    class EnqueueInFlight final
+                    {
+                    public:
+                        //-----------------------------------------------------------------------------
+                        //! Constructor.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST explicit EnqueueInFlight(
+                            std::atomic<std::size_t> & numEnqueuesInFlight) :
+                                m_numEnqueuesInFlight(numEnqueuesInFlight)
+                        {
+                            m_numEnqueuesInFlight.fetch_add(1u, std::memory_order_seq_cst);
+                        }
+                        //-----------------------------------------------------------------------------
+                        //! Copy constructor.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST EnqueueInFlight(EnqueueInFlight const &) = delete;
+                        //-----------------------------------------------------------------------------
+                        //! Copy assignment operator.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST auto operator=(EnqueueInFlight const &) -> EnqueueInFlight & = delete;
+                        //-----------------------------------------------------------------------------
+                        //! Destructor.
+                        //-----------------------------------------------------------------------------
+                        ALPAKA_FN_HOST ~EnqueueInFlight()
+                        {
+                            m_numEnqueuesInFlight.fetch_sub(1u, std::memory_order_seq_cst);
+                        }
+
+                    private:
+                        std::atomic<std::size_t> & m_numEnqueuesInFlight;
+                    };
 
                 public:
                     //-----------------------------------------------------------------------------
                     //! Constructor.
                     //-----------------------------------------------------------------------------
                     ALPAKA_FN_HOST StreamCpuAsyncImpl(
-                        dev::DevCpu & dev) :
-                            m_uuid(boost::uuids::random_generator()()),
+                        dev::DevCpu & dev,
+                        std::size_t const & queueCapacity,
+                        core::detail::QueueFullPolicy const & queueFullPolicy) :
+                            m_id(core::detail::getNextUniqueId<StreamCpuAsyncImpl>()),
                             m_dev(dev),
-                            m_workerThread(1u, 128u)
+                            m_pRegistrySlot(nullptr),
+                            m_queueCapacity(queueCapacity),
+                            m_queueFullPolicy(queueFullPolicy),
+                            m_taskQueue(0u, queueCapacity, core::detail::IdlePolicy::park(), queueFullPolicy),
+                            m_numEnqueuesInFlight(0u),
+                            m_numTasksEnqueued(0u),
+                            m_numTasksCompleted(0u),
+                            m_numTasksPending(0u),
+                            m_suspendState(SuspendState::None)
                     {}
                     //-----------------------------------------------------------------------------
                     //! Copy constructor.
@@ -88,7 +160,7 @@ namespace alpaka
                     //-----------------------------------------------------------------------------
                     //! Move constructor.
                     //-----------------------------------------------------------------------------
-                    ALPAKA_FN_HOST StreamCpuAsyncImpl(StreamCpuAsyncImpl &&) = default;
+                    ALPAKA_FN_HOST StreamCpuAsyncImpl(StreamCpuAsyncImpl &&) = delete;
                     //-----------------------------------------------------------------------------
                     //! Copy assignment operator.
                     //-----------------------------------------------------------------------------
@@ -96,19 +168,262 @@ namespace alpaka
                     //-----------------------------------------------------------------------------
                     //! Move assignment operator.
                     //-----------------------------------------------------------------------------
-                    ALPAKA_FN_HOST auto operator=(StreamCpuAsyncImpl &&) -> StreamCpuAsyncImpl & = default;
+                    ALPAKA_FN_HOST auto operator=(StreamCpuAsyncImpl &&) -> StreamCpuAsyncImpl & = delete;
                     //-----------------------------------------------------------------------------
                     //! Destructor.
+                    //! The drains keep the stream alive, so all tasks have been run when it is destroyed.
                     //-----------------------------------------------------------------------------
                     ALPAKA_FN_HOST ~StreamCpuAsyncImpl() noexcept(false)
                     {
-                        m_dev.m_spDevCpuImpl->UnregisterAsyncStream(this);
+                        if(m_pRegistrySlot)
+                        {
+                            m_dev.m_spDevCpuImpl->UnregisterAsyncStream(m_pRegistrySlot);
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Resets the stream to the state after construction before it is handed out again by the recycling pool of the device.
+                    //! The drains keep the stream alive, so it is empty at this point.
+                    //!
+                    //! \return If the stream can be reused with the given queue configuration. The pool belongs to the device.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto recycle(
+                        dev::DevCpu const &,
+                        std::size_t const & queueCapacity,
+                        core::detail::QueueFullPolicy const & queueFullPolicy)
+                    -> bool
+                    {
+                        assert(empty() && (m_suspendState.load() == SuspendState::None));
+
+                        if((queueCapacity != m_queueCapacity) || (queueFullPolicy != m_queueFullPolicy))
+                        {
+                            return false;
+                        }
+
+                        // The stream is registered again by the handle it is handed out to.
+                        if(m_pRegistrySlot)
+                        {
+                            m_dev.m_spDevCpuImpl->UnregisterAsyncStream(m_pRegistrySlot);
+                            m_pRegistrySlot = nullptr;
+                        }
+
+                        m_id = core::detail::getNextUniqueId<StreamCpuAsyncImpl>();
+                        m_upCaptureGraph.reset();
+                        return true;
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! Enqueues the task and applies the QueueFullPolicy if the queue is full.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TTask>
+                    ALPAKA_FN_HOST auto enqueueTask(
+                        TTask && task)
+                    -> void
+                    {
+                        EnqueueInFlight const enqueueInFlight(m_numEnqueuesInFlight);
+                        m_taskQueue.enqueueTaskNoFuture(std::forward<TTask>(task));
+                        taskEnqueued();
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Enqueues the task if there is space in the queue.
+                    //!
+                    //! \return false if the queue is full. The task is discarded in this case.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TTask>
+                    ALPAKA_FN_HOST auto tryEnqueueTask(
+                        TTask && task)
+                    -> bool
+                    {
+                        EnqueueInFlight const enqueueInFlight(m_numEnqueuesInFlight);
+                        if(m_taskQueue.tryEnqueueTaskNoFuture(std::forward<TTask>(task)))
+                        {
+                            taskEnqueued();
+                            return true;
+                        }
+                        return false;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Applies the QueueFullPolicy after tryEnqueueTask failed.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto waitForQueueSpace()
+                    -> void
+                    {
+                        m_taskQueue.waitForQueueSpace();
                     }
+                    //-----------------------------------------------------------------------------
+                    //! \return If all enqueued tasks have been completed.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto empty() const
+                    -> bool
+                    {
+                        return m_numTasksPending.load(std::memory_order_acquire) == 0u;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return A ticket covering all tasks whose enqueue has returned before this call.
+                    //!
+                    //! The tasks are counted after they have been pushed, so concurrent enqueues can be counted in another order than they are queued.
+                    //! Enqueues in flight are therefore counted too. This can only make the ticket cover more tasks.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getTicket() const
+                    -> std::uint64_t
+                    {
+                        // An enqueue leaves the in flight count after it has been counted as enqueued, so reading in this order never misses it.
+                        auto const numEnqueuesInFlight(m_numEnqueuesInFlight.load(std::memory_order_seq_cst));
+                        return m_numTasksEnqueued.load(std::memory_order_seq_cst) + numEnqueuesInFlight;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return If all tasks covered by the given ticket have been completed.
+                    //! The tasks are completed in order. An empty stream has completed all tasks even if the ticket covers an enqueue that failed.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto isTicketCompleted(
+                        std::uint64_t const & ticket) const
+                    -> bool
+                    {
+                        return (m_numTasksCompleted.load(std::memory_order_seq_cst) >= ticket)
+                            || (m_numTasksPending.load(std::memory_order_seq_cst) == 0u);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Suspends the stream after the currently running task.
+                    //!
+                    //! This may only be called by a task of this stream.
+                    //! It has to be followed by exactly one call to resume which can happen at any time, even before the task returns.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto suspend()
+                    -> void
+                    {
+                        m_suspendState.store(SuspendState::Suspending, std::memory_order_release);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Resumes the stream after suspend.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto resume()
+                    -> void
+                    {
+                        // If the drain has already stopped, a new one continues with the tasks after the waiting one.
+                        if(m_suspendState.exchange(SuspendState::Resumed, std::memory_order_acq_rel) == SuspendState::Suspended)
+                        {
+                            scheduleDrain(true);
+                        }
+                    }
+
+                private:
+                    //-----------------------------------------------------------------------------
+                    //! Counts the task and schedules a drain if the stream has been idle.
+                    //! The device counts the stream as busy until the drain has completed the last pending task.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto taskEnqueued()
+                    -> void
+                    {
+                        m_numTasksEnqueued.fetch_add(1u, std::memory_order_seq_cst);
+                        if(m_numTasksPending.fetch_add(1u, std::memory_order_acq_rel) == 0u)
+                        {
+                            m_dev.m_spDevCpuImpl->beginStreamWork();
+                            scheduleDrain(false);
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Schedules a drain on the stream thread pool of the device.
+                    //! The drain keeps the stream alive until it has finished.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto scheduleDrain(
+                        bool const resumed)
+                    -> void
+                    {
+                        auto spThis(shared_from_this());
+                        m_dev.m_spDevCpuImpl->enqueueStreamTask(
+                            [spThis, resumed]()
+                            {
+                                spThis->drain(resumed);
+                            });
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Runs the queued tasks in order until the stream is empty or suspended.
+                    //!
+                    //! \param resumed If the drain continues after a suspension. The waiting task has not been counted as completed yet.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto drain(
+                        bool const resumed)
+                    -> void
+                    {
+                        if(resumed)
+                        {
+                            m_suspendState.store(SuspendState::None, std::memory_order_relaxed);
+                            if(taskCompleted())
+                            {
+                                return;
+                            }
+                        }
+
+                        for(std::size_t taskCount(0u);; ++taskCount)
+                        {
+                            // Let the drains of the other streams run. The pending count stays above zero so nobody else schedules this stream meanwhile.
+                            if(taskCount == drainTaskCountMax)
+                            {
+                                scheduleDrain(false);
+                                return;
+                            }
+
+                            // A pending count above zero guarantees that the next task has been pushed or is being pushed by another producer right now.
+                            while(!m_taskQueue.runNextTask())
+                            {
+                                std::this_thread::yield();
+                            }
+
+                            auto const suspendState(m_suspendState.load(std::memory_order_acquire));
+                            if(suspendState != SuspendState::None)
+                            {
+                                auto expected(SuspendState::Suspending);
+                                if(m_suspendState.compare_exchange_strong(expected, SuspendState::Suspended, std::memory_order_acq_rel))
+                                {
+                                    return;
+                                }
+                                // The event has already resumed the stream.
+                                m_suspendState.store(SuspendState::None, std::memory_order_relaxed);
+                            }
+
+                            if(taskCompleted())
+                            {
+                                return;
+                            }
+                        }
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! Counts the current task as completed and wakes up the threads waiting for the device.
+                    //!
+                    //! \return If the stream has become empty. The busy period on the device has been ended in this case.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto taskCompleted()
+                    -> bool
+                    {
+                        m_numTasksCompleted.fetch_add(1u, std::memory_order_seq_cst);
+                        bool const bEmpty(m_numTasksPending.fetch_sub(1u, std::memory_order_seq_cst) == 1u);
+                        if(bEmpty)
+                        {
+                            m_dev.m_spDevCpuImpl->endStreamWork();
+                        }
+                        m_dev.m_spDevCpuImpl->notifyStreamProgress();
+                        return bEmpty;
+                    }
+
                 public:
-                    boost::uuids::uuid const m_uuid;    //!< The unique ID.
+                    std::uint64_t m_id;                 //!< The unique ID. It changes when the stream is recycled.
                     dev::DevCpu const m_dev;            //!< The device this stream is bound to.
 
-                    ThreadPool m_workerThread;
+                    std::unique_ptr<graph::GraphCpu> m_upCaptureGraph;  //!< The graph the enqueued tasks are recorded into or nullptr if the stream is not capturing.
+
+                    core::detail::LockFreeRegistry<StreamCpuAsyncImpl>::Slot * m_pRegistrySlot; //!< The registration on the device or nullptr while the stream is not in use.
+
+                private:
+                    std::size_t const m_queueCapacity;
+                    core::detail::QueueFullPolicy const m_queueFullPolicy;
+                    TaskQueue m_taskQueue;
+                    std::atomic<std::size_t> m_numEnqueuesInFlight; //!< The number of enqueues that have not returned yet.
+                    std::atomic<std::uint64_t> m_numTasksEnqueued;  //!< The number of tasks enqueued since construction.
+                    std::atomic<std::uint64_t> m_numTasksCompleted; //!< The number of tasks completed since construction.
+                    std::atomic<std::size_t> m_numTasksPending;     //!< The number of enqueued tasks that have not been completed.
+                    std::atomic<SuspendState> m_suspendState;
                 };
             }
         }
@@ -119,14 +434,24 @@ namespace alpaka
         class StreamCpuAsync final
         {
         public:
+            using QueueFullPolicy = core::detail::QueueFullPolicy;
+
             //-----------------------------------------------------------------------------
             //! Constructor.
+            //!
+            //! \param dev The device the stream is created on.
+            //! \param queueCapacity The maximum number of tasks waiting in the stream. It is rounded up to the next power of two.
+            //! \param queueFullPolicy What enqueuing into the stream does if queueCapacity tasks are already waiting.
+            //!  The default blocks the enqueuing thread, so a fast producer can not run the host out of memory.
+            //!  Recording events and waiting for the stream also enqueue tasks, so with QueueFullPolicy::Fail they can throw, too.
             //-----------------------------------------------------------------------------
             ALPAKA_FN_HOST StreamCpuAsync(
-                dev::DevCpu & dev) :
-                    m_spAsyncStreamCpu(std::make_shared<cpu::detail::StreamCpuAsyncImpl>(dev))
+                dev::DevCpu & dev,
+                std::size_t const & queueCapacity = 128u,
+                QueueFullPolicy const & queueFullPolicy = QueueFullPolicy::Block) :
+                    m_spAsyncStreamCpu(dev.m_spDevCpuImpl->getRecyclingPool<cpu::detail::StreamCpuAsyncImpl>().acquire(dev, queueCapacity, queueFullPolicy))
             {
-                dev.m_spDevCpuImpl->RegisterAsyncStream(m_spAsyncStreamCpu);
+                m_spAsyncStreamCpu->m_pRegistrySlot = dev.m_spDevCpuImpl->RegisterAsyncStream(m_spAsyncStreamCpu);
             }
             //-----------------------------------------------------------------------------
             //! Copy constructor.
@@ -150,7 +475,7 @@ namespace alpaka
             ALPAKA_FN_HOST auto operator==(StreamCpuAsync const & rhs) const
             -> bool
             {
-                return (m_spAsyncStreamCpu->m_uuid == rhs.m_spAsyncStreamCpu->m_uuid);
+                return (m_spAsyncStreamCpu->m_id == rhs.m_spAsyncStreamCpu->m_id);
             }
             //-----------------------------------------------------------------------------
             //! Inequality comparison operator.
@@ -217,6 +542,64 @@ namespace alpaka
             };
         }
     }
+    namespace graph
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU async device stream graph type trait specialization.
+            //#############################################################################
+            template<>
+            struct GraphType<
+                stream::StreamCpuAsync>
+            {
+                using type = graph::GraphCpu;
+            };
+            //#############################################################################
+            //! The CPU async device stream begin capture trait specialization.
+            //#############################################################################
+            template<>
+            struct BeginCapture<
+                stream::StreamCpuAsync>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto beginCapture(
+                    stream::StreamCpuAsync & stream)
+                -> void
+                {
+                    if(stream.m_spAsyncStreamCpu->m_upCaptureGraph)
+                    {
+                        throw std::runtime_error("The stream is already capturing!");
+                    }
+                    stream.m_spAsyncStreamCpu->m_upCaptureGraph.reset(new graph::GraphCpu());
+                }
+            };
+            //#############################################################################
+            //! The CPU async device stream end capture trait specialization.
+            //#############################################################################
+            template<>
+            struct EndCapture<
+                stream::StreamCpuAsync>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto endCapture(
+                    stream::StreamCpuAsync & stream)
+                -> graph::GraphCpu
+                {
+                    if(!stream.m_spAsyncStreamCpu->m_upCaptureGraph)
+                    {
+                        throw std::runtime_error("The stream is not capturing!");
+                    }
+                    auto upCaptureGraph(std::move(stream.m_spAsyncStreamCpu->m_upCaptureGraph));
+                    return *upCaptureGraph;
+                }
+            };
+        }
+    }
     namespace stream
     {
         namespace traits
@@ -224,6 +607,7 @@ namespace alpaka
             //#############################################################################
             //! The CPU async device stream enqueue trait specialization.
             //! This default implementation for all tasks directly invokes the function call operator of the task.
+            //! While the stream is capturing, the task is recorded into the graph instead.
             //#############################################################################
             template<
                 typename TTask>
@@ -239,8 +623,15 @@ namespace alpaka
                     TTask & task)
                 -> void
                 {
-                    stream.m_spAsyncStreamCpu->m_workerThread.enqueueTask(
-                        task);
+                    if(stream.m_spAsyncStreamCpu->m_upCaptureGraph)
+                    {
+                        stream.m_spAsyncStreamCpu->m_upCaptureGraph->m_spGraphCpuImpl->addTask(task);
+                    }
+                    else
+                    {
+                        stream.m_spAsyncStreamCpu->enqueueTask(
+                            task);
+                    }
                 }
                 //-----------------------------------------------------------------------------
                 //
@@ -250,8 +641,46 @@ namespace alpaka
                     TTask const & task)
                 -> void
                 {
-                    stream.m_spAsyncStreamCpu->m_workerThread.enqueueTask(
-                        task);
+                    if(stream.m_spAsyncStreamCpu->m_upCaptureGraph)
+                    {
+                        stream.m_spAsyncStreamCpu->m_upCaptureGraph->m_spGraphCpuImpl->addTask(task);
+                    }
+                    else
+                    {
+                        stream.m_spAsyncStreamCpu->enqueueTask(
+                            task);
+                    }
+                }
+            };
+            //#############################################################################
+            //! The CPU async device stream batch enqueue trait specialization.
+            //! The batch is enqueued as a single task, so it is one queue entry and wakes up the stream at most once.
+            //! While the stream is capturing, the batch is recorded into the graph as a single task, too.
+            //#############################################################################
+            template<
+                typename TTaskBatch>
+            struct EnqueueBatch<
+                stream::StreamCpuAsync,
+                TTaskBatch,
+                typename std::enable_if<TTaskBatch::isInvocable>::type>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueueBatch(
+                    stream::StreamCpuAsync & stream,
+                    TTaskBatch & batch)
+                -> void
+                {
+                    if(stream.m_spAsyncStreamCpu->m_upCaptureGraph)
+                    {
+                        stream.m_spAsyncStreamCpu->m_upCaptureGraph->m_spGraphCpuImpl->addTask(batch);
+                    }
+                    else
+                    {
+                        stream.m_spAsyncStreamCpu->enqueueTask(
+                            std::move(batch));
+                    }
                 }
             };
             //#############################################################################
@@ -268,7 +697,7 @@ namespace alpaka
                     stream::StreamCpuAsync const & stream)
                 -> bool
                 {
-                    return stream.m_spAsyncStreamCpu->m_workerThread.isQueueEmpty();
+                    return stream.m_spAsyncStreamCpu->empty();
                 }
             };
         }
@@ -0,0 +1,821 @@
+/**
+* \file
+* Copyright 2014-2015 Benjamin Worpitz
+*
+* This file is part of alpaka.
+*
+* alpaka is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* alpaka is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with alpaka.
+* If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <alpaka/dev/DevCpu.hpp>                // dev::DevCpu
+
+#include <alpaka/dev/Traits.hpp>                // dev::GetDev, dev::DevType
+#include <alpaka/event/Traits.hpp>              // event::EventType
+#include <alpaka/extent/Traits.hpp>             // extent::getWidth, extent::getProductOfExtents
+#include <alpaka/mem/view/Traits.hpp>           // mem::view::getBuf, mem::view::getPtrNative, mem::view::getPitchBytes
+#include <alpaka/stream/Traits.hpp>             // stream::traits::Enqueue, ...
+#include <alpaka/wait/Traits.hpp>               // CurrentThreadWaitFor, WaiterWaitFor
+
+#include <alpaka/core/UniqueId.hpp>             // core::detail::getNextUniqueId
+
+#include <cstdint>                              // std::uint8_t, std::uint64_t
+#include <functional>                           // std::function
+#include <initializer_list>                     // std::initializer_list
+#include <list>                                 // std::list
+#include <memory>                               // std::shared_ptr, std::enable_shared_from_this
+#include <mutex>                                // std::mutex
+#include <type_traits>                          // std::decay
+#include <utility>                              // std::forward, std::move
+#include <vector>                               // std::vector
+
+namespace alpaka
+{
+    namespace event
+    {
+        class EventCpu;
+    }
+}
+
+namespace alpaka
+{
+    namespace stream
+    {
+        namespace cpu
+        {
+            //#############################################################################
+            //! A range of host memory read or written by a task.
+            //#############################################################################
+            struct MemAccess
+            {
+                std::uint8_t const * m_pBegin;  //!< The first byte.
+                std::uint8_t const * m_pEnd;    //!< One past the last byte.
+                bool m_bWrite;                  //!< If the task writes to the range.
+
+                //-----------------------------------------------------------------------------
+                //! \return If the two accesses have to be ordered: The ranges overlap and at least one of them is written.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto conflicts(
+                    MemAccess const & other) const
+                -> bool
+                {
+                    return (m_bWrite || other.m_bWrite)
+                        && (m_pBegin < other.m_pEnd)
+                        && (other.m_pBegin < m_pEnd);
+                }
+            };
+
+            namespace detail
+            {
+                //-----------------------------------------------------------------------------
+                //! \return The access to the whole buffer underlying the given view.
+                //! Tracking whole buffers is conservative for sub-views but never misses a dependency.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TView>
+                ALPAKA_FN_HOST auto getMemAccess(
+                    TView const & view,
+                    bool const bWrite)
+                -> MemAccess
+                {
+                    auto const & buf(mem::view::getBuf(view));
+                    auto const pBegin(reinterpret_cast<std::uint8_t const *>(mem::view::getPtrNative(buf)));
+                    auto const width(extent::getWidth(buf));
+                    auto const rowCount((width > 0u) ? (extent::getProductOfExtents(buf) / width) : 0u);
+                    auto const sizeBytes(
+                        static_cast<std::size_t>(mem::view::getPitchBytes<dim::Dim<TView>::value - 1u>(buf))
+                        * static_cast<std::size_t>(rowCount));
+                    return MemAccess{pBegin, pBegin + sizeBytes, bWrite};
+                }
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The read access to the buffer underlying the given view.
+            //-----------------------------------------------------------------------------
+            template<
+                typename TView>
+            ALPAKA_FN_HOST auto memRead(
+                TView const & view)
+            -> MemAccess
+            {
+                return detail::getMemAccess(view, false);
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The write access to the buffer underlying the given view. Writing includes reading.
+            //-----------------------------------------------------------------------------
+            template<
+                typename TView>
+            ALPAKA_FN_HOST auto memWrite(
+                TView const & view)
+            -> MemAccess
+            {
+                return detail::getMemAccess(view, true);
+            }
+
+            namespace detail
+            {
+                //#############################################################################
+                //! A task with the memory accesses declared by the user.
+                //#############################################################################
+                template<
+                    typename TTask>
+                class TaskMemAccesses final
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    //! Constructor.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TTaskFwd>
+                    ALPAKA_FN_HOST TaskMemAccesses(
+                        TTaskFwd && task,
+                        std::initializer_list<MemAccess> const & memAccesses) :
+                            m_task(std::forward<TTaskFwd>(task)),
+                            m_vMemAccesses(memAccesses)
+                    {}
+                    //-----------------------------------------------------------------------------
+                    //! Executes the task.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto operator()() const
+                    -> void
+                    {
+                        m_task();
+                    }
+
+                public:
+                    TTask m_task;
+                    std::vector<MemAccess> m_vMemAccesses;
+                };
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The task together with the memory it accesses.
+            //!
+            //! The memory accesses of kernels can not be derived from their arguments.
+            //! Without them a StreamCpuParallel orders the kernel after and before all other tasks.
+            //-----------------------------------------------------------------------------
+            template<
+                typename TTask>
+            ALPAKA_FN_HOST auto withMemAccesses(
+                TTask && task,
+                std::initializer_list<MemAccess> const & memAccesses)
+            -> detail::TaskMemAccesses<typename std::decay<TTask>::type>
+            {
+                return
+                    detail::TaskMemAccesses<typename std::decay<TTask>::type>(
+                        std::forward<TTask>(task),
+                        memAccesses);
+            }
+        }
+
+        namespace traits
+        {
+            //#############################################################################
+            //! The task memory accesses trait.
+            //!
+            //! Tasks without a specialization access unknown memory.
+            //#############################################################################
+            template<
+                typename TTask,
+                typename TSfinae = void>
+            struct GetMemAccesses
+            {
+                //-----------------------------------------------------------------------------
+                //! Appends the memory accessed by the task.
+                //!
+                //! \return If the accessed memory is known.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getMemAccesses(
+                    TTask const &,
+                    std::vector<cpu::MemAccess> &)
+                -> bool
+                {
+                    return false;
+                }
+            };
+
+            //#############################################################################
+            //! The memory accesses trait specialization for tasks with declared accesses.
+            //#############################################################################
+            template<
+                typename TTask>
+            struct GetMemAccesses<
+                cpu::detail::TaskMemAccesses<TTask>>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getMemAccesses(
+                    cpu::detail::TaskMemAccesses<TTask> const & task,
+                    std::vector<cpu::MemAccess> & vMemAccesses)
+                -> bool
+                {
+                    vMemAccesses.insert(vMemAccesses.end(), task.m_vMemAccesses.begin(), task.m_vMemAccesses.end());
+                    return true;
+                }
+            };
+        }
+
+        namespace cpu
+        {
+            namespace detail
+            {
+                //#############################################################################
+                //! Collects the memory accesses of the tasks of a batch.
+                //#############################################################################
+                class AppendMemAccesses
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    //! Constructor.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST explicit AppendMemAccesses(
+                        std::vector<cpu::MemAccess> & vMemAccesses) :
+                            m_vMemAccesses(vMemAccesses),
+                            m_bKnown(true)
+                    {}
+                    //-----------------------------------------------------------------------------
+                    //
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TTask>
+                    ALPAKA_FN_HOST auto operator()(
+                        TTask const & task)
+                    -> void
+                    {
+                        // Once one access is unknown the batch waits for everything anyway.
+                        m_bKnown = m_bKnown && traits::GetMemAccesses<TTask>::getMemAccesses(task, m_vMemAccesses);
+                    }
+
+                public:
+                    std::vector<cpu::MemAccess> & m_vMemAccesses;
+                    bool m_bKnown;      //!< If all accesses are known.
+                };
+            }
+        }
+
+        namespace traits
+        {
+            //#############################################################################
+            //! The memory accesses trait specialization for task batches.
+            //! A batch accesses the memory of all of its tasks.
+            //#############################################################################
+            template<
+                typename... TTasks>
+            struct GetMemAccesses<
+                stream::detail::TaskBatch<TTasks...>>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getMemAccesses(
+                    stream::detail::TaskBatch<TTasks...> const & batch,
+                    std::vector<cpu::MemAccess> & vMemAccesses)
+                -> bool
+                {
+                    cpu::detail::AppendMemAccesses appendMemAccesses(vMemAccesses);
+                    batch.forEach(appendMemAccesses);
+                    return appendMemAccesses.m_bKnown;
+                }
+            };
+            //#############################################################################
+            //! The memory accesses trait specialization for task batches.
+            //! A batch accesses the memory of all of its tasks.
+            //#############################################################################
+            template<
+                typename TTask>
+            struct GetMemAccesses<
+                stream::detail::TaskBatchRange<TTask>>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getMemAccesses(
+                    stream::detail::TaskBatchRange<TTask> const & batch,
+                    std::vector<cpu::MemAccess> & vMemAccesses)
+                -> bool
+                {
+                    cpu::detail::AppendMemAccesses appendMemAccesses(vMemAccesses);
+                    batch.forEach(appendMemAccesses);
+                    return appendMemAccesses.m_bKnown;
+                }
+            };
+        }
+
+        namespace cpu
+        {
+            namespace detail
+            {
+                //#############################################################################
+                //! The CPU device parallel stream implementation.
+                //!
+                //! The tasks run on the stream thread pool of the device.
+                //! A task only waits for the earlier tasks it conflicts with, all others can run concurrently.
+                //! Tasks with unknown memory accesses wait for all earlier tasks and all later tasks wait for them.
+                //#############################################################################
+                class StreamCpuParallelImpl final :
+                    public std::enable_shared_from_this<StreamCpuParallelImpl>
+                {
+                public:
+                    //#############################################################################
+                    //! A task and its position in the dependency graph.
+                    //#############################################################################
+                    struct TaskNode
+                    {
+                        std::function<void()> m_task;
+                        std::vector<MemAccess> m_vMemAccesses;
+                        bool m_bDependsOnAll = false;           //!< If the task waits for all earlier tasks.
+                        bool m_bAllDependOn = false;            //!< If all later tasks wait for this task.
+                        bool m_bRunsAfterCompletion = false;    //!< If the task is run after the node has been completed.
+                        std::size_t m_numDependencies = 0u;     //!< The number of dependencies not yet completed this task waits for.
+                        std::uint64_t m_ticket = 0u;            //!< The position in the enqueue order.
+                        std::vector<std::shared_ptr<TaskNode>> m_vspSuccessors;    //!< The later tasks waiting for this task.
+                        std::list<std::shared_ptr<TaskNode>>::iterator m_itPending; //!< The position in the list of pending tasks.
+                    };
+
+                public:
+                    //-----------------------------------------------------------------------------
+                    //! Constructor.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST StreamCpuParallelImpl(
+                        dev::DevCpu & dev) :
+                            m_id(core::detail::getNextUniqueId<StreamCpuParallelImpl>()),
+                            m_dev(dev),
+                            m_pRegistrySlot(nullptr)
+                    {}
+                    //-----------------------------------------------------------------------------
+                    //! Copy constructor.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST StreamCpuParallelImpl(StreamCpuParallelImpl const &) = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Move constructor.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST StreamCpuParallelImpl(StreamCpuParallelImpl &&) = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Copy assignment operator.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto operator=(StreamCpuParallelImpl const &) -> StreamCpuParallelImpl & = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Move assignment operator.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto operator=(StreamCpuParallelImpl &&) -> StreamCpuParallelImpl & = delete;
+                    //-----------------------------------------------------------------------------
+                    //! Destructor.
+                    //! The running tasks keep the stream alive, so all tasks have been run when it is destroyed.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST ~StreamCpuParallelImpl() noexcept(false)
+                    {
+                        if(m_pRegistrySlot)
+                        {
+                            m_dev.m_spDevCpuImpl->UnregisterParallelStream(m_pRegistrySlot);
+                        }
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! Enqueues the task ordered by the memory it accesses.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TTask>
+                    ALPAKA_FN_HOST auto enqueueTask(
+                        TTask const & task)
+                    -> void
+                    {
+                        auto spTaskNode(std::make_shared<TaskNode>());
+                        spTaskNode->m_task = task;
+                        bool const bMemAccessesKnown(
+                            traits::GetMemAccesses<TTask>::getMemAccesses(
+                                task,
+                                spTaskNode->m_vMemAccesses));
+                        spTaskNode->m_bDependsOnAll = !bMemAccessesKnown;
+                        spTaskNode->m_bAllDependOn = !bMemAccessesKnown;
+                        enqueueTaskNode(spTaskNode);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Enqueues a task that waits for all earlier tasks but is not waited for by later ones.
+                    //! This is what an event needs.
+                    //! The task is run after the node has been completed, so the stream is already empty when the last event signals.
+                    //-----------------------------------------------------------------------------
+                    template<
+                        typename TTask>
+                    ALPAKA_FN_HOST auto enqueueTaskAfterAll(
+                        TTask const & task)
+                    -> void
+                    {
+                        auto spTaskNode(std::make_shared<TaskNode>());
+                        spTaskNode->m_task = task;
+                        spTaskNode->m_bDependsOnAll = true;
+                        spTaskNode->m_bAllDependOn = false;
+                        spTaskNode->m_bRunsAfterCompletion = true;
+                        enqueueTaskNode(spTaskNode);
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Enqueues a gate all later tasks wait for.
+                    //! The gate is closed until openGate is called with the returned node.
+                    //! It does not occupy a thread while it is closed.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto enqueueGate()
+                    -> std::shared_ptr<TaskNode>
+                    {
+                        auto spTaskNode(std::make_shared<TaskNode>());
+                        spTaskNode->m_task = [](){};
+                        spTaskNode->m_bDependsOnAll = false;
+                        spTaskNode->m_bAllDependOn = true;
+                        // The dependency on the caller.
+                        spTaskNode->m_numDependencies = 1u;
+                        enqueueTaskNode(spTaskNode);
+                        return spTaskNode;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Opens the gate returned by enqueueGate.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto openGate(
+                        std::shared_ptr<TaskNode> spTaskNode)
+                    -> void
+                    {
+                        bool bReady(false);
+                        {
+                            std::lock_guard<std::mutex> lk(m_mtxTasks);
+                            bReady = (--spTaskNode->m_numDependencies == 0u);
+                        }
+                        if(bReady)
+                        {
+                            runTaskNode(std::move(spTaskNode));
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return If all enqueued tasks have been completed.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto empty() const
+                    -> bool
+                    {
+                        std::lock_guard<std::mutex> lk(m_mtxTasks);
+                        return m_lspTasksPending.empty();
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return A ticket covering all tasks enqueued before this call.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto getTicket() const
+                    -> std::uint64_t
+                    {
+                        std::lock_guard<std::mutex> lk(m_mtxTasks);
+                        return m_numTasksEnqueued;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return If all tasks covered by the given ticket have been completed.
+                    //! The tasks complete out of order, so this is the case once the oldest pending task is not covered by the ticket.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto isTicketCompleted(
+                        std::uint64_t const & ticket) const
+                    -> bool
+                    {
+                        std::lock_guard<std::mutex> lk(m_mtxTasks);
+                        return m_lspTasksPending.empty() || (m_lspTasksPending.front()->m_ticket >= ticket);
+                    }
+
+                private:
+                    //-----------------------------------------------------------------------------
+                    //! Enqueues the task node.
+                    //! The task, the flags, the memory accesses and the external dependencies of the node have to be set.
+                    //! The device counts the stream as busy from the first pending task until it is empty again.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto enqueueTaskNode(
+                        std::shared_ptr<TaskNode> const & spTaskNode)
+                    -> void
+                    {
+                        bool bReady(false);
+                        {
+                            std::lock_guard<std::mutex> lk(m_mtxTasks);
+
+                            if(m_lspTasksPending.empty())
+                            {
+                                m_dev.m_spDevCpuImpl->beginStreamWork();
+                            }
+
+                            // Search backwards because a task ordered with respect to all others transitively covers everything before it.
+                            for(auto itPending(m_lspTasksPending.rbegin()); itPending != m_lspTasksPending.rend(); ++itPending)
+                            {
+                                auto & spTaskPending(*itPending);
+                                if(mustWaitFor(*spTaskNode, *spTaskPending))
+                                {
+                                    spTaskPending->m_vspSuccessors.emplace_back(spTaskNode);
+                                    ++spTaskNode->m_numDependencies;
+
+                                    if(spTaskPending->m_bDependsOnAll && spTaskPending->m_bAllDependOn)
+                                    {
+                                        break;
+                                    }
+                                }
+                            }
+
+                            spTaskNode->m_ticket = m_numTasksEnqueued++;
+                            spTaskNode->m_itPending = m_lspTasksPending.insert(m_lspTasksPending.end(), spTaskNode);
+                            bReady = (spTaskNode->m_numDependencies == 0u);
+                        }
+
+                        if(bReady)
+                        {
+                            runTaskNode(spTaskNode);
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Completes the task and starts the later tasks that have only been waiting for it.
+                    //!
+                    //! \return If the stream has become empty. The caller has to end the busy period on the device after it is done with the task.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto completeTask(
+                        std::shared_ptr<TaskNode> const & spTaskNode)
+                    -> bool
+                    {
+                        bool bEmpty(false);
+                        std::vector<std::shared_ptr<TaskNode>> vspTasksReady;
+                        {
+                            std::lock_guard<std::mutex> lk(m_mtxTasks);
+
+                            m_lspTasksPending.erase(spTaskNode->m_itPending);
+                            bEmpty = m_lspTasksPending.empty();
+                            for(auto & spSuccessor : spTaskNode->m_vspSuccessors)
+                            {
+                                if(--spSuccessor->m_numDependencies == 0u)
+                                {
+                                    vspTasksReady.emplace_back(std::move(spSuccessor));
+                                }
+                            }
+                            spTaskNode->m_vspSuccessors.clear();
+                        }
+
+                        for(auto & spTaskReady : vspTasksReady)
+                        {
+                            runTaskNode(std::move(spTaskReady));
+                        }
+
+                        return bEmpty;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! \return If the later task has to wait for the earlier one.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST static auto mustWaitFor(
+                        TaskNode const & later,
+                        TaskNode const & earlier)
+                    -> bool
+                    {
+                        if(later.m_bDependsOnAll || earlier.m_bAllDependOn)
+                        {
+                            return true;
+                        }
+                        for(auto const & memAccessLater : later.m_vMemAccesses)
+                        {
+                            for(auto const & memAccessEarlier : earlier.m_vMemAccesses)
+                            {
+                                if(memAccessLater.conflicts(memAccessEarlier))
+                                {
+                                    return true;
+                                }
+                            }
+                        }
+                        return false;
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Runs the task on the stream thread pool of the device.
+                    //! The task keeps the stream alive until it has been completed.
+                    //! Like in StreamCpuAsync an exception thrown by the task is dropped and the task still counts as completed, so waits for the stream and the device return.
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST auto runTaskNode(
+                        std::shared_ptr<TaskNode> spTaskNode)
+                    -> void
+                    {
+                        auto spThis(shared_from_this());
+                        m_dev.m_spDevCpuImpl->enqueueStreamTask(
+                            [spThis, spTaskNode]()
+                            {
+                                auto task(std::move(spTaskNode->m_task));
+                                spTaskNode->m_task = nullptr;
+                                bool bEmpty(false);
+                                if(spTaskNode->m_bRunsAfterCompletion)
+                                {
+                                    bEmpty = spThis->completeTask(spTaskNode);
+                                }
+                                try
+                                {
+                                    task();
+                                }
+                                catch(...)
+                                {
+                                }
+                                if(!spTaskNode->m_bRunsAfterCompletion)
+                                {
+                                    // The task is released before the completion because it may hold the last reference to a buffer.
+                                    task = nullptr;
+                                    bEmpty = spThis->completeTask(spTaskNode);
+                                }
+                                if(bEmpty)
+                                {
+                                    spThis->m_dev.m_spDevCpuImpl->endStreamWork();
+                                }
+                                spThis->m_dev.m_spDevCpuImpl->notifyStreamProgress();
+                            });
+                    }
+
+                public:
+                    std::uint64_t const m_id;           //!< The unique ID.
+                    dev::DevCpu const m_dev;            //!< The device this stream is bound to.
+
+                    core::detail::LockFreeRegistry<StreamCpuParallelImpl>::Slot * m_pRegistrySlot;  //!< The registration on the device.
+
+                private:
+                    std::mutex mutable m_mtxTasks;
+                    std::list<std::shared_ptr<TaskNode>> m_lspTasksPending;    //!< The enqueued tasks that have not been completed in enqueue order.
+                    std::uint64_t m_numTasksEnqueued = 0u;                      //!< The number of tasks enqueued since construction.
+                };
+            }
+        }
+
+        //#############################################################################
+        //! The CPU device parallel stream.
+        //!
+        //! In contrast to StreamCpuAsync the tasks only keep their order where they access the same buffers.
+        //! The buffers are derived from the views of copies and sets. Kernels and other tasks can declare them with cpu::withMemAccesses.
+        //! Tasks without known accesses, event waits and events keep the order with respect to all other tasks like in StreamCpuAsync.
+        //#############################################################################
+        class StreamCpuParallel final
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            //! Constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST StreamCpuParallel(
+                dev::DevCpu & dev) :
+                    m_spParallelStreamCpu(std::make_shared<cpu::detail::StreamCpuParallelImpl>(dev))
+            {
+                m_spParallelStreamCpu->m_pRegistrySlot = dev.m_spDevCpuImpl->RegisterParallelStream(m_spParallelStreamCpu);
+            }
+            //-----------------------------------------------------------------------------
+            //! Copy constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST StreamCpuParallel(StreamCpuParallel const &) = default;
+            //-----------------------------------------------------------------------------
+            //! Move constructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST StreamCpuParallel(StreamCpuParallel &&) = default;
+            //-----------------------------------------------------------------------------
+            //! Copy assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(StreamCpuParallel const &) -> StreamCpuParallel & = default;
+            //-----------------------------------------------------------------------------
+            //! Move assignment operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(StreamCpuParallel &&) -> StreamCpuParallel & = default;
+            //-----------------------------------------------------------------------------
+            //! Equality comparison operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator==(StreamCpuParallel const & rhs) const
+            -> bool
+            {
+                return (m_spParallelStreamCpu->m_id == rhs.m_spParallelStreamCpu->m_id);
+            }
+            //-----------------------------------------------------------------------------
+            //! Inequality comparison operator.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator!=(StreamCpuParallel const & rhs) const
+            -> bool
+            {
+                return !((*this) == rhs);
+            }
+            //-----------------------------------------------------------------------------
+            //! Destructor.
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST ~StreamCpuParallel() = default;
+
+        public:
+            std::shared_ptr<cpu::detail::StreamCpuParallelImpl> m_spParallelStreamCpu;
+        };
+    }
+
+    namespace dev
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU parallel device stream device type trait specialization.
+            //#############################################################################
+            template<>
+            struct DevType<
+                stream::StreamCpuParallel>
+            {
+                using type = dev::DevCpu;
+            };
+            //#############################################################################
+            //! The CPU parallel device stream device get trait specialization.
+            //#############################################################################
+            template<>
+            struct GetDev<
+                stream::StreamCpuParallel>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getDev(
+                    stream::StreamCpuParallel const & stream)
+                -> dev::DevCpu
+                {
+                    return stream.m_spParallelStreamCpu->m_dev;
+                }
+            };
+        }
+    }
+    namespace event
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU parallel device stream event type trait specialization.
+            //#############################################################################
+            template<>
+            struct EventType<
+                stream::StreamCpuParallel>
+            {
+                using type = event::EventCpu;
+            };
+        }
+    }
+    namespace stream
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU parallel device stream enqueue trait specialization.
+            //! This default implementation for all tasks directly invokes the function call operator of the task.
+            //#############################################################################
+            template<
+                typename TTask>
+            struct Enqueue<
+                stream::StreamCpuParallel,
+                TTask>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueue(
+                    stream::StreamCpuParallel & stream,
+                    TTask const & task)
+                -> void
+                {
+                    stream.m_spParallelStreamCpu->enqueueTask(
+                        task);
+                }
+            };
+            //#############################################################################
+            //! The CPU parallel device stream batch enqueue trait specialization.
+            //! The batch is enqueued as a single task that accesses the memory of all of its tasks.
+            //#############################################################################
+            template<
+                typename TTaskBatch>
+            struct EnqueueBatch<
+                stream::StreamCpuParallel,
+                TTaskBatch,
+                typename std::enable_if<TTaskBatch::isInvocable>::type>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueueBatch(
+                    stream::StreamCpuParallel & stream,
+                    TTaskBatch & batch)
+                -> void
+                {
+                    stream.m_spParallelStreamCpu->enqueueTask(
+                        batch);
+                }
+            };
+            //#############################################################################
+            //! The CPU parallel device stream test trait specialization.
+            //#############################################################################
+            template<>
+            struct Empty<
+                stream::StreamCpuParallel>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto empty(
+                    stream::StreamCpuParallel const & stream)
+                -> bool
+                {
+                    return stream.m_spParallelStreamCpu->empty();
+                }
+            };
+        }
+    }
+}
@@ -25,12 +25,18 @@
 
 #include <alpaka/dev/Traits.hpp>                // dev::GetDev, dev::DevType
 #include <alpaka/event/Traits.hpp>              // event::EventType
+#include <alpaka/graph/GraphCpu.hpp>            // graph::GraphCpu
+#include <alpaka/graph/Traits.hpp>              // graph::traits::GraphType, ...
 #include <alpaka/stream/Traits.hpp>             // stream::traits::Enqueue, ...
 #include <alpaka/wait/Traits.hpp>               // CurrentThreadWaitFor, WaiterWaitFor
 
+#include <alpaka/core/UniqueId.hpp>             // core::detail::getNextUniqueId
+
 #include <boost/core/ignore_unused.hpp>         // boost::ignore_unused
-#include <boost/uuid/uuid.hpp>                  // boost::uuids::uuid
-#include <boost/uuid/uuid_generators.hpp>       // boost::uuids::random_generator
+
+#include <cstdint>                              // std::uint64_t
+#include <memory>                               // std::unique_ptr
+#include <stdexcept>                            // std::runtime_error
 
 namespace alpaka
 {
@@ -59,7 +65,7 @@ namespace alpaka
                     //-----------------------------------------------------------------------------
                     ALPAKA_FN_HOST StreamCpuSyncImpl(
                         dev::DevCpu & dev) :
-                            m_uuid(boost::uuids::random_generator()()),
+                            m_id(core::detail::getNextUniqueId<StreamCpuSyncImpl>()),
                             m_dev(dev)
                     {}
                     //-----------------------------------------------------------------------------
@@ -84,8 +90,10 @@ namespace alpaka
                     ALPAKA_FN_HOST ~StreamCpuSyncImpl() = default;
 
                 public:
-                    boost::uuids::uuid const m_uuid;    //!< The unique ID.
+                    std::uint64_t const m_id;           //!< The unique ID.
                     dev::DevCpu const m_dev;            //!< The device this stream is bound to.
+
+                    std::unique_ptr<graph::GraphCpu> m_upCaptureGraph;  //!< The graph the enqueued tasks are recorded into or nullptr if the stream is not capturing.
                 };
             }
         }
@@ -125,7 +133,7 @@ namespace alpaka
             ALPAKA_FN_HOST auto operator==(StreamCpuSync const & rhs) const
             -> bool
             {
-                return (m_spSyncStreamCpu->m_uuid == rhs.m_spSyncStreamCpu->m_uuid);
+                return (m_spSyncStreamCpu->m_id == rhs.m_spSyncStreamCpu->m_id);
             }
             //-----------------------------------------------------------------------------
             //! Inequality comparison operator.
@@ -192,6 +200,64 @@ namespace alpaka
             };
         }
     }
+    namespace graph
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU sync device stream graph type trait specialization.
+            //#############################################################################
+            template<>
+            struct GraphType<
+                stream::StreamCpuSync>
+            {
+                using type = graph::GraphCpu;
+            };
+            //#############################################################################
+            //! The CPU sync device stream begin capture trait specialization.
+            //#############################################################################
+            template<>
+            struct BeginCapture<
+                stream::StreamCpuSync>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto beginCapture(
+                    stream::StreamCpuSync & stream)
+                -> void
+                {
+                    if(stream.m_spSyncStreamCpu->m_upCaptureGraph)
+                    {
+                        throw std::runtime_error("The stream is already capturing!");
+                    }
+                    stream.m_spSyncStreamCpu->m_upCaptureGraph.reset(new graph::GraphCpu());
+                }
+            };
+            //#############################################################################
+            //! The CPU sync device stream end capture trait specialization.
+            //#############################################################################
+            template<>
+            struct EndCapture<
+                stream::StreamCpuSync>
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto endCapture(
+                    stream::StreamCpuSync & stream)
+                -> graph::GraphCpu
+                {
+                    if(!stream.m_spSyncStreamCpu->m_upCaptureGraph)
+                    {
+                        throw std::runtime_error("The stream is not capturing!");
+                    }
+                    auto upCaptureGraph(std::move(stream.m_spSyncStreamCpu->m_upCaptureGraph));
+                    return *upCaptureGraph;
+                }
+            };
+        }
+    }
     namespace stream
     {
         namespace traits
@@ -199,6 +265,7 @@ namespace alpaka
             //#############################################################################
             //! The CPU sync device stream enqueue trait specialization.
             //! This default implementation for all tasks directly invokes the function call operator of the task.
+            //! While the stream is capturing, the task is recorded into the graph instead.
             //#############################################################################
             template<
                 typename TTask>
@@ -214,8 +281,14 @@ namespace alpaka
                     TTask & task)
                 -> void
                 {
-                    boost::ignore_unused(stream);
-                    task();
+                    if(stream.m_spSyncStreamCpu->m_upCaptureGraph)
+                    {
+                        stream.m_spSyncStreamCpu->m_upCaptureGraph->m_spGraphCpuImpl->addTask(task);
+                    }
+                    else
+                    {
+                        task();
+                    }
                 }
                 //-----------------------------------------------------------------------------
                 //
@@ -225,8 +298,14 @@ namespace alpaka
                     TTask const & task)
                 -> void
                 {
-                    boost::ignore_unused(stream);
-                    task();
+                    if(stream.m_spSyncStreamCpu->m_upCaptureGraph)
+                    {
+                        stream.m_spSyncStreamCpu->m_upCaptureGraph->m_spGraphCpuImpl->addTask(task);
+                    }
+                    else
+                    {
+                        task();
+                    }
                 }
             };
             //#############################################################################
@@ -24,9 +24,15 @@
 #include <alpaka/wait/Traits.hpp>   // CurrentThreadWaitFor, WaiterWaitFor
 
 #include <alpaka/core/Common.hpp>   // ALPAKA_FN_HOST
+#include <alpaka/core/IntegerSequence.hpp>  // core::detail::make_index_sequence
 
-#include <type_traits>              // std::decay
-#include <utility>                  // std::forward
+#include <boost/core/ignore_unused.hpp> // boost::ignore_unused
+
+#include <iterator>                 // std::iterator_traits
+#include <tuple>                    // std::tuple
+#include <type_traits>              // std::decay, std::is_same
+#include <utility>                  // std::forward, std::declval
+#include <vector>                   // std::vector
 
 namespace alpaka
 {
@@ -58,6 +64,197 @@ namespace alpaka
             struct Empty;
         }
 
+        namespace detail
+        {
+            //#############################################################################
+            //! If the task can be invoked without arguments.
+            //#############################################################################
+            template<
+                typename TTask,
+                typename TSfinae = void>
+            struct IsInvocable :
+                std::false_type
+            {};
+            //#############################################################################
+            //! If the task can be invoked without arguments.
+            //#############################################################################
+            template<
+                typename TTask>
+            struct IsInvocable<
+                TTask,
+                decltype(void(std::declval<TTask &>()()))> :
+                std::true_type
+            {};
+
+            template<
+                bool... TValues>
+            struct BoolPack;
+            //#############################################################################
+            //! If all the values are true.
+            //#############################################################################
+            template<
+                bool... TValues>
+            using AllTrue = std::is_same<BoolPack<true, TValues...>, BoolPack<TValues..., true>>;
+
+            //#############################################################################
+            //! Invokes the given tasks.
+            //#############################################################################
+            struct InvokeTask
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TTask>
+                ALPAKA_FN_HOST auto operator()(
+                    TTask & task) const
+                -> void
+                {
+                    task();
+                }
+            };
+
+            //#############################################################################
+            //! A fixed list of tasks of arbitrary types enqueued with stream::enqueueBatch.
+            //!
+            //! If all tasks can be invoked, the batch itself is a task invoking them in order.
+            //#############################################################################
+            template<
+                typename... TTasks>
+            class TaskBatch final
+            {
+            public:
+                //! If all tasks of the batch can be invoked.
+                static constexpr bool isInvocable = AllTrue<IsInvocable<TTasks>::value...>::value;
+
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST explicit TaskBatch(
+                    std::tuple<TTasks...> && tasks) :
+                        m_tasks(std::move(tasks))
+                {}
+
+                //-----------------------------------------------------------------------------
+                //! Calls the given function object with every task in order.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TFnObj>
+                ALPAKA_FN_HOST auto forEach(
+                    TFnObj && f)
+                -> void
+                {
+                    forEachImpl(m_tasks, f, core::detail::make_index_sequence<sizeof...(TTasks)>());
+                }
+                //-----------------------------------------------------------------------------
+                //! Calls the given function object with every task in order.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TFnObj>
+                ALPAKA_FN_HOST auto forEach(
+                    TFnObj && f) const
+                -> void
+                {
+                    forEachImpl(m_tasks, f, core::detail::make_index_sequence<sizeof...(TTasks)>());
+                }
+                //-----------------------------------------------------------------------------
+                //! Invokes the tasks in order.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator()()
+                -> void
+                {
+                    forEach(InvokeTask());
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //!
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TTuple,
+                    typename TFnObj,
+                    std::size_t... TIndices>
+                ALPAKA_FN_HOST static auto forEachImpl(
+                    TTuple & tasks,
+                    TFnObj & f,
+                    core::detail::index_sequence<TIndices...> const &)
+                -> void
+                {
+                    // The elements of a braced initializer list are evaluated in order.
+                    using Expand = int[];
+                    boost::ignore_unused(tasks, f, Expand{0, (f(std::get<TIndices>(tasks)), 0)...});
+                }
+
+            private:
+                std::tuple<TTasks...> m_tasks;
+            };
+
+            //#############################################################################
+            //! A list of tasks of the same type enqueued with stream::enqueueBatchRange.
+            //!
+            //! If the tasks can be invoked, the batch itself is a task invoking them in order.
+            //#############################################################################
+            template<
+                typename TTask>
+            class TaskBatchRange final
+            {
+            public:
+                //! If the tasks of the batch can be invoked.
+                static constexpr bool isInvocable = IsInvocable<TTask>::value;
+
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TIter>
+                ALPAKA_FN_HOST TaskBatchRange(
+                    TIter first,
+                    TIter last) :
+                        m_vTasks(first, last)
+                {}
+
+                //-----------------------------------------------------------------------------
+                //! Calls the given function object with every task in order.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TFnObj>
+                ALPAKA_FN_HOST auto forEach(
+                    TFnObj && f)
+                -> void
+                {
+                    for(auto & task : m_vTasks)
+                    {
+                        f(task);
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Calls the given function object with every task in order.
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TFnObj>
+                ALPAKA_FN_HOST auto forEach(
+                    TFnObj && f) const
+                -> void
+                {
+                    for(auto const & task : m_vTasks)
+                    {
+                        f(task);
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                //! Invokes the tasks in order.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator()()
+                -> void
+                {
+                    forEach(InvokeTask());
+                }
+
+            private:
+                std::vector<TTask> m_vTasks;
+            };
+        }
+
         //-----------------------------------------------------------------------------
         //! Queues the given task in the given stream.
         //!
@@ -80,6 +277,115 @@ namespace alpaka
                 std::forward<TTask>(task));
         }
 
+        namespace detail
+        {
+            //#############################################################################
+            //! Enqueues the given tasks into the stream one by one.
+            //#############################################################################
+            template<
+                typename TStream>
+            class EnqueueTask
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! Constructor.
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST explicit EnqueueTask(
+                    TStream & stream) :
+                        m_stream(stream)
+                {}
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TTask>
+                ALPAKA_FN_HOST auto operator()(
+                    TTask & task) const
+                -> void
+                {
+                    stream::enqueue(m_stream, task);
+                }
+
+            private:
+                TStream & m_stream;
+            };
+        }
+
+        namespace traits
+        {
+            //#############################################################################
+            //! The stream batch enqueue trait.
+            //!
+            //! This default implementation enqueues the tasks of the batch one after another.
+            //! Streams that can run the whole batch as a single task specialize it.
+            //#############################################################################
+            template<
+                typename TStream,
+                typename TTaskBatch,
+                typename TSfinae = void>
+            struct EnqueueBatch
+            {
+                //-----------------------------------------------------------------------------
+                //
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto enqueueBatch(
+                    TStream & stream,
+                    TTaskBatch & batch)
+                -> void
+                {
+                    batch.forEach(detail::EnqueueTask<TStream>(stream));
+                }
+            };
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Queues the given tasks in the given stream as one batch.
+        //!
+        //! The tasks are executed in the given order.
+        //! Streams executing tasks on the host push the batch as a single queue entry, so it costs one queue push and one wake-up.
+        //-----------------------------------------------------------------------------
+        template<
+            typename TStream,
+            typename... TTasks>
+        ALPAKA_FN_HOST auto enqueueBatch(
+            TStream & stream,
+            TTasks && ... tasks)
+        -> void
+        {
+            detail::TaskBatch<typename std::decay<TTasks>::type...> batch(
+                std::tuple<typename std::decay<TTasks>::type...>(std::forward<TTasks>(tasks)...));
+            traits::EnqueueBatch<
+                TStream,
+                detail::TaskBatch<typename std::decay<TTasks>::type...>>
+            ::enqueueBatch(
+                stream,
+                batch);
+        }
+        //-----------------------------------------------------------------------------
+        //! Queues the tasks in the range [first, last) in the given stream as one batch.
+        //!
+        //! \see enqueueBatch
+        //-----------------------------------------------------------------------------
+        template<
+            typename TStream,
+            typename TIter>
+        ALPAKA_FN_HOST auto enqueueBatchRange(
+            TStream & stream,
+            TIter first,
+            TIter last)
+        -> void
+        {
+            detail::TaskBatchRange<typename std::iterator_traits<TIter>::value_type> batch(
+                first,
+                last);
+            traits::EnqueueBatch<
+                TStream,
+                detail::TaskBatchRange<typename std::iterator_traits<TIter>::value_type>>
+            ::enqueueBatch(
+                stream,
+                batch);
+        }
+
         //-----------------------------------------------------------------------------
         //! Tests if the stream is empty (all ops in the given stream have been completed).
         //-----------------------------------------------------------------------------